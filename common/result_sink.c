@@ -0,0 +1,124 @@
+/*
+ *  ======== result_sink.c ========
+ *  Binary result sink, see result_sink.h.
+ */
+
+#include <string.h>
+
+#include <c6x.h>
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "result_sink.h"
+
+#pragma DATA_SECTION(rsinkBuf, ".rsink")
+#pragma DATA_ALIGN(rsinkBuf, 128)
+Rsink_Core rsinkBuf[RSINK_MAX_CORES];
+
+/* block of the calling core, private to each core */
+static Rsink_Core *rsinkMine;
+
+/*
+ *  ======== rsink_init ========
+ */
+void rsink_init(unsigned int core)
+{
+	Rsink_Core *blk = &rsinkBuf[core % RSINK_MAX_CORES];
+
+	/* any write starts the time-stamp counter */
+	TSCL = 0;
+
+	memset(blk, 0, (char *)blk->rec - (char *)blk);
+	blk->magic = RSINK_MAGIC;
+	blk->core = core;
+	rsinkMine = blk;
+
+	CACHE_wbL1d((void *)blk, (char *)blk->rec - (char *)blk, CACHE_WAIT);
+}
+
+/*
+ *  ======== rsink_tag ========
+ */
+int rsink_tag(int tag, const char *name, int type)
+{
+	Rsink_Tag *t;
+
+	if (rsinkMine == NULL || tag < 0 || tag >= RSINK_MAX_TAGS
+			|| type < RSINK_INT || type > RSINK_U64) {
+		return RSINK_EINVAL;
+	}
+
+	t = &rsinkMine->tags[tag];
+	t->type = type;
+	strncpy(t->name, name, RSINK_TAG_LEN - 1);
+	t->name[RSINK_TAG_LEN - 1] = '\0';
+
+	return RSINK_SOK;
+}
+
+/*
+ *  ======== rsink_put ========
+ */
+int rsink_put(int tag, unsigned int v0, unsigned int v1)
+{
+	Rsink_Core *blk = rsinkMine;
+	Rsink_Record *r;
+
+	if (blk == NULL || tag < 0 || tag >= RSINK_MAX_TAGS) {
+		return RSINK_EINVAL;
+	}
+	if (blk->count == RSINK_MAX_RECORDS) {
+		blk->dropped++;
+		return RSINK_EFULL;
+	}
+
+	r = &blk->rec[blk->count];
+	r->tag = (unsigned char)tag;
+	r->reserved = 0;
+	r->seq = (unsigned short)(blk->count + blk->dropped);
+	r->time = TSCL;
+	r->val[0] = v0;
+	r->val[1] = v1;
+	blk->count++;
+
+	return RSINK_SOK;
+}
+
+/*
+ *  ======== rsink_putInt ========
+ */
+int rsink_putInt(int tag, int v0, int v1)
+{
+	return rsink_put(tag, (unsigned int)v0, (unsigned int)v1);
+}
+
+/*
+ *  ======== rsink_putFloat ========
+ */
+int rsink_putFloat(int tag, float v0, float v1)
+{
+	return rsink_put(tag, _ftoi(v0), _ftoi(v1));
+}
+
+/*
+ *  ======== rsink_putU64 ========
+ */
+int rsink_putU64(int tag, unsigned long long v)
+{
+	return rsink_put(tag, (unsigned int)v, (unsigned int)(v >> 32));
+}
+
+/*
+ *  ======== rsink_flush ========
+ */
+void rsink_flush(void)
+{
+	Rsink_Core *blk = rsinkMine;
+
+	if (blk == NULL) {
+		return;
+	}
+
+	CACHE_wbL1d((void *)blk,
+			(char *)&blk->rec[blk->count] - (char *)blk, CACHE_WAIT);
+}
@@ -0,0 +1,112 @@
+/*
+ *  ======== result_sink.h ========
+ *  Binary result sink. Tasks record results as fixed size binary records
+ *  in a per-core buffer in shared memory instead of printing them, so the
+ *  measured code is not stalled by CIO over JTAG. After the run the
+ *  buffers are saved from the target and turned into text or CSV by
+ *  dct_multicore/host/rsink_decode.c.
+ *
+ *  Every core owns one Rsink_Core block of rsinkBuf, placed in the .rsink
+ *  section (mapped to MSMCSRAM in the .cfg). A block starts with a header
+ *  holding the record count and the tag table, so a dump of rsinkBuf is
+ *  self-describing. Multi-byte fields are in the target's byte order
+ *  (little endian).
+ *
+ *  dct_multicore, core_multi_task and real_multicore_tsk all build this
+ *  one copy: their projects link common/result_sink.c and add common/ to
+ *  the include path.
+ */
+
+#ifndef RESULT_SINK_H_
+#define RESULT_SINK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RSINK_MAGIC         0x4B4E5352  /* "RSNK" */
+#define RSINK_MAX_CORES     4
+#define RSINK_MAX_TAGS      16
+#define RSINK_TAG_LEN       28
+#define RSINK_MAX_RECORDS   1000
+
+/* Record value types, one per tag */
+#define RSINK_INT           0   /* two signed 32-bit values */
+#define RSINK_UINT          1   /* two unsigned 32-bit values */
+#define RSINK_FLOAT         2   /* two single precision values */
+#define RSINK_U64           3   /* one 64-bit value, low word first */
+
+/* Return codes */
+#define RSINK_SOK           0
+#define RSINK_EINVAL        -1
+#define RSINK_EFULL         -2
+
+/*
+ *  One result: a tag registered with rsink_tag, the low word of the
+ *  time-stamp counter when it was recorded, and two 32-bit values.
+ */
+typedef struct Rsink_Record {
+    unsigned char   tag;
+    unsigned char   reserved;
+    unsigned short  seq;                /* record number, low 16 bits */
+    unsigned int    time;               /* TSCL */
+    unsigned int    val[2];
+} Rsink_Record;
+
+typedef struct Rsink_Tag {
+    unsigned int    type;               /* RSINK_xxx, 0 if unused */
+    char            name[RSINK_TAG_LEN];
+} Rsink_Tag;
+
+/* per-core block, a multiple of the 128-byte cache line */
+typedef struct Rsink_Core {
+    unsigned int    magic;              /* RSINK_MAGIC once initialized */
+    unsigned int    core;               /* DNUM of the owner */
+    unsigned int    count;              /* records stored */
+    unsigned int    dropped;            /* records lost to a full buffer */
+    unsigned char   pad[128 - 4 * sizeof(unsigned int)];
+    Rsink_Tag       tags[RSINK_MAX_TAGS];
+    Rsink_Record    rec[RSINK_MAX_RECORDS];
+} Rsink_Core;
+
+extern Rsink_Core rsinkBuf[RSINK_MAX_CORES];
+
+/*
+ *  ======== rsink_init ========
+ *  Clears the calling core's block. Call once per core before any other
+ *  rsink function.
+ */
+void rsink_init(unsigned int core);
+
+/*
+ *  ======== rsink_tag ========
+ *  Names tag (0 .. RSINK_MAX_TAGS - 1) and sets the type of its values.
+ *  Names longer than RSINK_TAG_LEN - 1 characters are truncated.
+ */
+int rsink_tag(int tag, const char *name, int type);
+
+/*
+ *  ======== rsink_put ========
+ *  Appends one record. Only touches the core's own block in L1D, nothing
+ *  is written back to MSMC until rsink_flush. Returns RSINK_EFULL (and
+ *  counts the record as dropped) when the block is full.
+ */
+int rsink_put(int tag, unsigned int v0, unsigned int v1);
+
+/* typed wrappers */
+int rsink_putInt(int tag, int v0, int v1);
+int rsink_putFloat(int tag, float v0, float v1);
+int rsink_putU64(int tag, unsigned long long v);
+
+/*
+ *  ======== rsink_flush ========
+ *  Writes the header and the records stored so far back to shared
+ *  memory. Call outside the timed code, e.g. at the end of the task.
+ */
+void rsink_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESULT_SINK_H_ */
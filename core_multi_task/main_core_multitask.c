@@ -18,6 +18,11 @@
 #include <ti/csl/csl_pscAux.h>
 #include <ti/csl/csl_chip.h>
 
+#include "result_sink.h"
+
+/* result sink tags, decode with dct_multicore/host/rsink_decode.c */
+#define TAG_HELLO 0
+
 int t;
 /*
  *  ======== taskFxn ========
@@ -26,16 +31,14 @@ Void taskFxn(UArg a0, UArg a1)
 {
 	Uint32 coreNum = 0;
 	coreNum = CSL_chipReadReg (CSL_CHIP_DNUM);
-    printf("Hello Dave! This is core %d\n", coreNum);
 
+	rsink_init(coreNum);
+	rsink_tag(TAG_HELLO, "hello", RSINK_UINT);
 
-    if(coreNum == 0){
-    	//to be flushed the string needs \n
-    	//otherwise it wont appear in the console
-    	printf("core 0\n");
-    }else{
-    	printf("outro\n");
-    }
+	//records the core number and whether it is core 0, instead of
+	//printing through CIO
+	rsink_put(TAG_HELLO, coreNum, coreNum == 0);
+	rsink_flush();
 }
 
 /*
@@ -0,0 +1,216 @@
+/*
+ *  ======== dct.c ========
+ *  Separable 2D DCT-II engine (double precision reference path).
+ */
+
+#include <stddef.h>
+
+#include "dct.h"
+#include "dct_tables.h"
+
+/*
+ *  ======== dct_pass ========
+ *  One 1D pass over all n rows of src. The result is written transposed,
+ *  dst = C * src', so running the pass twice gives C * X * C' and both
+ *  passes read their input with unit stride.
+ */
+static void dct_pass(const double *c, const double *src, double *dst, int n)
+{
+	int r, k, j;
+	double acc;
+
+	for (r = 0; r < n; r++) {
+		for (k = 0; k < n; k++) {
+			acc = 0;
+			for (j = 0; j < n; j++) {
+				acc += src[r * n + j] * c[k * n + j];
+			}
+			dst[k * n + r] = acc;
+		}
+	}
+}
+
+/*
+ *  ======== dct_isSupported ========
+ */
+int dct_isSupported(int n)
+{
+	return (n == DCT_SIZE_4 || n == DCT_SIZE_8 || n == DCT_SIZE_16
+			|| n == DCT_SIZE_32);
+}
+
+/*
+ *  ======== dct_coeffTableD ========
+ */
+const double *dct_coeffTableD(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_coeffD4;
+	case DCT_SIZE_8:
+		return dct_coeffD8;
+	case DCT_SIZE_16:
+		return dct_coeffD16;
+	case DCT_SIZE_32:
+		return dct_coeffD32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_coeffTableF ========
+ */
+const float *dct_coeffTableF(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_coeffF4;
+	case DCT_SIZE_8:
+		return dct_coeffF8;
+	case DCT_SIZE_16:
+		return dct_coeffF16;
+	case DCT_SIZE_32:
+		return dct_coeffF32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_coeffTableQ15 ========
+ */
+const short *dct_coeffTableQ15(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_coeffQ15_4;
+	case DCT_SIZE_8:
+		return dct_coeffQ15_8;
+	case DCT_SIZE_16:
+		return dct_coeffQ15_16;
+	case DCT_SIZE_32:
+		return dct_coeffQ15_32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_icoeffTableD ========
+ */
+const double *dct_icoeffTableD(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_icoeffD4;
+	case DCT_SIZE_8:
+		return dct_icoeffD8;
+	case DCT_SIZE_16:
+		return dct_icoeffD16;
+	case DCT_SIZE_32:
+		return dct_icoeffD32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_icoeffTableF ========
+ */
+const float *dct_icoeffTableF(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_icoeffF4;
+	case DCT_SIZE_8:
+		return dct_icoeffF8;
+	case DCT_SIZE_16:
+		return dct_icoeffF16;
+	case DCT_SIZE_32:
+		return dct_icoeffF32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_icoeffTableQ15 ========
+ */
+const short *dct_icoeffTableQ15(int n)
+{
+	switch (n) {
+	case DCT_SIZE_4:
+		return dct_icoeffQ15_4;
+	case DCT_SIZE_8:
+		return dct_icoeffQ15_8;
+	case DCT_SIZE_16:
+		return dct_icoeffQ15_16;
+	case DCT_SIZE_32:
+		return dct_icoeffQ15_32;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_init ========
+ */
+int dct_init(Dct_Obj *obj, int n)
+{
+	if (obj == NULL || !dct_isSupported(n)) {
+		return DCT_EINVAL;
+	}
+
+	obj->size = n;
+	obj->coeff = dct_coeffTableD(n);
+	obj->icoeff = dct_icoeffTableD(n);
+
+	return DCT_SOK;
+}
+
+/*
+ *  ======== dct_forward ========
+ */
+void dct_forward(Dct_Obj *obj, const double *in, double *out)
+{
+	dct_pass(obj->coeff, in, obj->work, obj->size);
+	dct_pass(obj->coeff, obj->work, out, obj->size);
+}
+
+/*
+ *  ======== dct_forwardBlocks ========
+ */
+void dct_forwardBlocks(Dct_Obj *obj, const double *in, double *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_forward(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
+
+/*
+ *  ======== dct_inverse ========
+ */
+void dct_inverse(Dct_Obj *obj, const double *in, double *out)
+{
+	dct_pass(obj->icoeff, in, obj->work, obj->size);
+	dct_pass(obj->icoeff, obj->work, out, obj->size);
+}
+
+/*
+ *  ======== dct_inverseBlocks ========
+ */
+void dct_inverseBlocks(Dct_Obj *obj, const double *in, double *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_inverse(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
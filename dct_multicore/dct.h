@@ -0,0 +1,327 @@
+/*
+ *  ======== dct.h ========
+ *  Separable N x N 2D DCT-II engine used by the dct_multicore tasks.
+ *
+ *  Blocks are stored row-major, N*N contiguous samples per block. The
+ *  transform is orthonormal:
+ *
+ *      Y = C * X * C'      C[k][n] = a(k) * cos((2n+1) * k * pi / 2N)
+ *
+ *  with a(0) = sqrt(1/N) and a(k) = sqrt(2/N) otherwise. The inverse is
+ *  X = C' * Y * C and runs the same kernels on the transposed tables.
+ *
+ *  The code only depends on the C runtime so the same sources build for
+ *  the C6670 and for a Linux host.
+ */
+
+#ifndef DCT_H_
+#define DCT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Supported block sizes */
+#define DCT_SIZE_4      4
+#define DCT_SIZE_8      8
+#define DCT_SIZE_16     16
+#define DCT_SIZE_32     32
+
+#define DCT_MAX_SIZE    DCT_SIZE_32
+#define DCT_MAX_BLOCK   (DCT_MAX_SIZE * DCT_MAX_SIZE)
+
+/* Return codes */
+#define DCT_SOK         0
+#define DCT_EINVAL      -1
+
+/*
+ *  Transform object. One object per block size and per core: the work
+ *  buffer holds the intermediate result between the row and column pass.
+ */
+typedef struct Dct_Obj {
+    int     size;                       /* N */
+    const double *coeff;                /* C[k][n], from dct_tables.c */
+    const double *icoeff;               /* C', for the inverse */
+    double  work[DCT_MAX_BLOCK];        /* row pass output */
+} Dct_Obj;
+
+/*
+ *  Q15 fixed-point transform. Coefficients are Q15, accumulation is done
+ *  in 32 bits (Q31 range) with packed 16 x 16 multiply-accumulates.
+ *
+ *  Input samples must be within +/-DCT_Q15_INPUT_MAX, which covers 8-bit
+ *  pixels with or without level shift and 10-bit video. The row pass keeps
+ *  DCT_Q15_PASS1_BITS fractional bits (none for N = 32, where they would
+ *  overflow the column accumulator); the output is Q0 like the double path.
+ */
+#define DCT_Q15_INPUT_MAX   1023
+#define DCT_Q15_PASS1_BITS  2
+
+/* Q15 flags */
+#define DCT_Q15_TRUNCATE    0x0     /* drop the bits shifted out */
+#define DCT_Q15_ROUND       0x1     /* round to nearest */
+#define DCT_Q15_SATURATE    0x2     /* saturate results to 16 bits */
+#define DCT_Q15_DEFAULT     (DCT_Q15_ROUND | DCT_Q15_SATURATE)
+
+typedef struct Dct_Q15Obj {
+    int     size;                       /* N */
+    int     flags;                      /* DCT_Q15_xxx */
+    int     pass1Bits;                  /* fraction bits after row pass */
+    const short *coeff;                 /* C[k][n] in Q15 */
+    const short *icoeff;                /* C' in Q15 */
+    short   work[DCT_MAX_BLOCK];        /* row pass output */
+} Dct_Q15Obj;
+
+/*
+ *  Single precision transform using the C66x SIMD float units. Blocks
+ *  and the object must be 8-byte aligned; work comes first so it is too.
+ */
+typedef struct Dct_SpObj {
+    float   work[DCT_MAX_BLOCK];        /* row pass output */
+    int     size;                       /* N */
+    const float *coeff;                 /* C[k][n] */
+    const float *icoeff;                /* C' */
+} Dct_SpObj;
+
+/*
+ *  Fast factorized transform for N = 8 (AAN) and N = 16 (even/odd split
+ *  on top of AAN), same data layout and precision as Dct_Obj.
+ *
+ *  With DCT_FAST_SCALED the per-coefficient descale multiply is skipped
+ *  and out[u][v] = Y[u][v] / descale[u][v]; a quantizer can then fold
+ *  dct_fastDescaleTable(n) into its own divisors. The inverse then
+ *  expects in[u][v] = Y[u][v] * prescale[u][v], a dequantizer can fold
+ *  dct_fastPrescaleTable(n) into its multipliers.
+ */
+#define DCT_FAST_SCALED     0x1
+
+typedef struct Dct_FastObj {
+    int     size;                       /* N, 8 or 16 */
+    int     flags;                      /* DCT_FAST_xxx */
+    const double *descale;              /* 1 / (s[u] * s[v]) */
+    const double *prescale;             /* 1 / (t[u] * t[v]) */
+    double  work[16 * 16];              /* row pass output */
+} Dct_FastObj;
+
+/*
+ *  Fused forward DCT + quantization + zigzag for N = 8 and 16. Built on
+ *  the scaled fast transform: the descale factors are folded into the
+ *  quantizer at init time, so each block costs one pass over the pixels,
+ *  the butterflies on a block held in the object, and one write of the
+ *  quantized coefficients in zigzag order.
+ */
+typedef struct Dct_QuantObj {
+    int     size;                       /* N, 8 or 16 */
+    const unsigned char *zigzag;        /* scan order */
+    double  fold[16 * 16];              /* descale / q, in scan order */
+    double  work[16 * 16];              /* block being transformed */
+} Dct_QuantObj;
+
+/*
+ *  ======== dct_isSupported ========
+ *  Returns non-zero if n is one of the supported block sizes.
+ */
+int dct_isSupported(int n);
+
+/*
+ *  ======== dct_coeffTableD / F / Q15 ========
+ *  Return the generated n x n coefficient table for the given precision,
+ *  or NULL for unsupported sizes.
+ */
+const double *dct_coeffTableD(int n);
+const float *dct_coeffTableF(int n);
+const short *dct_coeffTableQ15(int n);
+
+/*
+ *  ======== dct_icoeffTableD / F / Q15 ========
+ *  Same for the transposed tables used by the inverse.
+ */
+const double *dct_icoeffTableD(int n);
+const float *dct_icoeffTableF(int n);
+const short *dct_icoeffTableQ15(int n);
+
+/*
+ *  ======== dct_init ========
+ *  Binds the object to the precomputed n x n coefficient table, no math
+ *  library calls are made. Returns DCT_EINVAL for unsupported sizes.
+ */
+int dct_init(Dct_Obj *obj, int n);
+
+/*
+ *  ======== dct_forward ========
+ *  Forward 2D DCT-II of one block. in and out may not overlap.
+ */
+void dct_forward(Dct_Obj *obj, const double *in, double *out);
+
+/*
+ *  ======== dct_forwardBlocks ========
+ *  Forward 2D DCT-II of numBlocks contiguous blocks. This is the
+ *  throughput entry point: the coefficient matrix and work buffer stay
+ *  resident in L1D/L2 for the whole batch.
+ */
+void dct_forwardBlocks(Dct_Obj *obj, const double *in, double *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_inverse ========
+ *  Inverse 2D DCT (DCT-III) of one block. in and out may not overlap.
+ */
+void dct_inverse(Dct_Obj *obj, const double *in, double *out);
+
+/*
+ *  ======== dct_inverseBlocks ========
+ *  Batched version of dct_inverse.
+ */
+void dct_inverseBlocks(Dct_Obj *obj, const double *in, double *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_initQ15 ========
+ *  Same as dct_init for the Q15 path. flags is a combination of
+ *  DCT_Q15_ROUND and DCT_Q15_SATURATE.
+ */
+int dct_initQ15(Dct_Q15Obj *obj, int n, int flags);
+
+/*
+ *  ======== dct_forwardQ15 ========
+ *  Forward 2D DCT-II of one Q0 block, producing Q0 coefficients. Buffers
+ *  must be 4-byte aligned.
+ */
+void dct_forwardQ15(Dct_Q15Obj *obj, const short *in, short *out);
+
+/*
+ *  ======== dct_forwardBlocksQ15 ========
+ *  Batched version of dct_forwardQ15.
+ */
+void dct_forwardBlocksQ15(Dct_Q15Obj *obj, const short *in, short *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_inverseQ15 ========
+ *  Inverse 2D DCT of one block of Q0 coefficients, producing Q0 samples.
+ *  The coefficients of an N x N block of samples within
+ *  +/-DCT_Q15_INPUT_MAX are accepted for every N.
+ */
+void dct_inverseQ15(Dct_Q15Obj *obj, const short *in, short *out);
+
+/*
+ *  ======== dct_inverseBlocksQ15 ========
+ *  Batched version of dct_inverseQ15.
+ */
+void dct_inverseBlocksQ15(Dct_Q15Obj *obj, const short *in, short *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_initSp ========
+ *  Same as dct_init for the single precision path.
+ */
+int dct_initSp(Dct_SpObj *obj, int n);
+
+/*
+ *  ======== dct_forwardSp ========
+ *  Forward 2D DCT-II of one single precision block.
+ */
+void dct_forwardSp(Dct_SpObj *obj, const float *in, float *out);
+
+/*
+ *  ======== dct_forwardBlocksSp ========
+ *  Batched version of dct_forwardSp.
+ */
+void dct_forwardBlocksSp(Dct_SpObj *obj, const float *in, float *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_inverseSp ========
+ *  Inverse 2D DCT of one single precision block.
+ */
+void dct_inverseSp(Dct_SpObj *obj, const float *in, float *out);
+
+/*
+ *  ======== dct_inverseBlocksSp ========
+ *  Batched version of dct_inverseSp.
+ */
+void dct_inverseBlocksSp(Dct_SpObj *obj, const float *in, float *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_isFastSupported ========
+ *  Returns non-zero if n has a fast factorized transform.
+ */
+int dct_isFastSupported(int n);
+
+/*
+ *  ======== dct_fastDescaleTable ========
+ *  Returns the n x n descale factors of the fast transform, or NULL.
+ */
+const double *dct_fastDescaleTable(int n);
+
+/*
+ *  ======== dct_fastPrescaleTable ========
+ *  Returns the n x n prescale factors of the fast inverse, or NULL.
+ */
+const double *dct_fastPrescaleTable(int n);
+
+/*
+ *  ======== dct_initFast ========
+ *  Same as dct_init for the fast transform. flags is 0 or
+ *  DCT_FAST_SCALED. Returns DCT_EINVAL unless n is 8 or 16.
+ */
+int dct_initFast(Dct_FastObj *obj, int n, int flags);
+
+/*
+ *  ======== dct_forwardFast ========
+ *  Forward 2D DCT-II of one block. in and out may be the same buffer.
+ */
+void dct_forwardFast(Dct_FastObj *obj, const double *in, double *out);
+
+/*
+ *  ======== dct_forwardBlocksFast ========
+ *  Batched version of dct_forwardFast.
+ */
+void dct_forwardBlocksFast(Dct_FastObj *obj, const double *in, double *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_inverseFast ========
+ *  Inverse 2D DCT of one block. in and out may be the same buffer, with
+ *  DCT_FAST_SCALED in is expected to be prescaled already.
+ */
+void dct_inverseFast(Dct_FastObj *obj, const double *in, double *out);
+
+/*
+ *  ======== dct_inverseBlocksFast ========
+ *  Batched version of dct_inverseFast.
+ */
+void dct_inverseBlocksFast(Dct_FastObj *obj, const double *in, double *out,
+        int numBlocks);
+
+/*
+ *  ======== dct_initQuant ========
+ *  Prepares the fused kernel for n x n blocks and the quantization table
+ *  qtable (n x n divisors in row-major order, all non-zero). Returns
+ *  DCT_EINVAL unless n is 8 or 16 and the table is valid.
+ */
+int dct_initQuant(Dct_QuantObj *obj, int n, const unsigned short *qtable);
+
+/*
+ *  ======== dct_forwardQuant ========
+ *  Transforms and quantizes the n x n block of 8-bit pixels at pix (lines
+ *  stride bytes apart, level shifted by 128) and writes the n * n
+ *  quantized coefficients, rounded to nearest, to out in zigzag order.
+ */
+void dct_forwardQuant(Dct_QuantObj *obj, const unsigned char *pix,
+        int stride, short *out);
+
+/*
+ *  ======== dct_forwardQuantBlocks ========
+ *  Same for numBlocks blocks side by side in one block row; block b reads
+ *  pix + b * n and writes out + b * n * n.
+ */
+void dct_forwardQuantBlocks(Dct_QuantObj *obj, const unsigned char *pix,
+        int stride, short *out, int numBlocks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DCT_H_ */
@@ -0,0 +1,237 @@
+/*
+ *  ======== dct_bench.c ========
+ *  DCT benchmark suite: times the double, single precision SIMD, Q15,
+ *  fast butterfly and fused fast + quantization + zigzag paths on the
+ *  same data for every block size and batch size, and prints ticks/block
+ *  and blocks/s per core and for all the cores together, with the
+ *  speedup over the double precision row of the same N and batch.
+ *  fast-quant reads 8-bit pixels, each batch laid out as one block row,
+ *  and includes the level shift, quantization and scan the others leave
+ *  out. Runs on the cores (see DCT_BENCHMARK in main_dct_multicore.c) or
+ *  on a host through host/dct_bench_main.c.
+ *
+ *  Each case transforms the whole buffer BENCH_REPS times, batch blocks
+ *  per call, so small batches show the per-call overhead. The buffer is
+ *  warmed up by one untimed pass first.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dct.h"
+#include "dct_bench.h"
+#include "dct_timer.h"
+
+/* samples per buffer, whatever the block size */
+#define BENCH_SAMPLES   8192
+#define BENCH_REPS      4
+
+static const int sizes[] = { DCT_SIZE_4, DCT_SIZE_8, DCT_SIZE_16, DCT_SIZE_32 };
+static const int batches[] = { 1, 8, 32, 128 };
+
+static const char *const variantNames[DCT_BENCH_VARIANTS] = {
+	"double", "float-simd", "q15", "fast", "fast-quant"
+};
+
+static Dct_Obj benchObj;
+static Dct_SpObj benchSpObj;
+static Dct_Q15Obj benchQ15Obj;
+static Dct_FastObj benchFastObj;
+static Dct_QuantObj benchQuantObj;
+static unsigned short benchQTable[16 * 16];
+
+#ifdef _TMS320C6X
+#pragma DATA_ALIGN(benchSpObj, 8)
+#pragma DATA_ALIGN(benchInD, 8)
+#pragma DATA_ALIGN(benchOutD, 8)
+#pragma DATA_ALIGN(benchInF, 8)
+#pragma DATA_ALIGN(benchOutF, 8)
+#pragma DATA_ALIGN(benchInQ, 8)
+#pragma DATA_ALIGN(benchOutQ, 8)
+#endif
+static double benchInD[BENCH_SAMPLES];
+static double benchOutD[BENCH_SAMPLES];
+static float benchInF[BENCH_SAMPLES];
+static float benchOutF[BENCH_SAMPLES];
+static short benchInQ[BENCH_SAMPLES];
+static short benchOutQ[BENCH_SAMPLES];
+static unsigned char benchInPix[BENCH_SAMPLES];
+
+/*
+ *  ======== benchPass ========
+ *  One pass over the buffer, batch blocks per call.
+ */
+static void benchPass(int variant, int n, int numBlocks, int batch)
+{
+	int b;
+	int off;
+
+	for (b = 0; b < numBlocks; b += batch) {
+		off = b * n * n;
+
+		switch (variant) {
+		case DCT_BENCH_DOUBLE:
+			dct_forwardBlocks(&benchObj, benchInD + off, benchOutD + off,
+					batch);
+			break;
+		case DCT_BENCH_FLOAT:
+			dct_forwardBlocksSp(&benchSpObj, benchInF + off, benchOutF + off,
+					batch);
+			break;
+		case DCT_BENCH_Q15:
+			dct_forwardBlocksQ15(&benchQ15Obj, benchInQ + off,
+					benchOutQ + off, batch);
+			break;
+		case DCT_BENCH_QUANT:
+			dct_forwardQuantBlocks(&benchQuantObj, benchInPix + off,
+					batch * n, benchOutQ + off, batch);
+			break;
+		default:
+			dct_forwardBlocksFast(&benchFastObj, benchInD + off,
+					benchOutD + off, batch);
+			break;
+		}
+	}
+}
+
+/*
+ *  ======== dct_benchMeasure ========
+ */
+int dct_benchMeasure(Dct_BenchCase *cases, int maxCases)
+{
+	unsigned int s, k;
+	int i, rep, n, variant, numBlocks;
+	int count = 0;
+	unsigned long long t0;
+
+	dct_timerInit();
+
+	srand(1);
+	for (i = 0; i < BENCH_SAMPLES; i++) {
+		benchInQ[i] = (short)((rand() & 0xff) - 128);
+		benchInF[i] = benchInQ[i];
+		benchInD[i] = benchInQ[i];
+		benchInPix[i] = (unsigned char)(benchInQ[i] + 128);
+	}
+
+	for (variant = 0; variant < DCT_BENCH_VARIANTS; variant++) {
+		for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+			n = sizes[s];
+			numBlocks = BENCH_SAMPLES / (n * n);
+
+			if ((variant == DCT_BENCH_FAST || variant == DCT_BENCH_QUANT)
+					&& !dct_isFastSupported(n))
+				continue;
+
+			dct_init(&benchObj, n);
+			dct_initSp(&benchSpObj, n);
+			dct_initQ15(&benchQ15Obj, n, DCT_Q15_DEFAULT);
+			dct_initFast(&benchFastObj, n, 0);
+			if (variant == DCT_BENCH_QUANT) {
+				for (i = 0; i < n * n; i++)
+					benchQTable[i] = (unsigned short)(1 + (i / n + i % n) / 2);
+				dct_initQuant(&benchQuantObj, n, benchQTable);
+			}
+
+			for (k = 0; k < sizeof(batches) / sizeof(batches[0]); k++) {
+				if (batches[k] > numBlocks || count == maxCases)
+					break;
+
+				benchPass(variant, n, numBlocks, batches[k]);
+
+				t0 = dct_timerRead();
+				for (rep = 0; rep < BENCH_REPS; rep++)
+					benchPass(variant, n, numBlocks, batches[k]);
+
+				cases[count].ticks = dct_timerRead() - t0;
+				cases[count].variant = variant;
+				cases[count].n = n;
+				cases[count].batch = batches[k];
+				cases[count].blocks = BENCH_REPS * numBlocks;
+				count++;
+			}
+		}
+	}
+
+	return count;
+}
+
+/*
+ *  ======== benchRate ========
+ *  Blocks/s of a case.
+ */
+static double benchRate(const Dct_BenchCase *c)
+{
+	return DCT_TIMER_HZ * c->blocks / (double)c->ticks;
+}
+
+/*
+ *  ======== benchDoubleRate ========
+ *  Blocks/s of the double precision case with the same N and batch as
+ *  case i, 0 if there is none.
+ */
+static double benchDoubleRate(const Dct_BenchCase *cases, int numCases,
+		int i)
+{
+	int j;
+
+	for (j = 0; j < numCases; j++) {
+		if (cases[j].variant == DCT_BENCH_DOUBLE && cases[j].n == cases[i].n
+				&& cases[j].batch == cases[i].batch)
+			return benchRate(&cases[j]);
+	}
+	return 0;
+}
+
+/*
+ *  ======== dct_benchPrint ========
+ */
+void dct_benchPrint(Dct_BenchCase *const *perCore, int numCases,
+		int numCores)
+{
+	int i, core;
+	const Dct_BenchCase *c;
+	double rate, ref, total, totalRef;
+
+	printf("%-10s %4s %6s %5s %14s %14s %8s\n", "variant", "N", "batch",
+			"core", DCT_TIMER_UNIT "/blk", "blocks/s", "speedup");
+
+	for (i = 0; i < numCases; i++) {
+		total = 0;
+		totalRef = 0;
+
+		for (core = 0; core < numCores; core++) {
+			c = &perCore[core][i];
+			rate = benchRate(c);
+			ref = benchDoubleRate(perCore[core], numCases, i);
+			total += rate;
+			totalRef += ref;
+
+			printf("%-10s %4d %6d %5d %14.1f %14.0f %8.2f\n",
+					variantNames[c->variant], c->n, c->batch, core,
+					(double)c->ticks / c->blocks, rate,
+					(ref > 0) ? rate / ref : 0.0);
+		}
+
+		if (numCores > 1) {
+			c = &perCore[0][i];
+			printf("%-10s %4d %6d %5s %14s %14.0f %8.2f\n",
+					variantNames[c->variant], c->n, c->batch, "all", "",
+					total, (totalRef > 0) ? total / totalRef : 0.0);
+		}
+	}
+}
+
+/*
+ *  ======== dct_benchRun ========
+ */
+void dct_benchRun(void)
+{
+	static Dct_BenchCase cases[DCT_BENCH_MAX_CASES];
+	Dct_BenchCase *perCore[1];
+	int numCases;
+
+	numCases = dct_benchMeasure(cases, DCT_BENCH_MAX_CASES);
+	perCore[0] = cases;
+	dct_benchPrint(perCore, numCases, 1);
+}
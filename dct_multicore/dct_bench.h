@@ -0,0 +1,70 @@
+/*
+ *  ======== dct_bench.h ========
+ *  DCT benchmarks, shared by the DSP build and the host build.
+ *
+ *  Every variant (double, single precision SIMD, Q15, fast butterflies,
+ *  fast butterflies fused with quantization and zigzag) is timed for
+ *  every block size and for every batch size that fits the benchmark
+ *  buffers. A core records its results in an array of Dct_BenchCase, so
+ *  the multicore build can run the measurement on all the cores at once
+ *  and have one core print them side by side.
+ */
+
+#ifndef DCT_BENCH_H_
+#define DCT_BENCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Variants */
+#define DCT_BENCH_DOUBLE    0
+#define DCT_BENCH_FLOAT     1
+#define DCT_BENCH_Q15       2
+#define DCT_BENCH_FAST      3
+#define DCT_BENCH_QUANT     4
+#define DCT_BENCH_VARIANTS  5
+
+/* upper bound on the cases of one run, see dct_bench.c */
+#define DCT_BENCH_MAX_CASES 64
+
+/*
+ *  One measurement: blocks transforms of n x n blocks issued batch blocks
+ *  per call took ticks timer ticks (DCT_TIMER_UNIT).
+ */
+typedef struct Dct_BenchCase {
+    int     variant;                    /* DCT_BENCH_xxx */
+    int     n;                          /* block size */
+    int     batch;                      /* blocks per call */
+    unsigned int blocks;                /* blocks transformed */
+    unsigned long long ticks;           /* time taken */
+} Dct_BenchCase;
+
+/*
+ *  ======== dct_benchMeasure ========
+ *  Runs every case on the calling core and stores up to maxCases results
+ *  in cases. Returns the number of cases stored.
+ */
+int dct_benchMeasure(Dct_BenchCase *cases, int maxCases);
+
+/*
+ *  ======== dct_benchPrint ========
+ *  Prints cycles/block, blocks/s and the speedup over the double
+ *  precision case of the same N and batch of every case for each of the
+ *  numCores result arrays (same order and count on every core), then
+ *  the aggregate of all the cores together.
+ */
+void dct_benchPrint(Dct_BenchCase *const *perCore, int numCases,
+        int numCores);
+
+/*
+ *  ======== dct_benchRun ========
+ *  Single core benchmark: dct_benchMeasure then dct_benchPrint.
+ */
+void dct_benchRun(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DCT_BENCH_H_ */
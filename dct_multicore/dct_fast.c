@@ -0,0 +1,153 @@
+/*
+ *  ======== dct_fast.c ========
+ *  Fast factorized 2D DCT-II: the butterflies of dct_fast1d.h applied to
+ *  the rows, then to the columns, then an optional descale. The inverse
+ *  runs the same steps backwards: optional prescale, then the inverse
+ *  butterflies on the columns and on the rows.
+ */
+
+#include <stddef.h>
+
+#include "dct.h"
+#include "dct_tables.h"
+#include "dct_fast1d.h"
+
+/*
+ *  ======== dct_isFastSupported ========
+ */
+int dct_isFastSupported(int n)
+{
+	return (n == DCT_SIZE_8 || n == DCT_SIZE_16);
+}
+
+/*
+ *  ======== dct_fastDescaleTable ========
+ */
+const double *dct_fastDescaleTable(int n)
+{
+	switch (n) {
+	case DCT_SIZE_8:
+		return dct_fastDescale8;
+	case DCT_SIZE_16:
+		return dct_fastDescale16;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_fastPrescaleTable ========
+ */
+const double *dct_fastPrescaleTable(int n)
+{
+	switch (n) {
+	case DCT_SIZE_8:
+		return dct_fastPrescale8;
+	case DCT_SIZE_16:
+		return dct_fastPrescale16;
+	default:
+		return NULL;
+	}
+}
+
+/*
+ *  ======== dct_initFast ========
+ */
+int dct_initFast(Dct_FastObj *obj, int n, int flags)
+{
+	if (obj == NULL || !dct_isFastSupported(n)) {
+		return DCT_EINVAL;
+	}
+
+	obj->size = n;
+	obj->flags = flags;
+	obj->descale = dct_fastDescaleTable(n);
+	obj->prescale = dct_fastPrescaleTable(n);
+
+	return DCT_SOK;
+}
+
+/*
+ *  ======== dct_forwardFast ========
+ */
+void dct_forwardFast(Dct_FastObj *obj, const double *in, double *out)
+{
+	int i;
+	int n = obj->size;
+	double *work = obj->work;
+
+	if (n == DCT_SIZE_8) {
+		for (i = 0; i < 8; i++)
+			dct_fast8(in + i * 8, 1, work + i * 8, 1);
+		for (i = 0; i < 8; i++)
+			dct_fast8(work + i, 8, out + i, 8);
+	} else {
+		for (i = 0; i < 16; i++)
+			dct_fast16(dct_fastOdd16, in + i * 16, 1, work + i * 16, 1);
+		for (i = 0; i < 16; i++)
+			dct_fast16(dct_fastOdd16, work + i, 16, out + i, 16);
+	}
+
+	if (!(obj->flags & DCT_FAST_SCALED)) {
+		for (i = 0; i < n * n; i++)
+			out[i] *= obj->descale[i];
+	}
+}
+
+/*
+ *  ======== dct_forwardBlocksFast ========
+ */
+void dct_forwardBlocksFast(Dct_FastObj *obj, const double *in, double *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_forwardFast(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
+
+/*
+ *  ======== dct_inverseFast ========
+ */
+void dct_inverseFast(Dct_FastObj *obj, const double *in, double *out)
+{
+	int i;
+	int n = obj->size;
+	double *work = obj->work;
+
+	if (obj->flags & DCT_FAST_SCALED) {
+		for (i = 0; i < n * n; i++)
+			work[i] = in[i];
+	} else {
+		for (i = 0; i < n * n; i++)
+			work[i] = in[i] * obj->prescale[i];
+	}
+
+	if (n == DCT_SIZE_8) {
+		for (i = 0; i < 8; i++)
+			dct_ifast8(work + i, 8, work + i, 8);
+		for (i = 0; i < 8; i++)
+			dct_ifast8(work + i * 8, 1, out + i * 8, 1);
+	} else {
+		for (i = 0; i < 16; i++)
+			dct_ifast16(dct_fastOdd16, work + i, 16, work + i, 16);
+		for (i = 0; i < 16; i++)
+			dct_ifast16(dct_fastOdd16, work + i * 16, 1, out + i * 16, 1);
+	}
+}
+
+/*
+ *  ======== dct_inverseBlocksFast ========
+ */
+void dct_inverseBlocksFast(Dct_FastObj *obj, const double *in, double *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_inverseFast(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
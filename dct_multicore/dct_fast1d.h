@@ -0,0 +1,193 @@
+/*
+ *  ======== dct_fast1d.h ========
+ *  Factorized 1D DCT-II butterflies shared by dct_fast.c and the table
+ *  generator (host/dct_gentables.c), which derives the output scale
+ *  factors from them.
+ *
+ *  The forward kernels return out[k] = s[k] * X[k], X being the
+ *  orthonormal DCT-II and s[k] a per-output scale that 2D users either
+ *  undo with the dct_fastDescale tables or fold into quantization. The
+ *  inverse kernels expect their inputs pre-multiplied the same way, by
+ *  the dct_fastPrescale tables or by dequantization.
+ */
+
+#ifndef DCT_FAST1D_H_
+#define DCT_FAST1D_H_
+
+/*
+ *  ======== dct_fast8 ========
+ *  8-point Arai-Agui-Nakajima DCT: 5 multiplies and 29 adds. in and out
+ *  are read/written with strides is and os; they may alias.
+ */
+static inline void dct_fast8(const double *in, int is, double *out, int os)
+{
+	double tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+	double tmp10, tmp11, tmp12, tmp13;
+	double z1, z2, z3, z4, z5, z11, z13;
+
+	tmp0 = in[0 * is] + in[7 * is];
+	tmp7 = in[0 * is] - in[7 * is];
+	tmp1 = in[1 * is] + in[6 * is];
+	tmp6 = in[1 * is] - in[6 * is];
+	tmp2 = in[2 * is] + in[5 * is];
+	tmp5 = in[2 * is] - in[5 * is];
+	tmp3 = in[3 * is] + in[4 * is];
+	tmp4 = in[3 * is] - in[4 * is];
+
+	/* even part */
+	tmp10 = tmp0 + tmp3;
+	tmp13 = tmp0 - tmp3;
+	tmp11 = tmp1 + tmp2;
+	tmp12 = tmp1 - tmp2;
+
+	out[0 * os] = tmp10 + tmp11;
+	out[4 * os] = tmp10 - tmp11;
+
+	z1 = (tmp12 + tmp13) * 0.707106781186547524;   /* cos(4pi/16) */
+	out[2 * os] = tmp13 + z1;
+	out[6 * os] = tmp13 - z1;
+
+	/* odd part */
+	tmp10 = tmp4 + tmp5;
+	tmp11 = tmp5 + tmp6;
+	tmp12 = tmp6 + tmp7;
+
+	z5 = (tmp10 - tmp12) * 0.382683432365089772;   /* cos(6pi/16) */
+	z2 = 0.541196100146196984 * tmp10 + z5;        /* c2 - c6 */
+	z4 = 1.306562964876376527 * tmp12 + z5;        /* c2 + c6 */
+	z3 = tmp11 * 0.707106781186547524;             /* c4 */
+
+	z11 = tmp7 + z3;
+	z13 = tmp7 - z3;
+
+	out[5 * os] = z13 + z2;
+	out[3 * os] = z13 - z2;
+	out[1 * os] = z11 + z4;
+	out[7 * os] = z11 - z4;
+}
+
+/*
+ *  ======== dct_fast16 ========
+ *  16-point DCT by even/odd decomposition: the even outputs are the AAN
+ *  8-point DCT of x[n] + x[15-n], the odd outputs an 8 x 8 product of
+ *  x[n] - x[15-n] with odd[m][n] = cos((2n+1)(2m+1)pi/32). 69 multiplies
+ *  instead of 256. in and out may alias.
+ */
+static inline void dct_fast16(const double *odd, const double *in, int is,
+		double *out, int os)
+{
+	double sum[8];
+	double diff[8];
+	double even[8];
+	double acc;
+	int m, n;
+
+	for (n = 0; n < 8; n++) {
+		sum[n] = in[n * is] + in[(15 - n) * is];
+		diff[n] = in[n * is] - in[(15 - n) * is];
+	}
+
+	dct_fast8(sum, 1, even, 1);
+
+	for (m = 0; m < 8; m++) {
+		acc = 0;
+		for (n = 0; n < 8; n++)
+			acc += diff[n] * odd[m * 8 + n];
+		out[(2 * m + 1) * os] = acc;
+		out[(2 * m) * os] = even[m];
+	}
+}
+
+/*
+ *  ======== dct_ifast8 ========
+ *  8-point inverse AAN DCT: 5 multiplies and 29 adds. in and out may
+ *  alias.
+ */
+static inline void dct_ifast8(const double *in, int is, double *out, int os)
+{
+	double tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+	double tmp10, tmp11, tmp12, tmp13;
+	double z5, z10, z11, z12, z13;
+
+	/* even part */
+	tmp0 = in[0 * is];
+	tmp1 = in[2 * is];
+	tmp2 = in[4 * is];
+	tmp3 = in[6 * is];
+
+	tmp10 = tmp0 + tmp2;
+	tmp11 = tmp0 - tmp2;
+
+	tmp13 = tmp1 + tmp3;
+	tmp12 = (tmp1 - tmp3) * 1.414213562373095049 - tmp13;   /* 2 * c4 */
+
+	tmp0 = tmp10 + tmp13;
+	tmp3 = tmp10 - tmp13;
+	tmp1 = tmp11 + tmp12;
+	tmp2 = tmp11 - tmp12;
+
+	/* odd part */
+	tmp4 = in[1 * is];
+	tmp5 = in[3 * is];
+	tmp6 = in[5 * is];
+	tmp7 = in[7 * is];
+
+	z13 = tmp6 + tmp5;
+	z10 = tmp6 - tmp5;
+	z11 = tmp4 + tmp7;
+	z12 = tmp4 - tmp7;
+
+	tmp7 = z11 + z13;
+	tmp11 = (z11 - z13) * 1.414213562373095049;            /* 2 * c4 */
+
+	z5 = (z10 + z12) * 1.847759065022573512;               /* 2 * c2 */
+	tmp10 = 1.082392200292393968 * z12 - z5;               /* 2 * (c2 - c6) */
+	tmp12 = -2.613125929752753055 * z10 + z5;              /* -2 * (c2 + c6) */
+
+	tmp6 = tmp12 - tmp7;
+	tmp5 = tmp11 - tmp6;
+	tmp4 = tmp10 + tmp5;
+
+	out[0 * os] = tmp0 + tmp7;
+	out[7 * os] = tmp0 - tmp7;
+	out[1 * os] = tmp1 + tmp6;
+	out[6 * os] = tmp1 - tmp6;
+	out[2 * os] = tmp2 + tmp5;
+	out[5 * os] = tmp2 - tmp5;
+	out[4 * os] = tmp3 + tmp4;
+	out[3 * os] = tmp3 - tmp4;
+}
+
+/*
+ *  ======== dct_ifast16 ========
+ *  16-point inverse DCT, the even/odd split of dct_fast16 run backwards:
+ *  the even inputs give x[n] + x[15-n] through the inverse AAN, the odd
+ *  inputs give x[n] - x[15-n] through the transposed odd matrix. in and
+ *  out may alias.
+ */
+static inline void dct_ifast16(const double *odd, const double *in, int is,
+		double *out, int os)
+{
+	double even[8];
+	double sum[8];
+	double diff[8];
+	int m, n;
+
+	for (m = 0; m < 8; m++) {
+		even[m] = in[(2 * m) * is];
+		diff[m] = 0;
+	}
+	for (m = 0; m < 8; m++) {
+		for (n = 0; n < 8; n++)
+			diff[n] += in[(2 * m + 1) * is] * odd[m * 8 + n];
+	}
+
+	dct_ifast8(even, 1, sum, 1);
+
+	for (n = 0; n < 8; n++) {
+		out[n * os] = sum[n] + diff[n];
+		out[(15 - n) * os] = sum[n] - diff[n];
+	}
+}
+
+#endif /* DCT_FAST1D_H_ */
@@ -0,0 +1,60 @@
+/*
+ *  ======== dct_image.c ========
+ *  Frame level DCT helpers.
+ */
+
+#include "dct_image.h"
+
+/*
+ *  ======== dct_imageSlice ========
+ */
+void dct_imageSlice(int blockRows, int core, int numCores, int *first,
+		int *count)
+{
+	int start = (blockRows * core) / numCores;
+	int end = (blockRows * (core + 1)) / numCores;
+
+	*first = start;
+	*count = end - start;
+}
+
+/*
+ *  ======== dct_imageGatherRow ========
+ *  Copies one row of blocks into contiguous N x N blocks, level shifted
+ *  to -128..127.
+ */
+static void dct_imageGatherRow(const unsigned char *row, int width,
+		int stride, int n, float *blocks)
+{
+	int bc, y, x;
+	const unsigned char *src;
+	float *dst;
+
+	for (bc = 0; bc < width / n; bc++) {
+		dst = blocks + bc * n * n;
+		for (y = 0; y < n; y++) {
+			src = row + y * stride + bc * n;
+			for (x = 0; x < n; x++) {
+				dst[y * n + x] = (float)((int)src[x] - 128);
+			}
+		}
+	}
+}
+
+/*
+ *  ======== dct_imageForwardRows ========
+ */
+void dct_imageForwardRows(Dct_SpObj *obj, const unsigned char *img,
+		int width, int stride, float *coef, int firstRow, int numRows,
+		float *scratch)
+{
+	int br;
+	int n = obj->size;
+	int blocksPerRow = width / n;
+
+	for (br = firstRow; br < firstRow + numRows; br++) {
+		dct_imageGatherRow(img + br * n * stride, width, stride, n, scratch);
+		dct_forwardBlocksSp(obj, scratch, coef + br * blocksPerRow * n * n,
+				blocksPerRow);
+	}
+}
@@ -0,0 +1,43 @@
+/*
+ *  ======== dct_image.h ========
+ *  Frame level helpers: transform whole rows of N x N blocks of an 8-bit
+ *  image and split the block rows of a frame between cores.
+ */
+
+#ifndef DCT_IMAGE_H_
+#define DCT_IMAGE_H_
+
+#include "dct.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  ======== dct_imageSlice ========
+ *  Splits blockRows block rows as evenly as possible between numCores
+ *  cores and returns the first row and row count of core.
+ */
+void dct_imageSlice(int blockRows, int core, int numCores, int *first,
+        int *count);
+
+/*
+ *  ======== dct_imageForwardRows ========
+ *  Transforms numRows block rows of img starting at block row firstRow.
+ *
+ *  img is width x (rows * N) 8-bit pixels, stride bytes per line; width
+ *  must be a multiple of N. Each block row is level shifted into scratch
+ *  (width * N floats, 8-byte aligned, ideally in L2) and transformed in
+ *  one dct_forwardBlocksSp call. Coefficients are stored block by block
+ *  in raster order, N * N floats per block, so block (br, bc) starts at
+ *  coef + (br * width / N + bc) * N * N.
+ */
+void dct_imageForwardRows(Dct_SpObj *obj, const unsigned char *img,
+        int width, int stride, float *coef, int firstRow, int numRows,
+        float *scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DCT_IMAGE_H_ */
@@ -0,0 +1,143 @@
+/*
+ *  ======== dct_intrin.h ========
+ *  C66x intrinsics used by the DCT kernels.
+ *
+ *  On the DSP this just pulls in the compiler's c6x.h. On any other
+ *  compiler the same intrinsics are provided as portable C with
+ *  bit-exact results, so kernels are written once and a Linux host build
+ *  produces the same output block-for-block as the C6670.
+ */
+
+#ifndef DCT_INTRIN_H_
+#define DCT_INTRIN_H_
+
+#ifdef _TMS320C6X
+
+#include <c6x.h>
+
+#else
+
+#include <string.h>
+
+/* Aligned 32-bit load */
+static inline unsigned int _amem4_const(const void *p)
+{
+	unsigned int v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+/* Signed 16 x 16 dot product of the two halfword pairs */
+static inline int _dotp2(int a, int b)
+{
+	return (int)(short)a * (int)(short)b
+			+ (int)(short)(a >> 16) * (int)(short)(b >> 16);
+}
+
+/* Saturating 32-bit add */
+static inline int _sadd(int a, int b)
+{
+	long long s = (long long)a + b;
+
+	if (s > 0x7fffffffLL)
+		return 0x7fffffff;
+	if (s < -0x7fffffffLL - 1)
+		return -0x7fffffff - 1;
+	return (int)s;
+}
+
+/* Saturate two 32-bit values to 16 bits and pack them, a in the upper half */
+static inline unsigned int _spack2(int a, int b)
+{
+	if (a > 32767)
+		a = 32767;
+	if (a < -32768)
+		a = -32768;
+	if (b > 32767)
+		b = 32767;
+	if (b < -32768)
+		b = -32768;
+	return ((unsigned int)(unsigned short)a << 16) | (unsigned short)b;
+}
+
+/*
+ * Single precision SIMD. __float2_t holds two floats (hi:lo) in a register
+ * pair, __x128_t four floats in a register quad.
+ */
+typedef struct {
+	float lo;
+	float hi;
+} __float2_t;
+
+typedef struct {
+	__float2_t lo;
+	__float2_t hi;
+} __x128_t;
+
+/* Aligned 64-bit load of two floats */
+static inline __float2_t _amem8_f2_const(const void *p)
+{
+	__float2_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline __float2_t _ftof2(float hi, float lo)
+{
+	__float2_t v;
+
+	v.hi = hi;
+	v.lo = lo;
+	return v;
+}
+
+static inline float _hif2(__float2_t a)
+{
+	return a.hi;
+}
+
+static inline float _lof2(__float2_t a)
+{
+	return a.lo;
+}
+
+static inline __float2_t _daddsp(__float2_t a, __float2_t b)
+{
+	return _ftof2(a.hi + b.hi, a.lo + b.lo);
+}
+
+static inline __float2_t _dmpysp(__float2_t a, __float2_t b)
+{
+	return _ftof2(a.hi * b.hi, a.lo * b.lo);
+}
+
+static inline __x128_t _f2to128(__float2_t hi, __float2_t lo)
+{
+	__x128_t v;
+
+	v.hi = hi;
+	v.lo = lo;
+	return v;
+}
+
+static inline __float2_t _hif2_128(__x128_t a)
+{
+	return a.hi;
+}
+
+static inline __float2_t _lof2_128(__x128_t a)
+{
+	return a.lo;
+}
+
+/* Four single precision multiplies */
+static inline __x128_t _qmpysp(__x128_t a, __x128_t b)
+{
+	return _f2to128(_dmpysp(a.hi, b.hi), _dmpysp(a.lo, b.lo));
+}
+
+#endif /* _TMS320C6X */
+
+#endif /* DCT_INTRIN_H_ */
@@ -0,0 +1,122 @@
+/*
+ *  ======== dct_q15.c ========
+ *  Q15 fixed-point 2D DCT-II built on packed 16-bit multiply-accumulate
+ *  intrinsics. The portable versions in dct_intrin.h make the host build
+ *  bit-exact with the DSP.
+ */
+
+#include <stddef.h>
+
+#include "dct.h"
+#include "dct_intrin.h"
+
+/*
+ *  ======== dctq15_pass ========
+ *  One 1D pass, written transposed like dct_pass in dct.c. Each output
+ *  is a 32-bit dot product of a sample row and a Q15 coefficient row,
+ *  two _dotp2 per iteration, scaled down by shift bits.
+ */
+static void dctq15_pass(const short *c, const short *src, short *dst, int n,
+		int shift, int flags)
+{
+	int r, k, j;
+	int acc0, acc1, acc;
+	int rnd = (flags & DCT_Q15_ROUND) ? (1 << (shift - 1)) : 0;
+	const short *x;
+	const short *ck;
+
+	for (r = 0; r < n; r++) {
+		x = src + r * n;
+		for (k = 0; k < n; k++) {
+			ck = c + k * n;
+			acc0 = 0;
+			acc1 = 0;
+			/* n is a multiple of 4 for every supported size */
+			for (j = 0; j < n; j += 4) {
+				acc0 += _dotp2(_amem4_const(&x[j]), _amem4_const(&ck[j]));
+				acc1 += _dotp2(_amem4_const(&x[j + 2]),
+						_amem4_const(&ck[j + 2]));
+			}
+
+			if (flags & DCT_Q15_SATURATE) {
+				acc = _sadd(_sadd(acc0, acc1), rnd) >> shift;
+				dst[k * n + r] = (short)_spack2(0, acc);
+			} else {
+				acc = (acc0 + acc1 + rnd) >> shift;
+				dst[k * n + r] = (short)acc;
+			}
+		}
+	}
+}
+
+/*
+ *  ======== dct_initQ15 ========
+ */
+int dct_initQ15(Dct_Q15Obj *obj, int n, int flags)
+{
+	if (obj == NULL || !dct_isSupported(n)) {
+		return DCT_EINVAL;
+	}
+
+	obj->size = n;
+	obj->flags = flags;
+	obj->pass1Bits = (n == DCT_SIZE_32) ? 0 : DCT_Q15_PASS1_BITS;
+	obj->coeff = dct_coeffTableQ15(n);
+	obj->icoeff = dct_icoeffTableQ15(n);
+
+	return DCT_SOK;
+}
+
+/*
+ *  ======== dct_forwardQ15 ========
+ *  Row pass: Q0 * Q15 -> keep pass1Bits fractional bits.
+ *  Column pass: Q(pass1Bits) * Q15 -> Q0.
+ */
+void dct_forwardQ15(Dct_Q15Obj *obj, const short *in, short *out)
+{
+	dctq15_pass(obj->coeff, in, obj->work, obj->size,
+			15 - obj->pass1Bits, obj->flags);
+	dctq15_pass(obj->coeff, obj->work, out, obj->size,
+			15 + obj->pass1Bits, obj->flags);
+}
+
+/*
+ *  ======== dct_forwardBlocksQ15 ========
+ */
+void dct_forwardBlocksQ15(Dct_Q15Obj *obj, const short *in, short *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_forwardQ15(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
+
+/*
+ *  ======== dct_inverseQ15 ========
+ *  Same scaling as the forward: the row pass output is the forward row
+ *  pass output of the reconstructed block, so it fits the same range.
+ */
+void dct_inverseQ15(Dct_Q15Obj *obj, const short *in, short *out)
+{
+	dctq15_pass(obj->icoeff, in, obj->work, obj->size,
+			15 - obj->pass1Bits, obj->flags);
+	dctq15_pass(obj->icoeff, obj->work, out, obj->size,
+			15 + obj->pass1Bits, obj->flags);
+}
+
+/*
+ *  ======== dct_inverseBlocksQ15 ========
+ */
+void dct_inverseBlocksQ15(Dct_Q15Obj *obj, const short *in, short *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_inverseQ15(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
@@ -0,0 +1,103 @@
+/*
+ *  ======== dct_quant.c ========
+ *  Fused forward DCT + quantization + zigzag on top of the scaled fast
+ *  transform of dct_fast1d.h.
+ */
+
+#include <stddef.h>
+
+#include "dct.h"
+#include "dct_tables.h"
+#include "dct_fast1d.h"
+
+/*
+ *  ======== dct_quantRound ========
+ *  Round to nearest, halves away from zero, saturated to 16 bits.
+ */
+static inline short dct_quantRound(double v)
+{
+	int q;
+
+	if (v >= 32767.0)
+		return 32767;
+	if (v <= -32768.0)
+		return -32768;
+
+	q = (v >= 0) ? (int)(v + 0.5) : -(int)(0.5 - v);
+	return (short)q;
+}
+
+/*
+ *  ======== dct_initQuant ========
+ */
+int dct_initQuant(Dct_QuantObj *obj, int n, const unsigned short *qtable)
+{
+	int i, z;
+	const double *descale;
+
+	if (obj == NULL || qtable == NULL || !dct_isFastSupported(n)) {
+		return DCT_EINVAL;
+	}
+
+	obj->size = n;
+	obj->zigzag = (n == DCT_SIZE_8) ? dct_zigzag8 : dct_zigzag16;
+	descale = dct_fastDescaleTable(n);
+
+	for (i = 0; i < n * n; i++) {
+		z = obj->zigzag[i];
+		if (qtable[z] == 0) {
+			return DCT_EINVAL;
+		}
+		obj->fold[i] = descale[z] / qtable[z];
+	}
+
+	return DCT_SOK;
+}
+
+/*
+ *  ======== dct_forwardQuant ========
+ */
+void dct_forwardQuant(Dct_QuantObj *obj, const unsigned char *pix,
+		int stride, short *out)
+{
+	int i, j;
+	int n = obj->size;
+	double *work = obj->work;
+	double line[16];
+
+	/* row pass straight from the pixels */
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < n; j++)
+			line[j] = (double)((int)pix[i * stride + j] - 128);
+		if (n == DCT_SIZE_8)
+			dct_fast8(line, 1, work + i * 8, 1);
+		else
+			dct_fast16(dct_fastOdd16, line, 1, work + i * 16, 1);
+	}
+
+	/* column pass in place */
+	for (i = 0; i < n; i++) {
+		if (n == DCT_SIZE_8)
+			dct_fast8(work + i, 8, work + i, 8);
+		else
+			dct_fast16(dct_fastOdd16, work + i, 16, work + i, 16);
+	}
+
+	/* descale, quantize and scan in one go */
+	for (i = 0; i < n * n; i++)
+		out[i] = dct_quantRound(work[obj->zigzag[i]] * obj->fold[i]);
+}
+
+/*
+ *  ======== dct_forwardQuantBlocks ========
+ */
+void dct_forwardQuantBlocks(Dct_QuantObj *obj, const unsigned char *pix,
+		int stride, short *out, int numBlocks)
+{
+	int b;
+	int n = obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_forwardQuant(obj, pix + b * n, stride, out + b * n * n);
+	}
+}
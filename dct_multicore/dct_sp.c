@@ -0,0 +1,107 @@
+/*
+ *  ======== dct_sp.c ========
+ *  Single precision 2D DCT-II using the C66x SIMD float instructions:
+ *  _qmpysp does four multiplies per issue and two _daddsp accumulators
+ *  keep the adds independent.
+ */
+
+#include <stddef.h>
+
+#include "dct.h"
+#include "dct_intrin.h"
+
+/*
+ *  ======== dctsp_pass ========
+ *  One 1D pass, written transposed like dct_pass in dct.c.
+ */
+static void dctsp_pass(const float *c, const float *src, float *dst, int n)
+{
+	int r, k, j;
+	__float2_t acc01, acc23;
+	__x128_t x, ck, p;
+	const float *xr;
+	const float *cr;
+
+	for (r = 0; r < n; r++) {
+		xr = src + r * n;
+		for (k = 0; k < n; k++) {
+			cr = c + k * n;
+			acc01 = _ftof2(0.0f, 0.0f);
+			acc23 = _ftof2(0.0f, 0.0f);
+			/* n is a multiple of 4 for every supported size */
+			for (j = 0; j < n; j += 4) {
+				x = _f2to128(_amem8_f2_const(&xr[j + 2]),
+						_amem8_f2_const(&xr[j]));
+				ck = _f2to128(_amem8_f2_const(&cr[j + 2]),
+						_amem8_f2_const(&cr[j]));
+				p = _qmpysp(x, ck);
+				acc01 = _daddsp(acc01, _lof2_128(p));
+				acc23 = _daddsp(acc23, _hif2_128(p));
+			}
+			acc01 = _daddsp(acc01, acc23);
+			dst[k * n + r] = _hif2(acc01) + _lof2(acc01);
+		}
+	}
+}
+
+/*
+ *  ======== dct_initSp ========
+ */
+int dct_initSp(Dct_SpObj *obj, int n)
+{
+	if (obj == NULL || !dct_isSupported(n)) {
+		return DCT_EINVAL;
+	}
+
+	obj->size = n;
+	obj->coeff = dct_coeffTableF(n);
+	obj->icoeff = dct_icoeffTableF(n);
+
+	return DCT_SOK;
+}
+
+/*
+ *  ======== dct_forwardSp ========
+ */
+void dct_forwardSp(Dct_SpObj *obj, const float *in, float *out)
+{
+	dctsp_pass(obj->coeff, in, obj->work, obj->size);
+	dctsp_pass(obj->coeff, obj->work, out, obj->size);
+}
+
+/*
+ *  ======== dct_forwardBlocksSp ========
+ */
+void dct_forwardBlocksSp(Dct_SpObj *obj, const float *in, float *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_forwardSp(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
+
+/*
+ *  ======== dct_inverseSp ========
+ */
+void dct_inverseSp(Dct_SpObj *obj, const float *in, float *out)
+{
+	dctsp_pass(obj->icoeff, in, obj->work, obj->size);
+	dctsp_pass(obj->icoeff, obj->work, out, obj->size);
+}
+
+/*
+ *  ======== dct_inverseBlocksSp ========
+ */
+void dct_inverseBlocksSp(Dct_SpObj *obj, const float *in, float *out,
+		int numBlocks)
+{
+	int b;
+	int blockLen = obj->size * obj->size;
+
+	for (b = 0; b < numBlocks; b++) {
+		dct_inverseSp(obj, in + b * blockLen, out + b * blockLen);
+	}
+}
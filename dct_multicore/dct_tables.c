@@ -0,0 +1,2140 @@
+/*
+ *  ======== dct_tables.c ========
+ *  DCT-II coefficient tables C[k][n], row-major.
+ *
+ *  GENERATED by host/dct_gentables.c, do not edit.
+ */
+
+#include "dct_tables.h"
+
+/* N = 4 */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffD4, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffD4, 8)
+#endif
+const double dct_coeffD4[16] = {
+	0.5, 0.5, 0.5, 0.5,
+	0.65328148243818829, 0.27059805007309856, -0.27059805007309851, -0.65328148243818829,
+	0.50000000000000011, -0.5, -0.50000000000000011, 0.49999999999999989,
+	0.27059805007309856, -0.6532814824381884, 0.65328148243818818, -0.27059805007309862,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffF4, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffF4, 8)
+#endif
+const float dct_coeffF4[16] = {
+	0.5f, 0.5f, 0.5f, 0.5f,
+	0.65328151f, 0.270598054f, -0.270598054f, -0.65328151f,
+	0.5f, -0.5f, -0.5f, 0.5f,
+	0.270598054f, -0.65328151f, 0.65328151f, -0.270598054f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffQ15_4, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffQ15_4, 8)
+#endif
+const short dct_coeffQ15_4[16] = {
+	16384, 16384, 16384, 16384,
+	21407, 8867, -8867, -21407,
+	16384, -16384, -16384, 16384,
+	8867, -21407, 21407, -8867,
+};
+
+/* N = 4, inverse (transposed) */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffD4, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffD4, 8)
+#endif
+const double dct_icoeffD4[16] = {
+	0.5, 0.65328148243818829, 0.50000000000000011, 0.27059805007309856,
+	0.5, 0.27059805007309856, -0.5, -0.6532814824381884,
+	0.5, -0.27059805007309851, -0.50000000000000011, 0.65328148243818818,
+	0.5, -0.65328148243818829, 0.49999999999999989, -0.27059805007309862,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffF4, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffF4, 8)
+#endif
+const float dct_icoeffF4[16] = {
+	0.5f, 0.65328151f, 0.5f, 0.270598054f,
+	0.5f, 0.270598054f, -0.5f, -0.65328151f,
+	0.5f, -0.270598054f, -0.5f, 0.65328151f,
+	0.5f, -0.65328151f, 0.5f, -0.270598054f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffQ15_4, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffQ15_4, 8)
+#endif
+const short dct_icoeffQ15_4[16] = {
+	16384, 21407, 16384, 8867,
+	16384, 8867, -16384, -21407,
+	16384, -8867, -16384, 21407,
+	16384, -21407, 16384, -8867,
+};
+
+/* N = 8 */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffD8, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffD8, 8)
+#endif
+const double dct_coeffD8[64] = {
+	0.35355339059327379, 0.35355339059327379, 0.35355339059327379, 0.35355339059327379,
+	0.35355339059327379, 0.35355339059327379, 0.35355339059327379, 0.35355339059327379,
+	0.49039264020161522, 0.41573480615127262, 0.27778511650980114, 0.097545161008064166,
+	-0.097545161008064096, -0.27778511650980098, -0.41573480615127267, -0.49039264020161522,
+	0.46193976625564337, 0.19134171618254492, -0.19134171618254486, -0.46193976625564337,
+	-0.46193976625564342, -0.19134171618254517, 0.191341716182545, 0.46193976625564326,
+	0.41573480615127262, -0.097545161008064096, -0.49039264020161522, -0.27778511650980109,
+	0.27778511650980092, 0.49039264020161522, 0.097545161008064388, -0.41573480615127256,
+	0.35355339059327379, -0.35355339059327373, -0.35355339059327384, 0.35355339059327368,
+	0.35355339059327384, -0.35355339059327334, -0.35355339059327356, 0.35355339059327329,
+	0.27778511650980114, -0.49039264020161522, 0.097545161008064152, 0.41573480615127273,
+	-0.41573480615127256, -0.097545161008064013, 0.49039264020161533, -0.27778511650980076,
+	0.19134171618254492, -0.46193976625564342, 0.46193976625564326, -0.19134171618254495,
+	-0.19134171618254528, 0.46193976625564337, -0.4619397662556432, 0.19134171618254478,
+	0.097545161008064166, -0.27778511650980109, 0.41573480615127273, -0.49039264020161533,
+	0.49039264020161522, -0.41573480615127251, 0.27778511650980076, -0.097545161008064291,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffF8, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffF8, 8)
+#endif
+const float dct_coeffF8[64] = {
+	0.353553385f, 0.353553385f, 0.353553385f, 0.353553385f,
+	0.353553385f, 0.353553385f, 0.353553385f, 0.353553385f,
+	0.490392625f, 0.415734798f, 0.277785122f, 0.0975451618f,
+	-0.0975451618f, -0.277785122f, -0.415734798f, -0.490392625f,
+	0.461939752f, 0.191341713f, -0.191341713f, -0.461939752f,
+	-0.461939752f, -0.191341713f, 0.191341713f, 0.461939752f,
+	0.415734798f, -0.0975451618f, -0.490392625f, -0.277785122f,
+	0.277785122f, 0.490392625f, 0.0975451618f, -0.415734798f,
+	0.353553385f, -0.353553385f, -0.353553385f, 0.353553385f,
+	0.353553385f, -0.353553385f, -0.353553385f, 0.353553385f,
+	0.277785122f, -0.490392625f, 0.0975451618f, 0.415734798f,
+	-0.415734798f, -0.0975451618f, 0.490392625f, -0.277785122f,
+	0.191341713f, -0.461939752f, 0.461939752f, -0.191341713f,
+	-0.191341713f, 0.461939752f, -0.461939752f, 0.191341713f,
+	0.0975451618f, -0.277785122f, 0.415734798f, -0.490392625f,
+	0.490392625f, -0.415734798f, 0.277785122f, -0.0975451618f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffQ15_8, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffQ15_8, 8)
+#endif
+const short dct_coeffQ15_8[64] = {
+	11585, 11585, 11585, 11585, 11585, 11585, 11585, 11585,
+	16069, 13623, 9102, 3196, -3196, -9102, -13623, -16069,
+	15137, 6270, -6270, -15137, -15137, -6270, 6270, 15137,
+	13623, -3196, -16069, -9102, 9102, 16069, 3196, -13623,
+	11585, -11585, -11585, 11585, 11585, -11585, -11585, 11585,
+	9102, -16069, 3196, 13623, -13623, -3196, 16069, -9102,
+	6270, -15137, 15137, -6270, -6270, 15137, -15137, 6270,
+	3196, -9102, 13623, -16069, 16069, -13623, 9102, -3196,
+};
+
+/* N = 8, inverse (transposed) */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffD8, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffD8, 8)
+#endif
+const double dct_icoeffD8[64] = {
+	0.35355339059327379, 0.49039264020161522, 0.46193976625564337, 0.41573480615127262,
+	0.35355339059327379, 0.27778511650980114, 0.19134171618254492, 0.097545161008064166,
+	0.35355339059327379, 0.41573480615127262, 0.19134171618254492, -0.097545161008064096,
+	-0.35355339059327373, -0.49039264020161522, -0.46193976625564342, -0.27778511650980109,
+	0.35355339059327379, 0.27778511650980114, -0.19134171618254486, -0.49039264020161522,
+	-0.35355339059327384, 0.097545161008064152, 0.46193976625564326, 0.41573480615127273,
+	0.35355339059327379, 0.097545161008064166, -0.46193976625564337, -0.27778511650980109,
+	0.35355339059327368, 0.41573480615127273, -0.19134171618254495, -0.49039264020161533,
+	0.35355339059327379, -0.097545161008064096, -0.46193976625564342, 0.27778511650980092,
+	0.35355339059327384, -0.41573480615127256, -0.19134171618254528, 0.49039264020161522,
+	0.35355339059327379, -0.27778511650980098, -0.19134171618254517, 0.49039264020161522,
+	-0.35355339059327334, -0.097545161008064013, 0.46193976625564337, -0.41573480615127251,
+	0.35355339059327379, -0.41573480615127267, 0.191341716182545, 0.097545161008064388,
+	-0.35355339059327356, 0.49039264020161533, -0.4619397662556432, 0.27778511650980076,
+	0.35355339059327379, -0.49039264020161522, 0.46193976625564326, -0.41573480615127256,
+	0.35355339059327329, -0.27778511650980076, 0.19134171618254478, -0.097545161008064291,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffF8, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffF8, 8)
+#endif
+const float dct_icoeffF8[64] = {
+	0.353553385f, 0.490392625f, 0.461939752f, 0.415734798f,
+	0.353553385f, 0.277785122f, 0.191341713f, 0.0975451618f,
+	0.353553385f, 0.415734798f, 0.191341713f, -0.0975451618f,
+	-0.353553385f, -0.490392625f, -0.461939752f, -0.277785122f,
+	0.353553385f, 0.277785122f, -0.191341713f, -0.490392625f,
+	-0.353553385f, 0.0975451618f, 0.461939752f, 0.415734798f,
+	0.353553385f, 0.0975451618f, -0.461939752f, -0.277785122f,
+	0.353553385f, 0.415734798f, -0.191341713f, -0.490392625f,
+	0.353553385f, -0.0975451618f, -0.461939752f, 0.277785122f,
+	0.353553385f, -0.415734798f, -0.191341713f, 0.490392625f,
+	0.353553385f, -0.277785122f, -0.191341713f, 0.490392625f,
+	-0.353553385f, -0.0975451618f, 0.461939752f, -0.415734798f,
+	0.353553385f, -0.415734798f, 0.191341713f, 0.0975451618f,
+	-0.353553385f, 0.490392625f, -0.461939752f, 0.277785122f,
+	0.353553385f, -0.490392625f, 0.461939752f, -0.415734798f,
+	0.353553385f, -0.277785122f, 0.191341713f, -0.0975451618f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffQ15_8, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffQ15_8, 8)
+#endif
+const short dct_icoeffQ15_8[64] = {
+	11585, 16069, 15137, 13623, 11585, 9102, 6270, 3196,
+	11585, 13623, 6270, -3196, -11585, -16069, -15137, -9102,
+	11585, 9102, -6270, -16069, -11585, 3196, 15137, 13623,
+	11585, 3196, -15137, -9102, 11585, 13623, -6270, -16069,
+	11585, -3196, -15137, 9102, 11585, -13623, -6270, 16069,
+	11585, -9102, -6270, 16069, -11585, -3196, 15137, -13623,
+	11585, -13623, 6270, 3196, -11585, 16069, -15137, 9102,
+	11585, -16069, 15137, -13623, 11585, -9102, 6270, -3196,
+};
+
+/* N = 16 */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffD16, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffD16, 8)
+#endif
+const double dct_coeffD16[256] = {
+	0.25, 0.25, 0.25, 0.25,
+	0.25, 0.25, 0.25, 0.25,
+	0.25, 0.25, 0.25, 0.25,
+	0.25, 0.25, 0.25, 0.25,
+	0.35185093438159565, 0.33832950029358816, 0.31180625324666783, 0.2733004667504394,
+	0.2242918965856591, 0.16666391461943669, 0.10263113188058934, 0.034654292299772925,
+	-0.034654292299772883, -0.10263113188058928, -0.16666391461943666, -0.22429189658565904,
+	-0.2733004667504394, -0.31180625324666777, -0.33832950029358816, -0.35185093438159559,
+	0.34675996133053688, 0.29396890060483971, 0.19642373959677559, 0.068974844820735778,
+	-0.068974844820735737, -0.19642373959677548, -0.29396890060483971, -0.34675996133053688,
+	-0.34675996133053688, -0.29396890060483977, -0.19642373959677553, -0.068974844820735903,
+	0.068974844820735765, 0.19642373959677542, 0.29396890060483971, 0.34675996133053683,
+	0.33832950029358816, 0.2242918965856591, 0.034654292299772925, -0.16666391461943666,
+	-0.31180625324666777, -0.35185093438159565, -0.27330046675043945, -0.10263113188058938,
+	0.10263113188058924, 0.27330046675043929, 0.35185093438159565, 0.31180625324666783,
+	0.16666391461943675, -0.03465429229977264, -0.22429189658565885, -0.33832950029358805,
+	0.32664074121909414, 0.13529902503654928, -0.13529902503654925, -0.32664074121909414,
+	-0.3266407412190942, -0.13529902503654945, 0.13529902503654934, 0.32664074121909409,
+	0.32664074121909414, 0.1352990250365495, -0.13529902503654931, -0.32664074121909403,
+	-0.32664074121909414, -0.13529902503654953, 0.13529902503654925, 0.32664074121909403,
+	0.31180625324666783, 0.034654292299772925, -0.2733004667504394, -0.33832950029358821,
+	-0.10263113188058938, 0.22429189658565912, 0.35185093438159565, 0.16666391461943675,
+	-0.16666391461943658, -0.35185093438159565, -0.22429189658565904, 0.10263113188058946,
+	0.33832950029358805, 0.27330046675043962, -0.034654292299772557, -0.31180625324666772,
+	0.29396890060483971, -0.068974844820735737, -0.34675996133053688, -0.19642373959677553,
+	0.19642373959677542, 0.34675996133053688, 0.068974844820735931, -0.29396890060483966,
+	-0.29396890060483982, 0.068974844820735376, 0.34675996133053688, 0.19642373959677567,
+	-0.19642373959677531, -0.34675996133053694, -0.068974844820736375, 0.29396890060483927,
+	0.2733004667504394, -0.16666391461943666, -0.33832950029358821, 0.034654292299772689,
+	0.35185093438159565, 0.10263113188058942, -0.31180625324666777, -0.22429189658565904,
+	0.22429189658565882, 0.31180625324666794, -0.10263113188058942, -0.35185093438159565,
+	-0.034654292299773612, 0.33832950029358821, 0.16666391461943691, -0.27330046675043895,
+	0.25000000000000006, -0.25, -0.25000000000000006, 0.24999999999999994,
+	0.25000000000000006, -0.24999999999999972, -0.24999999999999989, 0.24999999999999969,
+	0.24999999999999992, -0.24999999999999964, -0.24999999999999994, 0.24999999999999961,
+	0.25, -0.24999999999999961, -0.25000000000000006, 0.24999999999999956,
+	0.2242918965856591, -0.31180625324666777, -0.10263113188058938, 0.35185093438159565,
+	-0.03465429229977264, -0.33832950029358816, 0.16666391461943653, 0.27330046675043962,
+	-0.2733004667504394, -0.16666391461943686, 0.33832950029358821, 0.034654292299773654,
+	-0.3518509343815957, 0.1026311318805893, 0.31180625324666827, -0.22429189658565865,
+	0.19642373959677559, -0.34675996133053688, 0.068974844820735765, 0.29396890060483977,
+	-0.29396890060483966, -0.068974844820735667, 0.34675996133053694, -0.19642373959677531,
+	-0.1964237395967757, 0.34675996133053688, -0.068974844820735862, -0.2939689006048396,
+	0.29396890060483921, 0.0689748448207365, -0.34675996133053699, 0.19642373959677514,
+	0.16666391461943669, -0.35185093438159565, 0.22429189658565912, 0.10263113188058942,
+	-0.33832950029358816, 0.2733004667504394, 0.034654292299772939, -0.31180625324666822,
+	0.311806253246668, -0.034654292299773092, -0.27330046675043934, 0.33832950029358816,
+	-0.10263113188058925, -0.22429189658565923, 0.35185093438159559, -0.16666391461943517,
+	0.13529902503654928, -0.3266407412190942, 0.32664074121909409, -0.13529902503654931,
+	-0.13529902503654953, 0.32664074121909414, -0.32664074121909403, 0.13529902503654917,
+	0.13529902503654964, -0.32664074121909448, 0.3266407412190942, -0.13529902503654906,
+	-0.13529902503654978, 0.32664074121909448, -0.3266407412190937, 0.13529902503654775,
+	0.10263113188058934, -0.27330046675043945, 0.35185093438159565, -0.31180625324666777,
+	0.16666391461943653, 0.034654292299772939, -0.22429189658565912, 0.33832950029358838,
+	-0.33832950029358821, 0.22429189658565868, -0.034654292299773008, -0.16666391461943703,
+	0.31180625324666833, -0.35185093438159559, 0.27330046675043879, -0.10263113188058788,
+	0.068974844820735778, -0.19642373959677553, 0.29396890060483977, -0.34675996133053694,
+	0.34675996133053688, -0.2939689006048396, 0.19642373959677531, -0.068974844820735862,
+	-0.068974844820736458, 0.19642373959677578, -0.2939689006048396, 0.34675996133053705,
+	-0.3467599613305366, 0.29396890060483982, -0.19642373959677503, 0.068974844820734335,
+	0.034654292299772925, -0.10263113188058938, 0.16666391461943675, -0.22429189658565904,
+	0.27330046675043962, -0.31180625324666822, 0.33832950029358838, -0.3518509343815957,
+	0.35185093438159559, -0.33832950029358816, 0.31180625324666794, -0.27330046675043962,
+	0.22429189658565854, -0.16666391461943508, 0.10263113188058905, -0.034654292299771502,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffF16, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffF16, 8)
+#endif
+const float dct_coeffF16[256] = {
+	0.25f, 0.25f, 0.25f, 0.25f,
+	0.25f, 0.25f, 0.25f, 0.25f,
+	0.25f, 0.25f, 0.25f, 0.25f,
+	0.25f, 0.25f, 0.25f, 0.25f,
+	0.351850927f, 0.338329494f, 0.311806262f, 0.273300469f,
+	0.224291891f, 0.166663915f, 0.102631129f, 0.0346542932f,
+	-0.0346542932f, -0.102631129f, -0.166663915f, -0.224291891f,
+	-0.273300469f, -0.311806262f, -0.338329494f, -0.351850927f,
+	0.346759975f, 0.293968886f, 0.196423739f, 0.0689748451f,
+	-0.0689748451f, -0.196423739f, -0.293968886f, -0.346759975f,
+	-0.346759975f, -0.293968886f, -0.196423739f, -0.0689748451f,
+	0.0689748451f, 0.196423739f, 0.293968886f, 0.346759975f,
+	0.338329494f, 0.224291891f, 0.0346542932f, -0.166663915f,
+	-0.311806262f, -0.351850927f, -0.273300469f, -0.102631129f,
+	0.102631129f, 0.273300469f, 0.351850927f, 0.311806262f,
+	0.166663915f, -0.0346542932f, -0.224291891f, -0.338329494f,
+	0.326640755f, 0.135299027f, -0.135299027f, -0.326640755f,
+	-0.326640755f, -0.135299027f, 0.135299027f, 0.326640755f,
+	0.326640755f, 0.135299027f, -0.135299027f, -0.326640755f,
+	-0.326640755f, -0.135299027f, 0.135299027f, 0.326640755f,
+	0.311806262f, 0.0346542932f, -0.273300469f, -0.338329494f,
+	-0.102631129f, 0.224291891f, 0.351850927f, 0.166663915f,
+	-0.166663915f, -0.351850927f, -0.224291891f, 0.102631129f,
+	0.338329494f, 0.273300469f, -0.0346542932f, -0.311806262f,
+	0.293968886f, -0.0689748451f, -0.346759975f, -0.196423739f,
+	0.196423739f, 0.346759975f, 0.0689748451f, -0.293968886f,
+	-0.293968886f, 0.0689748451f, 0.346759975f, 0.196423739f,
+	-0.196423739f, -0.346759975f, -0.0689748451f, 0.293968886f,
+	0.273300469f, -0.166663915f, -0.338329494f, 0.0346542932f,
+	0.351850927f, 0.102631129f, -0.311806262f, -0.224291891f,
+	0.224291891f, 0.311806262f, -0.102631129f, -0.351850927f,
+	-0.0346542932f, 0.338329494f, 0.166663915f, -0.273300469f,
+	0.25f, -0.25f, -0.25f, 0.25f,
+	0.25f, -0.25f, -0.25f, 0.25f,
+	0.25f, -0.25f, -0.25f, 0.25f,
+	0.25f, -0.25f, -0.25f, 0.25f,
+	0.224291891f, -0.311806262f, -0.102631129f, 0.351850927f,
+	-0.0346542932f, -0.338329494f, 0.166663915f, 0.273300469f,
+	-0.273300469f, -0.166663915f, 0.338329494f, 0.0346542932f,
+	-0.351850927f, 0.102631129f, 0.311806262f, -0.224291891f,
+	0.196423739f, -0.346759975f, 0.0689748451f, 0.293968886f,
+	-0.293968886f, -0.0689748451f, 0.346759975f, -0.196423739f,
+	-0.196423739f, 0.346759975f, -0.0689748451f, -0.293968886f,
+	0.293968886f, 0.0689748451f, -0.346759975f, 0.196423739f,
+	0.166663915f, -0.351850927f, 0.224291891f, 0.102631129f,
+	-0.338329494f, 0.273300469f, 0.0346542932f, -0.311806262f,
+	0.311806262f, -0.0346542932f, -0.273300469f, 0.338329494f,
+	-0.102631129f, -0.224291891f, 0.351850927f, -0.166663915f,
+	0.135299027f, -0.326640755f, 0.326640755f, -0.135299027f,
+	-0.135299027f, 0.326640755f, -0.326640755f, 0.135299027f,
+	0.135299027f, -0.326640755f, 0.326640755f, -0.135299027f,
+	-0.135299027f, 0.326640755f, -0.326640755f, 0.135299027f,
+	0.102631129f, -0.273300469f, 0.351850927f, -0.311806262f,
+	0.166663915f, 0.0346542932f, -0.224291891f, 0.338329494f,
+	-0.338329494f, 0.224291891f, -0.0346542932f, -0.166663915f,
+	0.311806262f, -0.351850927f, 0.273300469f, -0.102631129f,
+	0.0689748451f, -0.196423739f, 0.293968886f, -0.346759975f,
+	0.346759975f, -0.293968886f, 0.196423739f, -0.0689748451f,
+	-0.0689748451f, 0.196423739f, -0.293968886f, 0.346759975f,
+	-0.346759975f, 0.293968886f, -0.196423739f, 0.0689748451f,
+	0.0346542932f, -0.102631129f, 0.166663915f, -0.224291891f,
+	0.273300469f, -0.311806262f, 0.338329494f, -0.351850927f,
+	0.351850927f, -0.338329494f, 0.311806262f, -0.273300469f,
+	0.224291891f, -0.166663915f, 0.102631129f, -0.0346542932f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffQ15_16, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffQ15_16, 8)
+#endif
+const short dct_coeffQ15_16[256] = {
+	8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+	8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+	11529, 11086, 10217, 8956, 7350, 5461, 3363, 1136,
+	-1136, -3363, -5461, -7350, -8956, -10217, -11086, -11529,
+	11363, 9633, 6436, 2260, -2260, -6436, -9633, -11363,
+	-11363, -9633, -6436, -2260, 2260, 6436, 9633, 11363,
+	11086, 7350, 1136, -5461, -10217, -11529, -8956, -3363,
+	3363, 8956, 11529, 10217, 5461, -1136, -7350, -11086,
+	10703, 4433, -4433, -10703, -10703, -4433, 4433, 10703,
+	10703, 4433, -4433, -10703, -10703, -4433, 4433, 10703,
+	10217, 1136, -8956, -11086, -3363, 7350, 11529, 5461,
+	-5461, -11529, -7350, 3363, 11086, 8956, -1136, -10217,
+	9633, -2260, -11363, -6436, 6436, 11363, 2260, -9633,
+	-9633, 2260, 11363, 6436, -6436, -11363, -2260, 9633,
+	8956, -5461, -11086, 1136, 11529, 3363, -10217, -7350,
+	7350, 10217, -3363, -11529, -1136, 11086, 5461, -8956,
+	8192, -8192, -8192, 8192, 8192, -8192, -8192, 8192,
+	8192, -8192, -8192, 8192, 8192, -8192, -8192, 8192,
+	7350, -10217, -3363, 11529, -1136, -11086, 5461, 8956,
+	-8956, -5461, 11086, 1136, -11529, 3363, 10217, -7350,
+	6436, -11363, 2260, 9633, -9633, -2260, 11363, -6436,
+	-6436, 11363, -2260, -9633, 9633, 2260, -11363, 6436,
+	5461, -11529, 7350, 3363, -11086, 8956, 1136, -10217,
+	10217, -1136, -8956, 11086, -3363, -7350, 11529, -5461,
+	4433, -10703, 10703, -4433, -4433, 10703, -10703, 4433,
+	4433, -10703, 10703, -4433, -4433, 10703, -10703, 4433,
+	3363, -8956, 11529, -10217, 5461, 1136, -7350, 11086,
+	-11086, 7350, -1136, -5461, 10217, -11529, 8956, -3363,
+	2260, -6436, 9633, -11363, 11363, -9633, 6436, -2260,
+	-2260, 6436, -9633, 11363, -11363, 9633, -6436, 2260,
+	1136, -3363, 5461, -7350, 8956, -10217, 11086, -11529,
+	11529, -11086, 10217, -8956, 7350, -5461, 3363, -1136,
+};
+
+/* N = 16, inverse (transposed) */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffD16, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffD16, 8)
+#endif
+const double dct_icoeffD16[256] = {
+	0.25, 0.35185093438159565, 0.34675996133053688, 0.33832950029358816,
+	0.32664074121909414, 0.31180625324666783, 0.29396890060483971, 0.2733004667504394,
+	0.25000000000000006, 0.2242918965856591, 0.19642373959677559, 0.16666391461943669,
+	0.13529902503654928, 0.10263113188058934, 0.068974844820735778, 0.034654292299772925,
+	0.25, 0.33832950029358816, 0.29396890060483971, 0.2242918965856591,
+	0.13529902503654928, 0.034654292299772925, -0.068974844820735737, -0.16666391461943666,
+	-0.25, -0.31180625324666777, -0.34675996133053688, -0.35185093438159565,
+	-0.3266407412190942, -0.27330046675043945, -0.19642373959677553, -0.10263113188058938,
+	0.25, 0.31180625324666783, 0.19642373959677559, 0.034654292299772925,
+	-0.13529902503654925, -0.2733004667504394, -0.34675996133053688, -0.33832950029358821,
+	-0.25000000000000006, -0.10263113188058938, 0.068974844820735765, 0.22429189658565912,
+	0.32664074121909409, 0.35185093438159565, 0.29396890060483977, 0.16666391461943675,
+	0.25, 0.2733004667504394, 0.068974844820735778, -0.16666391461943666,
+	-0.32664074121909414, -0.33832950029358821, -0.19642373959677553, 0.034654292299772689,
+	0.24999999999999994, 0.35185093438159565, 0.29396890060483977, 0.10263113188058942,
+	-0.13529902503654931, -0.31180625324666777, -0.34675996133053694, -0.22429189658565904,
+	0.25, 0.2242918965856591, -0.068974844820735737, -0.31180625324666777,
+	-0.3266407412190942, -0.10263113188058938, 0.19642373959677542, 0.35185093438159565,
+	0.25000000000000006, -0.03465429229977264, -0.29396890060483966, -0.33832950029358816,
+	-0.13529902503654953, 0.16666391461943653, 0.34675996133053688, 0.27330046675043962,
+	0.25, 0.16666391461943669, -0.19642373959677548, -0.35185093438159565,
+	-0.13529902503654945, 0.22429189658565912, 0.34675996133053688, 0.10263113188058942,
+	-0.24999999999999972, -0.33832950029358816, -0.068974844820735667, 0.2733004667504394,
+	0.32664074121909414, 0.034654292299772939, -0.2939689006048396, -0.31180625324666822,
+	0.25, 0.10263113188058934, -0.29396890060483971, -0.27330046675043945,
+	0.13529902503654934, 0.35185093438159565, 0.068974844820735931, -0.31180625324666777,
+	-0.24999999999999989, 0.16666391461943653, 0.34675996133053694, 0.034654292299772939,
+	-0.32664074121909403, -0.22429189658565912, 0.19642373959677531, 0.33832950029358838,
+	0.25, 0.034654292299772925, -0.34675996133053688, -0.10263113188058938,
+	0.32664074121909409, 0.16666391461943675, -0.29396890060483966, -0.22429189658565904,
+	0.24999999999999969, 0.27330046675043962, -0.19642373959677531, -0.31180625324666822,
+	0.13529902503654917, 0.33832950029358838, -0.068974844820735862, -0.3518509343815957,
+	0.25, -0.034654292299772883, -0.34675996133053688, 0.10263113188058924,
+	0.32664074121909414, -0.16666391461943658, -0.29396890060483982, 0.22429189658565882,
+	0.24999999999999992, -0.2733004667504394, -0.1964237395967757, 0.311806253246668,
+	0.13529902503654964, -0.33832950029358821, -0.068974844820736458, 0.35185093438159559,
+	0.25, -0.10263113188058928, -0.29396890060483977, 0.27330046675043929,
+	0.1352990250365495, -0.35185093438159565, 0.068974844820735376, 0.31180625324666794,
+	-0.24999999999999964, -0.16666391461943686, 0.34675996133053688, -0.034654292299773092,
+	-0.32664074121909448, 0.22429189658565868, 0.19642373959677578, -0.33832950029358816,
+	0.25, -0.16666391461943666, -0.19642373959677553, 0.35185093438159565,
+	-0.13529902503654931, -0.22429189658565904, 0.34675996133053688, -0.10263113188058942,
+	-0.24999999999999994, 0.33832950029358821, -0.068974844820735862, -0.27330046675043934,
+	0.3266407412190942, -0.034654292299773008, -0.2939689006048396, 0.31180625324666794,
+	0.25, -0.22429189658565904, -0.068974844820735903, 0.31180625324666783,
+	-0.32664074121909403, 0.10263113188058946, 0.19642373959677567, -0.35185093438159565,
+	0.24999999999999961, 0.034654292299773654, -0.2939689006048396, 0.33832950029358816,
+	-0.13529902503654906, -0.16666391461943703, 0.34675996133053705, -0.27330046675043962,
+	0.25, -0.2733004667504394, 0.068974844820735765, 0.16666391461943675,
+	-0.32664074121909414, 0.33832950029358805, -0.19642373959677531, -0.034654292299773612,
+	0.25, -0.3518509343815957, 0.29396890060483921, -0.10263113188058925,
+	-0.13529902503654978, 0.31180625324666833, -0.3467599613305366, 0.22429189658565854,
+	0.25, -0.31180625324666777, 0.19642373959677542, -0.03465429229977264,
+	-0.13529902503654953, 0.27330046675043962, -0.34675996133053694, 0.33832950029358821,
+	-0.24999999999999961, 0.1026311318805893, 0.0689748448207365, -0.22429189658565923,
+	0.32664074121909448, -0.35185093438159559, 0.29396890060483982, -0.16666391461943508,
+	0.25, -0.33832950029358816, 0.29396890060483971, -0.22429189658565885,
+	0.13529902503654925, -0.034654292299772557, -0.068974844820736375, 0.16666391461943691,
+	-0.25000000000000006, 0.31180625324666827, -0.34675996133053699, 0.35185093438159559,
+	-0.3266407412190937, 0.27330046675043879, -0.19642373959677503, 0.10263113188058905,
+	0.25, -0.35185093438159559, 0.34675996133053683, -0.33832950029358805,
+	0.32664074121909403, -0.31180625324666772, 0.29396890060483927, -0.27330046675043895,
+	0.24999999999999956, -0.22429189658565865, 0.19642373959677514, -0.16666391461943517,
+	0.13529902503654775, -0.10263113188058788, 0.068974844820734335, -0.034654292299771502,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffF16, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffF16, 8)
+#endif
+const float dct_icoeffF16[256] = {
+	0.25f, 0.351850927f, 0.346759975f, 0.338329494f,
+	0.326640755f, 0.311806262f, 0.293968886f, 0.273300469f,
+	0.25f, 0.224291891f, 0.196423739f, 0.166663915f,
+	0.135299027f, 0.102631129f, 0.0689748451f, 0.0346542932f,
+	0.25f, 0.338329494f, 0.293968886f, 0.224291891f,
+	0.135299027f, 0.0346542932f, -0.0689748451f, -0.166663915f,
+	-0.25f, -0.311806262f, -0.346759975f, -0.351850927f,
+	-0.326640755f, -0.273300469f, -0.196423739f, -0.102631129f,
+	0.25f, 0.311806262f, 0.196423739f, 0.0346542932f,
+	-0.135299027f, -0.273300469f, -0.346759975f, -0.338329494f,
+	-0.25f, -0.102631129f, 0.0689748451f, 0.224291891f,
+	0.326640755f, 0.351850927f, 0.293968886f, 0.166663915f,
+	0.25f, 0.273300469f, 0.0689748451f, -0.166663915f,
+	-0.326640755f, -0.338329494f, -0.196423739f, 0.0346542932f,
+	0.25f, 0.351850927f, 0.293968886f, 0.102631129f,
+	-0.135299027f, -0.311806262f, -0.346759975f, -0.224291891f,
+	0.25f, 0.224291891f, -0.0689748451f, -0.311806262f,
+	-0.326640755f, -0.102631129f, 0.196423739f, 0.351850927f,
+	0.25f, -0.0346542932f, -0.293968886f, -0.338329494f,
+	-0.135299027f, 0.166663915f, 0.346759975f, 0.273300469f,
+	0.25f, 0.166663915f, -0.196423739f, -0.351850927f,
+	-0.135299027f, 0.224291891f, 0.346759975f, 0.102631129f,
+	-0.25f, -0.338329494f, -0.0689748451f, 0.273300469f,
+	0.326640755f, 0.0346542932f, -0.293968886f, -0.311806262f,
+	0.25f, 0.102631129f, -0.293968886f, -0.273300469f,
+	0.135299027f, 0.351850927f, 0.0689748451f, -0.311806262f,
+	-0.25f, 0.166663915f, 0.346759975f, 0.0346542932f,
+	-0.326640755f, -0.224291891f, 0.196423739f, 0.338329494f,
+	0.25f, 0.0346542932f, -0.346759975f, -0.102631129f,
+	0.326640755f, 0.166663915f, -0.293968886f, -0.224291891f,
+	0.25f, 0.273300469f, -0.196423739f, -0.311806262f,
+	0.135299027f, 0.338329494f, -0.0689748451f, -0.351850927f,
+	0.25f, -0.0346542932f, -0.346759975f, 0.102631129f,
+	0.326640755f, -0.166663915f, -0.293968886f, 0.224291891f,
+	0.25f, -0.273300469f, -0.196423739f, 0.311806262f,
+	0.135299027f, -0.338329494f, -0.0689748451f, 0.351850927f,
+	0.25f, -0.102631129f, -0.293968886f, 0.273300469f,
+	0.135299027f, -0.351850927f, 0.0689748451f, 0.311806262f,
+	-0.25f, -0.166663915f, 0.346759975f, -0.0346542932f,
+	-0.326640755f, 0.224291891f, 0.196423739f, -0.338329494f,
+	0.25f, -0.166663915f, -0.196423739f, 0.351850927f,
+	-0.135299027f, -0.224291891f, 0.346759975f, -0.102631129f,
+	-0.25f, 0.338329494f, -0.0689748451f, -0.273300469f,
+	0.326640755f, -0.0346542932f, -0.293968886f, 0.311806262f,
+	0.25f, -0.224291891f, -0.0689748451f, 0.311806262f,
+	-0.326640755f, 0.102631129f, 0.196423739f, -0.351850927f,
+	0.25f, 0.0346542932f, -0.293968886f, 0.338329494f,
+	-0.135299027f, -0.166663915f, 0.346759975f, -0.273300469f,
+	0.25f, -0.273300469f, 0.0689748451f, 0.166663915f,
+	-0.326640755f, 0.338329494f, -0.196423739f, -0.0346542932f,
+	0.25f, -0.351850927f, 0.293968886f, -0.102631129f,
+	-0.135299027f, 0.311806262f, -0.346759975f, 0.224291891f,
+	0.25f, -0.311806262f, 0.196423739f, -0.0346542932f,
+	-0.135299027f, 0.273300469f, -0.346759975f, 0.338329494f,
+	-0.25f, 0.102631129f, 0.0689748451f, -0.224291891f,
+	0.326640755f, -0.351850927f, 0.293968886f, -0.166663915f,
+	0.25f, -0.338329494f, 0.293968886f, -0.224291891f,
+	0.135299027f, -0.0346542932f, -0.0689748451f, 0.166663915f,
+	-0.25f, 0.311806262f, -0.346759975f, 0.351850927f,
+	-0.326640755f, 0.273300469f, -0.196423739f, 0.102631129f,
+	0.25f, -0.351850927f, 0.346759975f, -0.338329494f,
+	0.326640755f, -0.311806262f, 0.293968886f, -0.273300469f,
+	0.25f, -0.224291891f, 0.196423739f, -0.166663915f,
+	0.135299027f, -0.102631129f, 0.0689748451f, -0.0346542932f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffQ15_16, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffQ15_16, 8)
+#endif
+const short dct_icoeffQ15_16[256] = {
+	8192, 11529, 11363, 11086, 10703, 10217, 9633, 8956,
+	8192, 7350, 6436, 5461, 4433, 3363, 2260, 1136,
+	8192, 11086, 9633, 7350, 4433, 1136, -2260, -5461,
+	-8192, -10217, -11363, -11529, -10703, -8956, -6436, -3363,
+	8192, 10217, 6436, 1136, -4433, -8956, -11363, -11086,
+	-8192, -3363, 2260, 7350, 10703, 11529, 9633, 5461,
+	8192, 8956, 2260, -5461, -10703, -11086, -6436, 1136,
+	8192, 11529, 9633, 3363, -4433, -10217, -11363, -7350,
+	8192, 7350, -2260, -10217, -10703, -3363, 6436, 11529,
+	8192, -1136, -9633, -11086, -4433, 5461, 11363, 8956,
+	8192, 5461, -6436, -11529, -4433, 7350, 11363, 3363,
+	-8192, -11086, -2260, 8956, 10703, 1136, -9633, -10217,
+	8192, 3363, -9633, -8956, 4433, 11529, 2260, -10217,
+	-8192, 5461, 11363, 1136, -10703, -7350, 6436, 11086,
+	8192, 1136, -11363, -3363, 10703, 5461, -9633, -7350,
+	8192, 8956, -6436, -10217, 4433, 11086, -2260, -11529,
+	8192, -1136, -11363, 3363, 10703, -5461, -9633, 7350,
+	8192, -8956, -6436, 10217, 4433, -11086, -2260, 11529,
+	8192, -3363, -9633, 8956, 4433, -11529, 2260, 10217,
+	-8192, -5461, 11363, -1136, -10703, 7350, 6436, -11086,
+	8192, -5461, -6436, 11529, -4433, -7350, 11363, -3363,
+	-8192, 11086, -2260, -8956, 10703, -1136, -9633, 10217,
+	8192, -7350, -2260, 10217, -10703, 3363, 6436, -11529,
+	8192, 1136, -9633, 11086, -4433, -5461, 11363, -8956,
+	8192, -8956, 2260, 5461, -10703, 11086, -6436, -1136,
+	8192, -11529, 9633, -3363, -4433, 10217, -11363, 7350,
+	8192, -10217, 6436, -1136, -4433, 8956, -11363, 11086,
+	-8192, 3363, 2260, -7350, 10703, -11529, 9633, -5461,
+	8192, -11086, 9633, -7350, 4433, -1136, -2260, 5461,
+	-8192, 10217, -11363, 11529, -10703, 8956, -6436, 3363,
+	8192, -11529, 11363, -11086, 10703, -10217, 9633, -8956,
+	8192, -7350, 6436, -5461, 4433, -3363, 2260, -1136,
+};
+
+/* N = 32 */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffD32, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffD32, 8)
+#endif
+const double dct_coeffD32[1024] = {
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.17677669529663689, 0.17677669529663689, 0.17677669529663689, 0.17677669529663689,
+	0.2496988640512931, 0.24729412749119525, 0.24250781329863599, 0.2353860162957552,
+	0.22599732328086083, 0.21443215250006803, 0.20080188287016124, 0.18523778133873978,
+	0.16788973871175458, 0.14892482612310837, 0.12852568604830542, 0.10688877335757055,
+	0.084222463348055013, 0.060745044975815995, 0.036682618613840437, 0.012266918581854531,
+	-0.012266918581854502, -0.036682618613840409, -0.060745044975815968, -0.084222463348054985,
+	-0.10688877335757047, -0.12852568604830542, -0.14892482612310834, -0.16788973871175461,
+	-0.18523778133873972, -0.20080188287016121, -0.214432152500068, -0.22599732328086083,
+	-0.23538601629575517, -0.24250781329863599, -0.24729412749119525, -0.2496988640512931,
+	0.24879618166804923, 0.23923508393305221, 0.22048031608708876, 0.19325261334068425,
+	0.15859832104091137, 0.11784918420649945, 0.072571169313615583, 0.024504285082390193,
+	-0.024504285082390161, -0.072571169313615541, -0.11784918420649942, -0.15859832104091134,
+	-0.19325261334068425, -0.22048031608708873, -0.23923508393305221, -0.2487961816680492,
+	-0.24879618166804923, -0.23923508393305223, -0.22048031608708876, -0.19325261334068428,
+	-0.15859832104091148, -0.11784918420649947, -0.072571169313615611, -0.024504285082390113,
+	0.024504285082390023, 0.072571169313615513, 0.1178491842064994, 0.1585983210409114,
+	0.19325261334068417, 0.22048031608708871, 0.23923508393305221, 0.24879618166804923,
+	0.24729412749119525, 0.22599732328086083, 0.18523778133873978, 0.12852568604830542,
+	0.060745044975815995, -0.012266918581854502, -0.084222463348054985, -0.14892482612310834,
+	-0.20080188287016121, -0.23538601629575517, -0.2496988640512931, -0.24250781329863599,
+	-0.21443215250006803, -0.16788973871175467, -0.10688877335757062, -0.036682618613840576,
+	0.036682618613840486, 0.10688877335757054, 0.16788973871175458, 0.214432152500068,
+	0.24250781329863599, 0.2496988640512931, 0.23538601629575523, 0.20080188287016132,
+	0.14892482612310831, 0.084222463348055013, 0.012266918581854538, -0.060745044975815697,
+	-0.12852568604830536, -0.18523778133873983, -0.22599732328086078, -0.24729412749119525,
+	0.24519632010080761, 0.20786740307563631, 0.13889255825490057, 0.048772580504032083,
+	-0.048772580504032048, -0.13889255825490049, -0.20786740307563634, -0.24519632010080761,
+	-0.24519632010080761, -0.20786740307563636, -0.13889255825490054, -0.048772580504032166,
+	0.048772580504032076, 0.13889255825490046, 0.20786740307563631, 0.24519632010080758,
+	0.24519632010080761, 0.20786740307563636, 0.13889255825490057, 0.048772580504032194,
+	-0.048772580504031826, -0.13889255825490043, -0.20786740307563628, -0.24519632010080764,
+	-0.24519632010080766, -0.20786740307563639, -0.1388925582549006, -0.048772580504032007,
+	0.048772580504031798, 0.13889255825490041, 0.20786740307563628, 0.24519632010080761,
+	0.24250781329863599, 0.18523778133873978, 0.084222463348055013, -0.036682618613840409,
+	-0.14892482612310834, -0.22599732328086083, -0.2496988640512931, -0.21443215250006803,
+	-0.12852568604830544, -0.012266918581854507, 0.10688877335757054, 0.20080188287016126,
+	0.24729412749119523, 0.23538601629575523, 0.16788973871175469, 0.060745044975816058,
+	-0.060745044975815697, -0.16788973871175442, -0.23538601629575512, -0.24729412749119528,
+	-0.20080188287016135, -0.10688877335757067, 0.012266918581854355, 0.12852568604830533,
+	0.21443215250006797, 0.2496988640512931, 0.22599732328086086, 0.14892482612310837,
+	0.036682618613840451, -0.084222463348055027, -0.1852377813387398, -0.24250781329863602,
+	0.23923508393305221, 0.15859832104091137, 0.024504285082390193, -0.11784918420649942,
+	-0.22048031608708873, -0.24879618166804923, -0.19325261334068428, -0.072571169313615611,
+	0.072571169313615513, 0.19325261334068417, 0.24879618166804923, 0.22048031608708876,
+	0.11784918420649949, -0.024504285082389991, -0.15859832104091121, -0.23923508393305212,
+	-0.23923508393305218, -0.15859832104091134, -0.024504285082390172, 0.11784918420649934,
+	0.22048031608708868, 0.24879618166804923, 0.19325261334068441, 0.072571169313615902,
+	-0.072571169313615638, -0.19325261334068425, -0.2487961816680492, -0.22048031608708904,
+	-0.11784918420649958, 0.024504285082390342, 0.15859832104091112, 0.23923508393305223,
+	0.2353860162957552, 0.12852568604830542, -0.036682618613840409, -0.18523778133873972,
+	-0.2496988640512931, -0.20080188287016124, -0.06074504497581603, 0.10688877335757054,
+	0.22599732328086078, 0.24250781329863602, 0.14892482612310831, -0.012266918581854386,
+	-0.16788973871175442, -0.24729412749119525, -0.21443215250006809, -0.084222463348055249,
+	0.084222463348055054, 0.21443215250006797, 0.24729412749119528, 0.16788973871175455,
+	0.012266918581854599, -0.14892482612310814, -0.24250781329863602, -0.22599732328086086,
+	-0.10688877335757033, 0.060745044975815607, 0.20080188287016118, 0.2496988640512931,
+	0.18523778133874003, 0.036682618613840506, -0.12852568604830564, -0.23538601629575506,
+	0.23096988312782168, 0.095670858091272459, -0.095670858091272432, -0.23096988312782168,
+	-0.23096988312782171, -0.095670858091272584, 0.095670858091272501, 0.23096988312782163,
+	0.23096988312782168, 0.095670858091272612, -0.095670858091272473, -0.2309698831278216,
+	-0.23096988312782168, -0.09567085809127264, 0.095670858091272445, 0.2309698831278216,
+	0.23096988312782168, 0.095670858091272667, -0.095670858091272418, -0.2309698831278216,
+	-0.23096988312782188, -0.095670858091272695, 0.09567085809127239, 0.23096988312782174,
+	0.23096988312782188, 0.095670858091272723, -0.095670858091272362, -0.23096988312782174,
+	-0.23096988312782191, -0.095670858091272751, 0.095670858091272334, 0.23096988312782171,
+	0.22599732328086083, 0.060745044975815995, -0.14892482612310834, -0.2496988640512931,
+	-0.16788973871175467, 0.036682618613840486, 0.214432152500068, 0.23538601629575523,
+	0.084222463348055013, -0.12852568604830536, -0.24729412749119525, -0.18523778133873997,
+	0.012266918581854355, 0.20080188287016121, 0.24250781329863608, 0.1068887733575707,
+	-0.10688877335757045, -0.24250781329863602, -0.20080188287016137, -0.01226691858185463,
+	0.18523778133873978, 0.24729412749119523, 0.12852568604830597, -0.084222463348054541,
+	-0.23538601629575506, -0.21443215250006814, -0.036682618613840541, 0.16788973871175461,
+	0.2496988640512931, 0.14892482612310881, -0.060745044975815517, -0.2259973232808607,
+	0.22048031608708876, 0.024504285082390193, -0.19325261334068425, -0.23923508393305223,
+	-0.072571169313615611, 0.1585983210409114, 0.24879618166804923, 0.11784918420649949,
+	-0.11784918420649937, -0.24879618166804923, -0.15859832104091134, 0.072571169313615666,
+	0.23923508393305212, 0.19325261334068441, -0.024504285082389929, -0.22048031608708868,
+	-0.22048031608708904, -0.024504285082390675, 0.19325261334068394, 0.23923508393305234,
+	0.072571169313615971, -0.15859832104091109, -0.24879618166804926, -0.11784918420649963,
+	0.11784918420649923, 0.2487961816680492, 0.15859832104091146, -0.072571169313615527,
+	-0.23923508393305221, -0.19325261334068422, 0.02450428508239022, 0.22048031608708882,
+	0.21443215250006803, -0.012266918581854502, -0.22599732328086083, -0.20080188287016124,
+	0.036682618613840486, 0.2353860162957552, 0.1852377813387398, -0.060745044975815697,
+	-0.24250781329863602, -0.16788973871175453, 0.084222463348055054, 0.24729412749119525,
+	0.14892482612310837, -0.10688877335757045, -0.2496988640512931, -0.12852568604830594,
+	0.12852568604830567, 0.2496988640512931, 0.10688877335757035, -0.14892482612310845,
+	-0.24729412749119523, -0.084222463348054957, 0.16788973871175461, 0.24250781329863599,
+	0.060745044975816023, -0.18523778133873972, -0.23538601629575523, -0.036682618613840604,
+	0.2008018828701611, 0.22599732328086095, 0.012266918581855669, -0.21443215250006739,
+	0.20786740307563631, -0.048772580504032048, -0.24519632010080761, -0.13889255825490054,
+	0.13889255825490046, 0.24519632010080761, 0.048772580504032194, -0.20786740307563628,
+	-0.20786740307563639, 0.048772580504031798, 0.24519632010080761, 0.13889255825490063,
+	-0.13889255825490038, -0.24519632010080766, -0.048772580504032499, 0.207867403075636,
+	0.2078674030756362, -0.048772580504032145, -0.24519632010080761, -0.13889255825490068,
+	0.13889255825490032, 0.24519632010080769, 0.048772580504032589, -0.20786740307563595,
+	-0.20786740307563625, 0.048772580504032055, 0.24519632010080758, 0.13889255825490152,
+	-0.13889255825490024, -0.24519632010080752, -0.04877258050403268, 0.20786740307563639,
+	0.20080188287016124, -0.084222463348054985, -0.2496988640512931, -0.06074504497581603,
+	0.214432152500068, 0.1852377813387398, -0.10688877335757051, -0.24729412749119528,
+	-0.036682618613840416, 0.22599732328086075, 0.16788973871175455, -0.1285256860483053,
+	-0.24250781329863608, -0.01226691858185463, 0.23538601629575509, 0.14892482612310876,
+	-0.14892482612310845, -0.23538601629575523, 0.012266918581854231, 0.24250781329863588,
+	0.12852568604830603, -0.16788973871175461, -0.22599732328086092, 0.036682618613840028,
+	0.24729412749119514, 0.10688877335757127, -0.18523778133873908, -0.21443215250006775,
+	0.060745044975816287, 0.2496988640512931, 0.084222463348055096, -0.20080188287016104,
+	0.19325261334068425, -0.11784918420649942, -0.23923508393305223, 0.024504285082390023,
+	0.24879618166804923, 0.072571169313615638, -0.22048031608708871, -0.15859832104091134,
+	0.15859832104091118, 0.22048031608708882, -0.072571169313615638, -0.24879618166804923,
+	-0.024504285082390675, 0.23923508393305223, 0.1178491842064996, -0.19325261334068392,
+	-0.19325261334068419, 0.11784918420649923, 0.23923508393305237, -0.024504285082390248,
+	-0.2487961816680492, -0.072571169313616055, 0.22048031608708882, 0.15859832104091151,
+	-0.15859832104091171, -0.22048031608708912, 0.072571169313615444, 0.24879618166804918,
+	0.02450428508239089, -0.23923508393305218, -0.11784918420649901, 0.19325261334068378,
+	0.18523778133873978, -0.14892482612310834, -0.21443215250006803, 0.10688877335757054,
+	0.23538601629575523, -0.060745044975815697, -0.24729412749119528, 0.012266918581854355,
+	0.2496988640512931, 0.036682618613840451, -0.24250781329863602, -0.084222463348054888,
+	0.22599732328086072, 0.12852568604830597, -0.20080188287016115, -0.16788973871175497,
+	0.16788973871175461, 0.20080188287016143, -0.12852568604830558, -0.22599732328086092,
+	0.084222463348054458, 0.24250781329863602, -0.036682618613840874, -0.2496988640512931,
+	-0.012266918581854813, 0.24729412749119514, 0.060745044975817002, -0.23538601629575531,
+	-0.10688877335757055, 0.21443215250006781, 0.14892482612310898, -0.185237781338739,
+	0.17677669529663689, -0.17677669529663687, -0.17677669529663692, 0.17677669529663684,
+	0.17677669529663692, -0.17677669529663667, -0.17677669529663678, 0.17677669529663664,
+	0.17677669529663681, -0.17677669529663662, -0.17677669529663684, 0.17677669529663659,
+	0.17677669529663687, -0.17677669529663659, -0.17677669529663689, 0.17677669529663656,
+	0.17677669529663689, -0.17677669529663653, -0.17677669529663692, 0.1767766952966365,
+	0.17677669529663759, -0.1767766952966365, -0.17677669529663698, 0.17677669529663709,
+	0.17677669529663761, -0.17677669529663645, -0.176776695296637, 0.17677669529663706,
+	0.17677669529663767, -0.17677669529663639, -0.17677669529663706, 0.176776695296637,
+	0.16788973871175458, -0.20080188287016121, -0.12852568604830544, 0.22599732328086078,
+	0.084222463348055013, -0.24250781329863602, -0.036682618613840416, 0.2496988640512931,
+	-0.012266918581854323, -0.24729412749119528, 0.060745044975815607, 0.2353860162957552,
+	-0.10688877335757001, -0.21443215250006814, 0.14892482612310842, 0.18523778133874005,
+	-0.18523778133873972, -0.14892482612310884, 0.21443215250006786, 0.10688877335757127,
+	-0.23538601629575534, -0.060745044975816107, 0.24729412749119514, 0.01226691858185573,
+	-0.2496988640512931, 0.036682618613839903, 0.24250781329863627, -0.084222463348055152,
+	-0.225997323280861, 0.12852568604830464, 0.20080188287016104, -0.16788973871175442,
+	0.15859832104091137, -0.22048031608708873, -0.072571169313615611, 0.24879618166804923,
+	-0.024504285082389991, -0.23923508393305218, 0.11784918420649934, 0.19325261334068441,
+	-0.19325261334068425, -0.11784918420649958, 0.23923508393305223, 0.024504285082390706,
+	-0.24879618166804926, 0.072571169313615555, 0.22048031608708907, -0.15859832104091107,
+	-0.15859832104091148, 0.22048031608708882, 0.072571169313616082, -0.2487961816680492,
+	0.024504285082390158, 0.23923508393305215, -0.11784918420649831, -0.19325261334068486,
+	0.19325261334068378, 0.11784918420649983, -0.23923508393305215, -0.024504285082390095,
+	0.2487961816680492, -0.072571169313614445, -0.22048031608708921, 0.15859832104091084,
+	0.14892482612310837, -0.23538601629575517, -0.012266918581854507, 0.24250781329863602,
+	-0.12852568604830536, -0.16788973871175453, 0.22599732328086075, 0.036682618613840451,
+	-0.24729412749119528, 0.10688877335757004, 0.18523778133874003, -0.21443215250006792,
+	-0.060745044975815989, 0.2496988640512931, -0.084222463348054485, -0.20080188287016146,
+	0.2008018828701611, 0.084222463348055041, -0.24969886405129307, 0.060745044975816287,
+	0.21443215250006822, -0.18523778133873903, -0.10688877335757055, 0.24729412749119514,
+	-0.036682618613840749, -0.225997323280861, 0.16788973871175378, 0.12852568604830547,
+	-0.24250781329863583, 0.012266918581854814, 0.23538601629575534, -0.14892482612310745,
+	0.13889255825490057, -0.24519632010080761, 0.048772580504032076, 0.20786740307563636,
+	-0.20786740307563628, -0.048772580504032007, 0.24519632010080766, -0.13889255825490038,
+	-0.13889255825490066, 0.24519632010080761, -0.048772580504032145, -0.20786740307563623,
+	0.20786740307563595, 0.048772580504032589, -0.24519632010080769, 0.13889255825490027,
+	0.13889255825490152, -0.24519632010080741, 0.048772580504031118, 0.20786740307563678,
+	-0.20786740307563586, -0.048772580504032742, 0.24519632010080772, -0.13889255825490013,
+	-0.13889255825490091, 0.24519632010080755, -0.04877258050403184, -0.20786740307563639,
+	0.20786740307563628, 0.04877258050403202, -0.24519632010080758, 0.13889255825490074,
+	0.12852568604830542, -0.2496988640512931, 0.10688877335757054, 0.14892482612310831,
+	-0.24729412749119525, 0.084222463348055054, 0.16788973871175455, -0.24250781329863602,
+	0.060745044975815607, 0.18523778133874003, -0.23538601629575506, 0.036682618613840083,
+	0.20080188287016143, -0.2259973232808607, 0.012266918581854171, 0.2144321525000682,
+	-0.21443215250006739, -0.012266918581854813, 0.22599732328086133, -0.20080188287016104,
+	-0.036682618613841603, 0.23538601629575528, -0.185237781338739, -0.060745044975816231,
+	0.24250781329863627, -0.16788973871175442, -0.084222463348056081, 0.24729412749119528,
+	-0.14892482612310745, -0.10688877335757072, 0.24969886405129316, -0.12852568604830372,
+	0.11784918420649945, -0.24879618166804923, 0.1585983210409114, 0.072571169313615638,
+	-0.23923508393305218, 0.19325261334068425, 0.024504285082390203, -0.22048031608708904,
+	0.22048031608708887, -0.024504285082390311, -0.19325261334068419, 0.23923508393305221,
+	-0.072571169313615527, -0.15859832104091148, 0.2487961816680492, -0.11784918420649837,
+	-0.11784918420649897, 0.24879618166804918, -0.15859832104091165, -0.072571169313615319,
+	0.23923508393305215, -0.19325261334068433, -0.024504285082390095, 0.22048031608708876,
+	-0.22048031608708871, 0.024504285082389974, 0.19325261334068439, -0.23923508393305212,
+	0.072571169313615208, 0.15859832104091176, -0.24879618166804898, 0.11784918420649729,
+	0.10688877335757055, -0.24250781329863599, 0.20080188287016126, -0.012266918581854386,
+	-0.18523778133873997, 0.24729412749119525, -0.1285256860483053, -0.084222463348054888,
+	0.2353860162957552, -0.21443215250006792, 0.036682618613840083, 0.16788973871175497,
+	-0.24969886405129307, 0.14892482612310837, 0.060745044975816939, -0.22599732328086095,
+	0.22599732328086103, -0.060745044975815399, -0.14892482612310823, 0.24969886405129316,
+	-0.16788973871175447, -0.036682618613841658, 0.21443215250006828, -0.23538601629575526,
+	0.084222463348054236, 0.12852568604830553, -0.24729412749119542, 0.1852377813387395,
+	0.012266918581854202, -0.20080188287016168, 0.24250781329863555, -0.10688877335757116,
+	0.095670858091272459, -0.23096988312782171, 0.23096988312782163, -0.095670858091272473,
+	-0.09567085809127264, 0.23096988312782168, -0.2309698831278216, 0.09567085809127239,
+	0.095670858091272723, -0.23096988312782191, 0.23096988312782171, -0.095670858091272307,
+	-0.095670858091272806, 0.23096988312782193, -0.23096988312782135, 0.095670858091271391,
+	0.095670858091272071, -0.23096988312782163, 0.23096988312782166, -0.095670858091272126,
+	-0.095670858091272987, 0.23096988312782202, -0.23096988312782127, 0.095670858091271224,
+	0.095670858091272251, -0.23096988312782171, 0.23096988312782157, -0.095670858091270322,
+	-0.095670858091273153, 0.23096988312782141, -0.23096988312782121, 0.095670858091272695,
+	0.084222463348055013, -0.21443215250006803, 0.24729412749119523, -0.16788973871175442,
+	0.012266918581854355, 0.14892482612310837, -0.24250781329863608, 0.22599732328086072,
+	-0.10688877335757001, -0.060745044975815989, 0.20080188287016143, -0.24969886405129307,
+	0.18523778133873969, -0.036682618613840874, -0.12852568604830611, 0.23538601629575526,
+	-0.23538601629575531, 0.12852568604830469, 0.036682618613840749, -0.18523778133873961,
+	0.24969886405129316, -0.20080188287016099, 0.060745044975816107, 0.10688877335757149,
+	-0.22599732328086106, 0.24250781329863602, -0.14892482612310881, -0.012266918581856892,
+	0.16788973871175597, -0.24729412749119542, 0.21443215250006764, -0.08422246334805486,
+	0.072571169313615583, -0.19325261334068428, 0.24879618166804923, -0.22048031608708871,
+	0.11784918420649934, 0.024504285082390203, -0.1585983210409114, 0.23923508393305234,
+	-0.23923508393305223, 0.15859832104091109, -0.024504285082390248, -0.11784918420649969,
+	0.2204803160870891, -0.2487961816680492, 0.1932526133406838, -0.072571169313614556,
+	-0.072571169313615319, 0.19325261334068433, -0.24879618166804929, 0.22048031608708832,
+	-0.1178491842064982, -0.024504285082390158, 0.15859832104091171, -0.23923508393305246,
+	0.23923508393305185, -0.1585983210409101, 0.024504285082388087, 0.11784918420649847,
+	-0.22048031608708846, 0.24879618166804923, -0.19325261334068414, 0.072571169313615028,
+	0.060745044975815995, -0.16788973871175467, 0.23538601629575523, -0.24729412749119525,
+	0.20080188287016121, -0.10688877335757045, -0.01226691858185463, 0.12852568604830597,
+	-0.21443215250006814, 0.2496988640512931, -0.2259973232808607, 0.14892482612310837,
+	-0.036682618613840874, -0.084222463348055901, 0.18523778133874014, -0.24250781329863605,
+	0.24250781329863605, -0.185237781338739, 0.084222463348054291, 0.036682618613840812,
+	-0.14892482612310834, 0.22599732328086142, -0.24969886405129305, 0.21443215250006772,
+	-0.12852568604830372, 0.012266918581854691, 0.1068887733575716, -0.20080188287016065,
+	0.24729412749119531, -0.23538601629575459, 0.16788973871175486, -0.060745044975814982,
+	0.048772580504032083, -0.13889255825490054, 0.20786740307563636, -0.24519632010080766,
+	0.24519632010080761, -0.20786740307563625, 0.13889255825490038, -0.048772580504032145,
+	-0.048772580504032562, 0.13889255825490071, -0.20786740307563625, 0.24519632010080772,
+	-0.24519632010080741, 0.20786740307563639, -0.13889255825490018, 0.048772580504031063,
+	0.048772580504031902, -0.13889255825490091, 0.20786740307563686, -0.24519632010080758,
+	0.24519632010080752, -0.20786740307563578, 0.13889255825490074, -0.048772580504031722,
+	-0.048772580504031243, 0.13889255825490182, -0.20786740307563648, 0.24519632010080744,
+	-0.24519632010080733, 0.20786740307563614, -0.13889255825490129, 0.04877258050403064,
+	0.036682618613840437, -0.10688877335757062, 0.16788973871175469, -0.21443215250006809,
+	0.24250781329863608, -0.2496988640512931, 0.23538601629575509, -0.20080188287016115,
+	0.14892482612310842, -0.084222463348054485, 0.012266918581854171, 0.060745044975816939,
+	-0.12852568604830611, 0.18523778133874014, -0.22599732328086097, 0.24729412749119525,
+	-0.24729412749119525, 0.22599732328086097, -0.18523778133873894, 0.12852568604830458,
+	-0.060745044975815218, -0.012266918581855057, 0.084222463348055332, -0.14892482612310842,
+	0.20080188287016115, -0.23538601629575509, 0.24969886405129307, -0.24250781329863619,
+	0.2144321525000667, -0.16788973871175286, 0.10688877335756862, -0.03668261861383857,
+	0.024504285082390193, -0.072571169313615611, 0.11784918420649949, -0.15859832104091134,
+	0.19325261334068441, -0.22048031608708904, 0.23923508393305234, -0.24879618166804926,
+	0.2487961816680492, -0.23923508393305221, 0.22048031608708882, -0.19325261334068439,
+	0.15859832104091098, -0.11784918420649831, 0.072571169313615375, -0.024504285082389183,
+	-0.024504285082390095, 0.072571169313616263, -0.11784918420649912, 0.15859832104091171,
+	-0.19325261334068497, 0.22048031608708882, -0.23923508393305196, 0.2487961816680492,
+	-0.24879618166804915, 0.23923508393305182, -0.22048031608708776, 0.19325261334068466,
+	-0.15859832104091132, 0.11784918420649869, -0.072571169313614084, 0.024504285082387844,
+	0.012266918581854531, -0.036682618613840576, 0.060745044975816058, -0.084222463348055249,
+	0.1068887733575707, -0.12852568604830594, 0.14892482612310876, -0.16788973871175497,
+	0.18523778133874005, -0.20080188287016146, 0.2144321525000682, -0.22599732328086095,
+	0.23538601629575526, -0.24250781329863605, 0.24729412749119525, -0.2496988640512931,
+	0.2496988640512931, -0.24729412749119525, 0.24250781329863602, -0.23538601629575526,
+	0.22599732328086092, -0.21443215250006814, 0.20080188287016035, -0.18523778133874003,
+	0.16788973871175361, -0.14892482612310873, 0.12852568604830436, -0.10688877335757105,
+	0.084222463348053944, -0.060745044975816648, 0.036682618613839417, -0.012266918581855303,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffF32, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffF32, 8)
+#endif
+const float dct_coeffF32[1024] = {
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.176776692f, 0.176776692f, 0.176776692f, 0.176776692f,
+	0.249698862f, 0.247294128f, 0.242507815f, 0.235386014f,
+	0.225997329f, 0.21443215f, 0.200801879f, 0.18523778f,
+	0.167889744f, 0.148924828f, 0.128525689f, 0.106888771f,
+	0.0842224658f, 0.0607450455f, 0.0366826169f, 0.012266919f,
+	-0.012266919f, -0.0366826169f, -0.0607450455f, -0.0842224658f,
+	-0.106888771f, -0.128525689f, -0.148924828f, -0.167889744f,
+	-0.18523778f, -0.200801879f, -0.21443215f, -0.225997329f,
+	-0.235386014f, -0.242507815f, -0.247294128f, -0.249698862f,
+	0.24879618f, 0.239235088f, 0.220480323f, 0.193252608f,
+	0.158598319f, 0.117849186f, 0.0725711659f, 0.0245042853f,
+	-0.0245042853f, -0.0725711659f, -0.117849186f, -0.158598319f,
+	-0.193252608f, -0.220480323f, -0.239235088f, -0.24879618f,
+	-0.24879618f, -0.239235088f, -0.220480323f, -0.193252608f,
+	-0.158598319f, -0.117849186f, -0.0725711659f, -0.0245042853f,
+	0.0245042853f, 0.0725711659f, 0.117849186f, 0.158598319f,
+	0.193252608f, 0.220480323f, 0.239235088f, 0.24879618f,
+	0.247294128f, 0.225997329f, 0.18523778f, 0.128525689f,
+	0.0607450455f, -0.012266919f, -0.0842224658f, -0.148924828f,
+	-0.200801879f, -0.235386014f, -0.249698862f, -0.242507815f,
+	-0.21443215f, -0.167889744f, -0.106888771f, -0.0366826169f,
+	0.0366826169f, 0.106888771f, 0.167889744f, 0.21443215f,
+	0.242507815f, 0.249698862f, 0.235386014f, 0.200801879f,
+	0.148924828f, 0.0842224658f, 0.012266919f, -0.0607450455f,
+	-0.128525689f, -0.18523778f, -0.225997329f, -0.247294128f,
+	0.245196313f, 0.207867399f, 0.138892561f, 0.0487725809f,
+	-0.0487725809f, -0.138892561f, -0.207867399f, -0.245196313f,
+	-0.245196313f, -0.207867399f, -0.138892561f, -0.0487725809f,
+	0.0487725809f, 0.138892561f, 0.207867399f, 0.245196313f,
+	0.245196313f, 0.207867399f, 0.138892561f, 0.0487725809f,
+	-0.0487725809f, -0.138892561f, -0.207867399f, -0.245196313f,
+	-0.245196313f, -0.207867399f, -0.138892561f, -0.0487725809f,
+	0.0487725809f, 0.138892561f, 0.207867399f, 0.245196313f,
+	0.242507815f, 0.18523778f, 0.0842224658f, -0.0366826169f,
+	-0.148924828f, -0.225997329f, -0.249698862f, -0.21443215f,
+	-0.128525689f, -0.012266919f, 0.106888771f, 0.200801879f,
+	0.247294128f, 0.235386014f, 0.167889744f, 0.0607450455f,
+	-0.0607450455f, -0.167889744f, -0.235386014f, -0.247294128f,
+	-0.200801879f, -0.106888771f, 0.012266919f, 0.128525689f,
+	0.21443215f, 0.249698862f, 0.225997329f, 0.148924828f,
+	0.0366826169f, -0.0842224658f, -0.18523778f, -0.242507815f,
+	0.239235088f, 0.158598319f, 0.0245042853f, -0.117849186f,
+	-0.220480323f, -0.24879618f, -0.193252608f, -0.0725711659f,
+	0.0725711659f, 0.193252608f, 0.24879618f, 0.220480323f,
+	0.117849186f, -0.0245042853f, -0.158598319f, -0.239235088f,
+	-0.239235088f, -0.158598319f, -0.0245042853f, 0.117849186f,
+	0.220480323f, 0.24879618f, 0.193252608f, 0.0725711659f,
+	-0.0725711659f, -0.193252608f, -0.24879618f, -0.220480323f,
+	-0.117849186f, 0.0245042853f, 0.158598319f, 0.239235088f,
+	0.235386014f, 0.128525689f, -0.0366826169f, -0.18523778f,
+	-0.249698862f, -0.200801879f, -0.0607450455f, 0.106888771f,
+	0.225997329f, 0.242507815f, 0.148924828f, -0.012266919f,
+	-0.167889744f, -0.247294128f, -0.21443215f, -0.0842224658f,
+	0.0842224658f, 0.21443215f, 0.247294128f, 0.167889744f,
+	0.012266919f, -0.148924828f, -0.242507815f, -0.225997329f,
+	-0.106888771f, 0.0607450455f, 0.200801879f, 0.249698862f,
+	0.18523778f, 0.0366826169f, -0.128525689f, -0.235386014f,
+	0.230969876f, 0.0956708565f, -0.0956708565f, -0.230969876f,
+	-0.230969876f, -0.0956708565f, 0.0956708565f, 0.230969876f,
+	0.230969876f, 0.0956708565f, -0.0956708565f, -0.230969876f,
+	-0.230969876f, -0.0956708565f, 0.0956708565f, 0.230969876f,
+	0.230969876f, 0.0956708565f, -0.0956708565f, -0.230969876f,
+	-0.230969876f, -0.0956708565f, 0.0956708565f, 0.230969876f,
+	0.230969876f, 0.0956708565f, -0.0956708565f, -0.230969876f,
+	-0.230969876f, -0.0956708565f, 0.0956708565f, 0.230969876f,
+	0.225997329f, 0.0607450455f, -0.148924828f, -0.249698862f,
+	-0.167889744f, 0.0366826169f, 0.21443215f, 0.235386014f,
+	0.0842224658f, -0.128525689f, -0.247294128f, -0.18523778f,
+	0.012266919f, 0.200801879f, 0.242507815f, 0.106888771f,
+	-0.106888771f, -0.242507815f, -0.200801879f, -0.012266919f,
+	0.18523778f, 0.247294128f, 0.128525689f, -0.0842224658f,
+	-0.235386014f, -0.21443215f, -0.0366826169f, 0.167889744f,
+	0.249698862f, 0.148924828f, -0.0607450455f, -0.225997329f,
+	0.220480323f, 0.0245042853f, -0.193252608f, -0.239235088f,
+	-0.0725711659f, 0.158598319f, 0.24879618f, 0.117849186f,
+	-0.117849186f, -0.24879618f, -0.158598319f, 0.0725711659f,
+	0.239235088f, 0.193252608f, -0.0245042853f, -0.220480323f,
+	-0.220480323f, -0.0245042853f, 0.193252608f, 0.239235088f,
+	0.0725711659f, -0.158598319f, -0.24879618f, -0.117849186f,
+	0.117849186f, 0.24879618f, 0.158598319f, -0.0725711659f,
+	-0.239235088f, -0.193252608f, 0.0245042853f, 0.220480323f,
+	0.21443215f, -0.012266919f, -0.225997329f, -0.200801879f,
+	0.0366826169f, 0.235386014f, 0.18523778f, -0.0607450455f,
+	-0.242507815f, -0.167889744f, 0.0842224658f, 0.247294128f,
+	0.148924828f, -0.106888771f, -0.249698862f, -0.128525689f,
+	0.128525689f, 0.249698862f, 0.106888771f, -0.148924828f,
+	-0.247294128f, -0.0842224658f, 0.167889744f, 0.242507815f,
+	0.0607450455f, -0.18523778f, -0.235386014f, -0.0366826169f,
+	0.200801879f, 0.225997329f, 0.012266919f, -0.21443215f,
+	0.207867399f, -0.0487725809f, -0.245196313f, -0.138892561f,
+	0.138892561f, 0.245196313f, 0.0487725809f, -0.207867399f,
+	-0.207867399f, 0.0487725809f, 0.245196313f, 0.138892561f,
+	-0.138892561f, -0.245196313f, -0.0487725809f, 0.207867399f,
+	0.207867399f, -0.0487725809f, -0.245196313f, -0.138892561f,
+	0.138892561f, 0.245196313f, 0.0487725809f, -0.207867399f,
+	-0.207867399f, 0.0487725809f, 0.245196313f, 0.138892561f,
+	-0.138892561f, -0.245196313f, -0.0487725809f, 0.207867399f,
+	0.200801879f, -0.0842224658f, -0.249698862f, -0.0607450455f,
+	0.21443215f, 0.18523778f, -0.106888771f, -0.247294128f,
+	-0.0366826169f, 0.225997329f, 0.167889744f, -0.128525689f,
+	-0.242507815f, -0.012266919f, 0.235386014f, 0.148924828f,
+	-0.148924828f, -0.235386014f, 0.012266919f, 0.242507815f,
+	0.128525689f, -0.167889744f, -0.225997329f, 0.0366826169f,
+	0.247294128f, 0.106888771f, -0.18523778f, -0.21443215f,
+	0.0607450455f, 0.249698862f, 0.0842224658f, -0.200801879f,
+	0.193252608f, -0.117849186f, -0.239235088f, 0.0245042853f,
+	0.24879618f, 0.0725711659f, -0.220480323f, -0.158598319f,
+	0.158598319f, 0.220480323f, -0.0725711659f, -0.24879618f,
+	-0.0245042853f, 0.239235088f, 0.117849186f, -0.193252608f,
+	-0.193252608f, 0.117849186f, 0.239235088f, -0.0245042853f,
+	-0.24879618f, -0.0725711659f, 0.220480323f, 0.158598319f,
+	-0.158598319f, -0.220480323f, 0.0725711659f, 0.24879618f,
+	0.0245042853f, -0.239235088f, -0.117849186f, 0.193252608f,
+	0.18523778f, -0.148924828f, -0.21443215f, 0.106888771f,
+	0.235386014f, -0.0607450455f, -0.247294128f, 0.012266919f,
+	0.249698862f, 0.0366826169f, -0.242507815f, -0.0842224658f,
+	0.225997329f, 0.128525689f, -0.200801879f, -0.167889744f,
+	0.167889744f, 0.200801879f, -0.128525689f, -0.225997329f,
+	0.0842224658f, 0.242507815f, -0.0366826169f, -0.249698862f,
+	-0.012266919f, 0.247294128f, 0.0607450455f, -0.235386014f,
+	-0.106888771f, 0.21443215f, 0.148924828f, -0.18523778f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.176776692f, -0.176776692f, -0.176776692f, 0.176776692f,
+	0.167889744f, -0.200801879f, -0.128525689f, 0.225997329f,
+	0.0842224658f, -0.242507815f, -0.0366826169f, 0.249698862f,
+	-0.012266919f, -0.247294128f, 0.0607450455f, 0.235386014f,
+	-0.106888771f, -0.21443215f, 0.148924828f, 0.18523778f,
+	-0.18523778f, -0.148924828f, 0.21443215f, 0.106888771f,
+	-0.235386014f, -0.0607450455f, 0.247294128f, 0.012266919f,
+	-0.249698862f, 0.0366826169f, 0.242507815f, -0.0842224658f,
+	-0.225997329f, 0.128525689f, 0.200801879f, -0.167889744f,
+	0.158598319f, -0.220480323f, -0.0725711659f, 0.24879618f,
+	-0.0245042853f, -0.239235088f, 0.117849186f, 0.193252608f,
+	-0.193252608f, -0.117849186f, 0.239235088f, 0.0245042853f,
+	-0.24879618f, 0.0725711659f, 0.220480323f, -0.158598319f,
+	-0.158598319f, 0.220480323f, 0.0725711659f, -0.24879618f,
+	0.0245042853f, 0.239235088f, -0.117849186f, -0.193252608f,
+	0.193252608f, 0.117849186f, -0.239235088f, -0.0245042853f,
+	0.24879618f, -0.0725711659f, -0.220480323f, 0.158598319f,
+	0.148924828f, -0.235386014f, -0.012266919f, 0.242507815f,
+	-0.128525689f, -0.167889744f, 0.225997329f, 0.0366826169f,
+	-0.247294128f, 0.106888771f, 0.18523778f, -0.21443215f,
+	-0.0607450455f, 0.249698862f, -0.0842224658f, -0.200801879f,
+	0.200801879f, 0.0842224658f, -0.249698862f, 0.0607450455f,
+	0.21443215f, -0.18523778f, -0.106888771f, 0.247294128f,
+	-0.0366826169f, -0.225997329f, 0.167889744f, 0.128525689f,
+	-0.242507815f, 0.012266919f, 0.235386014f, -0.148924828f,
+	0.138892561f, -0.245196313f, 0.0487725809f, 0.207867399f,
+	-0.207867399f, -0.0487725809f, 0.245196313f, -0.138892561f,
+	-0.138892561f, 0.245196313f, -0.0487725809f, -0.207867399f,
+	0.207867399f, 0.0487725809f, -0.245196313f, 0.138892561f,
+	0.138892561f, -0.245196313f, 0.0487725809f, 0.207867399f,
+	-0.207867399f, -0.0487725809f, 0.245196313f, -0.138892561f,
+	-0.138892561f, 0.245196313f, -0.0487725809f, -0.207867399f,
+	0.207867399f, 0.0487725809f, -0.245196313f, 0.138892561f,
+	0.128525689f, -0.249698862f, 0.106888771f, 0.148924828f,
+	-0.247294128f, 0.0842224658f, 0.167889744f, -0.242507815f,
+	0.0607450455f, 0.18523778f, -0.235386014f, 0.0366826169f,
+	0.200801879f, -0.225997329f, 0.012266919f, 0.21443215f,
+	-0.21443215f, -0.012266919f, 0.225997329f, -0.200801879f,
+	-0.0366826169f, 0.235386014f, -0.18523778f, -0.0607450455f,
+	0.242507815f, -0.167889744f, -0.0842224658f, 0.247294128f,
+	-0.148924828f, -0.106888771f, 0.249698862f, -0.128525689f,
+	0.117849186f, -0.24879618f, 0.158598319f, 0.0725711659f,
+	-0.239235088f, 0.193252608f, 0.0245042853f, -0.220480323f,
+	0.220480323f, -0.0245042853f, -0.193252608f, 0.239235088f,
+	-0.0725711659f, -0.158598319f, 0.24879618f, -0.117849186f,
+	-0.117849186f, 0.24879618f, -0.158598319f, -0.0725711659f,
+	0.239235088f, -0.193252608f, -0.0245042853f, 0.220480323f,
+	-0.220480323f, 0.0245042853f, 0.193252608f, -0.239235088f,
+	0.0725711659f, 0.158598319f, -0.24879618f, 0.117849186f,
+	0.106888771f, -0.242507815f, 0.200801879f, -0.012266919f,
+	-0.18523778f, 0.247294128f, -0.128525689f, -0.0842224658f,
+	0.235386014f, -0.21443215f, 0.0366826169f, 0.167889744f,
+	-0.249698862f, 0.148924828f, 0.0607450455f, -0.225997329f,
+	0.225997329f, -0.0607450455f, -0.148924828f, 0.249698862f,
+	-0.167889744f, -0.0366826169f, 0.21443215f, -0.235386014f,
+	0.0842224658f, 0.128525689f, -0.247294128f, 0.18523778f,
+	0.012266919f, -0.200801879f, 0.242507815f, -0.106888771f,
+	0.0956708565f, -0.230969876f, 0.230969876f, -0.0956708565f,
+	-0.0956708565f, 0.230969876f, -0.230969876f, 0.0956708565f,
+	0.0956708565f, -0.230969876f, 0.230969876f, -0.0956708565f,
+	-0.0956708565f, 0.230969876f, -0.230969876f, 0.0956708565f,
+	0.0956708565f, -0.230969876f, 0.230969876f, -0.0956708565f,
+	-0.0956708565f, 0.230969876f, -0.230969876f, 0.0956708565f,
+	0.0956708565f, -0.230969876f, 0.230969876f, -0.0956708565f,
+	-0.0956708565f, 0.230969876f, -0.230969876f, 0.0956708565f,
+	0.0842224658f, -0.21443215f, 0.247294128f, -0.167889744f,
+	0.012266919f, 0.148924828f, -0.242507815f, 0.225997329f,
+	-0.106888771f, -0.0607450455f, 0.200801879f, -0.249698862f,
+	0.18523778f, -0.0366826169f, -0.128525689f, 0.235386014f,
+	-0.235386014f, 0.128525689f, 0.0366826169f, -0.18523778f,
+	0.249698862f, -0.200801879f, 0.0607450455f, 0.106888771f,
+	-0.225997329f, 0.242507815f, -0.148924828f, -0.012266919f,
+	0.167889744f, -0.247294128f, 0.21443215f, -0.0842224658f,
+	0.0725711659f, -0.193252608f, 0.24879618f, -0.220480323f,
+	0.117849186f, 0.0245042853f, -0.158598319f, 0.239235088f,
+	-0.239235088f, 0.158598319f, -0.0245042853f, -0.117849186f,
+	0.220480323f, -0.24879618f, 0.193252608f, -0.0725711659f,
+	-0.0725711659f, 0.193252608f, -0.24879618f, 0.220480323f,
+	-0.117849186f, -0.0245042853f, 0.158598319f, -0.239235088f,
+	0.239235088f, -0.158598319f, 0.0245042853f, 0.117849186f,
+	-0.220480323f, 0.24879618f, -0.193252608f, 0.0725711659f,
+	0.0607450455f, -0.167889744f, 0.235386014f, -0.247294128f,
+	0.200801879f, -0.106888771f, -0.012266919f, 0.128525689f,
+	-0.21443215f, 0.249698862f, -0.225997329f, 0.148924828f,
+	-0.0366826169f, -0.0842224658f, 0.18523778f, -0.242507815f,
+	0.242507815f, -0.18523778f, 0.0842224658f, 0.0366826169f,
+	-0.148924828f, 0.225997329f, -0.249698862f, 0.21443215f,
+	-0.128525689f, 0.012266919f, 0.106888771f, -0.200801879f,
+	0.247294128f, -0.235386014f, 0.167889744f, -0.0607450455f,
+	0.0487725809f, -0.138892561f, 0.207867399f, -0.245196313f,
+	0.245196313f, -0.207867399f, 0.138892561f, -0.0487725809f,
+	-0.0487725809f, 0.138892561f, -0.207867399f, 0.245196313f,
+	-0.245196313f, 0.207867399f, -0.138892561f, 0.0487725809f,
+	0.0487725809f, -0.138892561f, 0.207867399f, -0.245196313f,
+	0.245196313f, -0.207867399f, 0.138892561f, -0.0487725809f,
+	-0.0487725809f, 0.138892561f, -0.207867399f, 0.245196313f,
+	-0.245196313f, 0.207867399f, -0.138892561f, 0.0487725809f,
+	0.0366826169f, -0.106888771f, 0.167889744f, -0.21443215f,
+	0.242507815f, -0.249698862f, 0.235386014f, -0.200801879f,
+	0.148924828f, -0.0842224658f, 0.012266919f, 0.0607450455f,
+	-0.128525689f, 0.18523778f, -0.225997329f, 0.247294128f,
+	-0.247294128f, 0.225997329f, -0.18523778f, 0.128525689f,
+	-0.0607450455f, -0.012266919f, 0.0842224658f, -0.148924828f,
+	0.200801879f, -0.235386014f, 0.249698862f, -0.242507815f,
+	0.21443215f, -0.167889744f, 0.106888771f, -0.0366826169f,
+	0.0245042853f, -0.0725711659f, 0.117849186f, -0.158598319f,
+	0.193252608f, -0.220480323f, 0.239235088f, -0.24879618f,
+	0.24879618f, -0.239235088f, 0.220480323f, -0.193252608f,
+	0.158598319f, -0.117849186f, 0.0725711659f, -0.0245042853f,
+	-0.0245042853f, 0.0725711659f, -0.117849186f, 0.158598319f,
+	-0.193252608f, 0.220480323f, -0.239235088f, 0.24879618f,
+	-0.24879618f, 0.239235088f, -0.220480323f, 0.193252608f,
+	-0.158598319f, 0.117849186f, -0.0725711659f, 0.0245042853f,
+	0.012266919f, -0.0366826169f, 0.0607450455f, -0.0842224658f,
+	0.106888771f, -0.128525689f, 0.148924828f, -0.167889744f,
+	0.18523778f, -0.200801879f, 0.21443215f, -0.225997329f,
+	0.235386014f, -0.242507815f, 0.247294128f, -0.249698862f,
+	0.249698862f, -0.247294128f, 0.242507815f, -0.235386014f,
+	0.225997329f, -0.21443215f, 0.200801879f, -0.18523778f,
+	0.167889744f, -0.148924828f, 0.128525689f, -0.106888771f,
+	0.0842224658f, -0.0607450455f, 0.0366826169f, -0.012266919f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_coeffQ15_32, ".const:dct")
+#pragma DATA_ALIGN(dct_coeffQ15_32, 8)
+#endif
+const short dct_coeffQ15_32[1024] = {
+	5793, 5793, 5793, 5793, 5793, 5793, 5793, 5793,
+	5793, 5793, 5793, 5793, 5793, 5793, 5793, 5793,
+	5793, 5793, 5793, 5793, 5793, 5793, 5793, 5793,
+	5793, 5793, 5793, 5793, 5793, 5793, 5793, 5793,
+	8182, 8103, 7946, 7713, 7405, 7027, 6580, 6070,
+	5501, 4880, 4212, 3503, 2760, 1990, 1202, 402,
+	-402, -1202, -1990, -2760, -3503, -4212, -4880, -5501,
+	-6070, -6580, -7027, -7405, -7713, -7946, -8103, -8182,
+	8153, 7839, 7225, 6333, 5197, 3862, 2378, 803,
+	-803, -2378, -3862, -5197, -6333, -7225, -7839, -8153,
+	-8153, -7839, -7225, -6333, -5197, -3862, -2378, -803,
+	803, 2378, 3862, 5197, 6333, 7225, 7839, 8153,
+	8103, 7405, 6070, 4212, 1990, -402, -2760, -4880,
+	-6580, -7713, -8182, -7946, -7027, -5501, -3503, -1202,
+	1202, 3503, 5501, 7027, 7946, 8182, 7713, 6580,
+	4880, 2760, 402, -1990, -4212, -6070, -7405, -8103,
+	8035, 6811, 4551, 1598, -1598, -4551, -6811, -8035,
+	-8035, -6811, -4551, -1598, 1598, 4551, 6811, 8035,
+	8035, 6811, 4551, 1598, -1598, -4551, -6811, -8035,
+	-8035, -6811, -4551, -1598, 1598, 4551, 6811, 8035,
+	7946, 6070, 2760, -1202, -4880, -7405, -8182, -7027,
+	-4212, -402, 3503, 6580, 8103, 7713, 5501, 1990,
+	-1990, -5501, -7713, -8103, -6580, -3503, 402, 4212,
+	7027, 8182, 7405, 4880, 1202, -2760, -6070, -7946,
+	7839, 5197, 803, -3862, -7225, -8153, -6333, -2378,
+	2378, 6333, 8153, 7225, 3862, -803, -5197, -7839,
+	-7839, -5197, -803, 3862, 7225, 8153, 6333, 2378,
+	-2378, -6333, -8153, -7225, -3862, 803, 5197, 7839,
+	7713, 4212, -1202, -6070, -8182, -6580, -1990, 3503,
+	7405, 7946, 4880, -402, -5501, -8103, -7027, -2760,
+	2760, 7027, 8103, 5501, 402, -4880, -7946, -7405,
+	-3503, 1990, 6580, 8182, 6070, 1202, -4212, -7713,
+	7568, 3135, -3135, -7568, -7568, -3135, 3135, 7568,
+	7568, 3135, -3135, -7568, -7568, -3135, 3135, 7568,
+	7568, 3135, -3135, -7568, -7568, -3135, 3135, 7568,
+	7568, 3135, -3135, -7568, -7568, -3135, 3135, 7568,
+	7405, 1990, -4880, -8182, -5501, 1202, 7027, 7713,
+	2760, -4212, -8103, -6070, 402, 6580, 7946, 3503,
+	-3503, -7946, -6580, -402, 6070, 8103, 4212, -2760,
+	-7713, -7027, -1202, 5501, 8182, 4880, -1990, -7405,
+	7225, 803, -6333, -7839, -2378, 5197, 8153, 3862,
+	-3862, -8153, -5197, 2378, 7839, 6333, -803, -7225,
+	-7225, -803, 6333, 7839, 2378, -5197, -8153, -3862,
+	3862, 8153, 5197, -2378, -7839, -6333, 803, 7225,
+	7027, -402, -7405, -6580, 1202, 7713, 6070, -1990,
+	-7946, -5501, 2760, 8103, 4880, -3503, -8182, -4212,
+	4212, 8182, 3503, -4880, -8103, -2760, 5501, 7946,
+	1990, -6070, -7713, -1202, 6580, 7405, 402, -7027,
+	6811, -1598, -8035, -4551, 4551, 8035, 1598, -6811,
+	-6811, 1598, 8035, 4551, -4551, -8035, -1598, 6811,
+	6811, -1598, -8035, -4551, 4551, 8035, 1598, -6811,
+	-6811, 1598, 8035, 4551, -4551, -8035, -1598, 6811,
+	6580, -2760, -8182, -1990, 7027, 6070, -3503, -8103,
+	-1202, 7405, 5501, -4212, -7946, -402, 7713, 4880,
+	-4880, -7713, 402, 7946, 4212, -5501, -7405, 1202,
+	8103, 3503, -6070, -7027, 1990, 8182, 2760, -6580,
+	6333, -3862, -7839, 803, 8153, 2378, -7225, -5197,
+	5197, 7225, -2378, -8153, -803, 7839, 3862, -6333,
+	-6333, 3862, 7839, -803, -8153, -2378, 7225, 5197,
+	-5197, -7225, 2378, 8153, 803, -7839, -3862, 6333,
+	6070, -4880, -7027, 3503, 7713, -1990, -8103, 402,
+	8182, 1202, -7946, -2760, 7405, 4212, -6580, -5501,
+	5501, 6580, -4212, -7405, 2760, 7946, -1202, -8182,
+	-402, 8103, 1990, -7713, -3503, 7027, 4880, -6070,
+	5793, -5793, -5793, 5793, 5793, -5793, -5793, 5793,
+	5793, -5793, -5793, 5793, 5793, -5793, -5793, 5793,
+	5793, -5793, -5793, 5793, 5793, -5793, -5793, 5793,
+	5793, -5793, -5793, 5793, 5793, -5793, -5793, 5793,
+	5501, -6580, -4212, 7405, 2760, -7946, -1202, 8182,
+	-402, -8103, 1990, 7713, -3503, -7027, 4880, 6070,
+	-6070, -4880, 7027, 3503, -7713, -1990, 8103, 402,
+	-8182, 1202, 7946, -2760, -7405, 4212, 6580, -5501,
+	5197, -7225, -2378, 8153, -803, -7839, 3862, 6333,
+	-6333, -3862, 7839, 803, -8153, 2378, 7225, -5197,
+	-5197, 7225, 2378, -8153, 803, 7839, -3862, -6333,
+	6333, 3862, -7839, -803, 8153, -2378, -7225, 5197,
+	4880, -7713, -402, 7946, -4212, -5501, 7405, 1202,
+	-8103, 3503, 6070, -7027, -1990, 8182, -2760, -6580,
+	6580, 2760, -8182, 1990, 7027, -6070, -3503, 8103,
+	-1202, -7405, 5501, 4212, -7946, 402, 7713, -4880,
+	4551, -8035, 1598, 6811, -6811, -1598, 8035, -4551,
+	-4551, 8035, -1598, -6811, 6811, 1598, -8035, 4551,
+	4551, -8035, 1598, 6811, -6811, -1598, 8035, -4551,
+	-4551, 8035, -1598, -6811, 6811, 1598, -8035, 4551,
+	4212, -8182, 3503, 4880, -8103, 2760, 5501, -7946,
+	1990, 6070, -7713, 1202, 6580, -7405, 402, 7027,
+	-7027, -402, 7405, -6580, -1202, 7713, -6070, -1990,
+	7946, -5501, -2760, 8103, -4880, -3503, 8182, -4212,
+	3862, -8153, 5197, 2378, -7839, 6333, 803, -7225,
+	7225, -803, -6333, 7839, -2378, -5197, 8153, -3862,
+	-3862, 8153, -5197, -2378, 7839, -6333, -803, 7225,
+	-7225, 803, 6333, -7839, 2378, 5197, -8153, 3862,
+	3503, -7946, 6580, -402, -6070, 8103, -4212, -2760,
+	7713, -7027, 1202, 5501, -8182, 4880, 1990, -7405,
+	7405, -1990, -4880, 8182, -5501, -1202, 7027, -7713,
+	2760, 4212, -8103, 6070, 402, -6580, 7946, -3503,
+	3135, -7568, 7568, -3135, -3135, 7568, -7568, 3135,
+	3135, -7568, 7568, -3135, -3135, 7568, -7568, 3135,
+	3135, -7568, 7568, -3135, -3135, 7568, -7568, 3135,
+	3135, -7568, 7568, -3135, -3135, 7568, -7568, 3135,
+	2760, -7027, 8103, -5501, 402, 4880, -7946, 7405,
+	-3503, -1990, 6580, -8182, 6070, -1202, -4212, 7713,
+	-7713, 4212, 1202, -6070, 8182, -6580, 1990, 3503,
+	-7405, 7946, -4880, -402, 5501, -8103, 7027, -2760,
+	2378, -6333, 8153, -7225, 3862, 803, -5197, 7839,
+	-7839, 5197, -803, -3862, 7225, -8153, 6333, -2378,
+	-2378, 6333, -8153, 7225, -3862, -803, 5197, -7839,
+	7839, -5197, 803, 3862, -7225, 8153, -6333, 2378,
+	1990, -5501, 7713, -8103, 6580, -3503, -402, 4212,
+	-7027, 8182, -7405, 4880, -1202, -2760, 6070, -7946,
+	7946, -6070, 2760, 1202, -4880, 7405, -8182, 7027,
+	-4212, 402, 3503, -6580, 8103, -7713, 5501, -1990,
+	1598, -4551, 6811, -8035, 8035, -6811, 4551, -1598,
+	-1598, 4551, -6811, 8035, -8035, 6811, -4551, 1598,
+	1598, -4551, 6811, -8035, 8035, -6811, 4551, -1598,
+	-1598, 4551, -6811, 8035, -8035, 6811, -4551, 1598,
+	1202, -3503, 5501, -7027, 7946, -8182, 7713, -6580,
+	4880, -2760, 402, 1990, -4212, 6070, -7405, 8103,
+	-8103, 7405, -6070, 4212, -1990, -402, 2760, -4880,
+	6580, -7713, 8182, -7946, 7027, -5501, 3503, -1202,
+	803, -2378, 3862, -5197, 6333, -7225, 7839, -8153,
+	8153, -7839, 7225, -6333, 5197, -3862, 2378, -803,
+	-803, 2378, -3862, 5197, -6333, 7225, -7839, 8153,
+	-8153, 7839, -7225, 6333, -5197, 3862, -2378, 803,
+	402, -1202, 1990, -2760, 3503, -4212, 4880, -5501,
+	6070, -6580, 7027, -7405, 7713, -7946, 8103, -8182,
+	8182, -8103, 7946, -7713, 7405, -7027, 6580, -6070,
+	5501, -4880, 4212, -3503, 2760, -1990, 1202, -402,
+};
+
+/* N = 32, inverse (transposed) */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffD32, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffD32, 8)
+#endif
+const double dct_icoeffD32[1024] = {
+	0.17677669529663689, 0.2496988640512931, 0.24879618166804923, 0.24729412749119525,
+	0.24519632010080761, 0.24250781329863599, 0.23923508393305221, 0.2353860162957552,
+	0.23096988312782168, 0.22599732328086083, 0.22048031608708876, 0.21443215250006803,
+	0.20786740307563631, 0.20080188287016124, 0.19325261334068425, 0.18523778133873978,
+	0.17677669529663689, 0.16788973871175458, 0.15859832104091137, 0.14892482612310837,
+	0.13889255825490057, 0.12852568604830542, 0.11784918420649945, 0.10688877335757055,
+	0.095670858091272459, 0.084222463348055013, 0.072571169313615583, 0.060745044975815995,
+	0.048772580504032083, 0.036682618613840437, 0.024504285082390193, 0.012266918581854531,
+	0.17677669529663689, 0.24729412749119525, 0.23923508393305221, 0.22599732328086083,
+	0.20786740307563631, 0.18523778133873978, 0.15859832104091137, 0.12852568604830542,
+	0.095670858091272459, 0.060745044975815995, 0.024504285082390193, -0.012266918581854502,
+	-0.048772580504032048, -0.084222463348054985, -0.11784918420649942, -0.14892482612310834,
+	-0.17677669529663687, -0.20080188287016121, -0.22048031608708873, -0.23538601629575517,
+	-0.24519632010080761, -0.2496988640512931, -0.24879618166804923, -0.24250781329863599,
+	-0.23096988312782171, -0.21443215250006803, -0.19325261334068428, -0.16788973871175467,
+	-0.13889255825490054, -0.10688877335757062, -0.072571169313615611, -0.036682618613840576,
+	0.17677669529663689, 0.24250781329863599, 0.22048031608708876, 0.18523778133873978,
+	0.13889255825490057, 0.084222463348055013, 0.024504285082390193, -0.036682618613840409,
+	-0.095670858091272432, -0.14892482612310834, -0.19325261334068425, -0.22599732328086083,
+	-0.24519632010080761, -0.2496988640512931, -0.23923508393305223, -0.21443215250006803,
+	-0.17677669529663692, -0.12852568604830544, -0.072571169313615611, -0.012266918581854507,
+	0.048772580504032076, 0.10688877335757054, 0.1585983210409114, 0.20080188287016126,
+	0.23096988312782163, 0.24729412749119523, 0.24879618166804923, 0.23538601629575523,
+	0.20786740307563636, 0.16788973871175469, 0.11784918420649949, 0.060745044975816058,
+	0.17677669529663689, 0.2353860162957552, 0.19325261334068425, 0.12852568604830542,
+	0.048772580504032083, -0.036682618613840409, -0.11784918420649942, -0.18523778133873972,
+	-0.23096988312782168, -0.2496988640512931, -0.23923508393305223, -0.20080188287016124,
+	-0.13889255825490054, -0.06074504497581603, 0.024504285082390023, 0.10688877335757054,
+	0.17677669529663684, 0.22599732328086078, 0.24879618166804923, 0.24250781329863602,
+	0.20786740307563636, 0.14892482612310831, 0.072571169313615638, -0.012266918581854386,
+	-0.095670858091272473, -0.16788973871175442, -0.22048031608708871, -0.24729412749119525,
+	-0.24519632010080766, -0.21443215250006809, -0.15859832104091134, -0.084222463348055249,
+	0.17677669529663689, 0.22599732328086083, 0.15859832104091137, 0.060745044975815995,
+	-0.048772580504032048, -0.14892482612310834, -0.22048031608708873, -0.2496988640512931,
+	-0.23096988312782171, -0.16788973871175467, -0.072571169313615611, 0.036682618613840486,
+	0.13889255825490046, 0.214432152500068, 0.24879618166804923, 0.23538601629575523,
+	0.17677669529663692, 0.084222463348055013, -0.024504285082389991, -0.12852568604830536,
+	-0.20786740307563628, -0.24729412749119525, -0.23923508393305218, -0.18523778133873997,
+	-0.09567085809127264, 0.012266918581854355, 0.11784918420649934, 0.20080188287016121,
+	0.24519632010080761, 0.24250781329863608, 0.19325261334068441, 0.1068887733575707,
+	0.17677669529663689, 0.21443215250006803, 0.11784918420649945, -0.012266918581854502,
+	-0.13889255825490049, -0.22599732328086083, -0.24879618166804923, -0.20080188287016124,
+	-0.095670858091272584, 0.036682618613840486, 0.1585983210409114, 0.2353860162957552,
+	0.24519632010080761, 0.1852377813387398, 0.072571169313615638, -0.060745044975815697,
+	-0.17677669529663667, -0.24250781329863602, -0.23923508393305218, -0.16788973871175453,
+	-0.048772580504032007, 0.084222463348055054, 0.19325261334068425, 0.24729412749119525,
+	0.23096988312782168, 0.14892482612310837, 0.024504285082390203, -0.10688877335757045,
+	-0.20786740307563625, -0.2496988640512931, -0.22048031608708904, -0.12852568604830594,
+	0.17677669529663689, 0.20080188287016124, 0.072571169313615583, -0.084222463348054985,
+	-0.20786740307563634, -0.2496988640512931, -0.19325261334068428, -0.06074504497581603,
+	0.095670858091272501, 0.214432152500068, 0.24879618166804923, 0.1852377813387398,
+	0.048772580504032194, -0.10688877335757051, -0.22048031608708871, -0.24729412749119528,
+	-0.17677669529663678, -0.036682618613840416, 0.11784918420649934, 0.22599732328086075,
+	0.24519632010080766, 0.16788973871175455, 0.024504285082390203, -0.1285256860483053,
+	-0.2309698831278216, -0.24250781329863608, -0.1585983210409114, -0.01226691858185463,
+	0.13889255825490038, 0.23538601629575509, 0.23923508393305234, 0.14892482612310876,
+	0.17677669529663689, 0.18523778133873978, 0.024504285082390193, -0.14892482612310834,
+	-0.24519632010080761, -0.21443215250006803, -0.072571169313615611, 0.10688877335757054,
+	0.23096988312782163, 0.23538601629575523, 0.11784918420649949, -0.060745044975815697,
+	-0.20786740307563628, -0.24729412749119528, -0.15859832104091134, 0.012266918581854355,
+	0.17677669529663664, 0.2496988640512931, 0.19325261334068441, 0.036682618613840451,
+	-0.13889255825490038, -0.24250781329863602, -0.22048031608708904, -0.084222463348054888,
+	0.09567085809127239, 0.22599732328086072, 0.23923508393305234, 0.12852568604830597,
+	-0.048772580504032145, -0.20080188287016115, -0.24879618166804926, -0.16788973871175497,
+	0.17677669529663689, 0.16788973871175458, -0.024504285082390161, -0.20080188287016121,
+	-0.24519632010080761, -0.12852568604830544, 0.072571169313615513, 0.22599732328086078,
+	0.23096988312782168, 0.084222463348055013, -0.11784918420649937, -0.24250781329863602,
+	-0.20786740307563639, -0.036682618613840416, 0.15859832104091118, 0.2496988640512931,
+	0.17677669529663681, -0.012266918581854323, -0.19325261334068425, -0.24729412749119528,
+	-0.13889255825490066, 0.060745044975815607, 0.22048031608708887, 0.2353860162957552,
+	0.095670858091272723, -0.10688877335757001, -0.23923508393305223, -0.21443215250006814,
+	-0.048772580504032562, 0.14892482612310842, 0.2487961816680492, 0.18523778133874005,
+	0.17677669529663689, 0.14892482612310837, -0.072571169313615541, -0.23538601629575517,
+	-0.20786740307563636, -0.012266918581854507, 0.19325261334068417, 0.24250781329863602,
+	0.095670858091272612, -0.12852568604830536, -0.24879618166804923, -0.16788973871175453,
+	0.048772580504031798, 0.22599732328086075, 0.22048031608708882, 0.036682618613840451,
+	-0.17677669529663662, -0.24729412749119528, -0.11784918420649958, 0.10688877335757004,
+	0.24519632010080761, 0.18523778133874003, -0.024504285082390311, -0.21443215250006792,
+	-0.23096988312782191, -0.060745044975815989, 0.15859832104091109, 0.2496988640512931,
+	0.13889255825490071, -0.084222463348054485, -0.23923508393305221, -0.20080188287016146,
+	0.17677669529663689, 0.12852568604830542, -0.11784918420649942, -0.2496988640512931,
+	-0.13889255825490054, 0.10688877335757054, 0.24879618166804923, 0.14892482612310831,
+	-0.095670858091272473, -0.24729412749119525, -0.15859832104091134, 0.084222463348055054,
+	0.24519632010080761, 0.16788973871175455, -0.072571169313615638, -0.24250781329863602,
+	-0.17677669529663684, 0.060745044975815607, 0.23923508393305223, 0.18523778133874003,
+	-0.048772580504032145, -0.23538601629575506, -0.19325261334068419, 0.036682618613840083,
+	0.23096988312782171, 0.20080188287016143, -0.024504285082390248, -0.2259973232808607,
+	-0.20786740307563625, 0.012266918581854171, 0.22048031608708882, 0.2144321525000682,
+	0.17677669529663689, 0.10688877335757055, -0.15859832104091134, -0.24250781329863599,
+	-0.048772580504032166, 0.20080188287016126, 0.22048031608708876, -0.012266918581854386,
+	-0.2309698831278216, -0.18523778133873997, 0.072571169313615666, 0.24729412749119525,
+	0.13889255825490063, -0.1285256860483053, -0.24879618166804923, -0.084222463348054888,
+	0.17677669529663659, 0.2353860162957552, 0.024504285082390706, -0.21443215250006792,
+	-0.20786740307563623, 0.036682618613840083, 0.23923508393305221, 0.16788973871175497,
+	-0.095670858091272307, -0.24969886405129307, -0.11784918420649969, 0.14892482612310837,
+	0.24519632010080772, 0.060745044975816939, -0.19325261334068439, -0.22599732328086095,
+	0.17677669529663689, 0.084222463348055013, -0.19325261334068425, -0.21443215250006803,
+	0.048772580504032076, 0.24729412749119523, 0.11784918420649949, -0.16788973871175442,
+	-0.23096988312782168, 0.012266918581854355, 0.23923508393305212, 0.14892482612310837,
+	-0.13889255825490038, -0.24250781329863608, -0.024504285082390675, 0.22599732328086072,
+	0.17677669529663687, -0.10688877335757001, -0.24879618166804926, -0.060745044975815989,
+	0.20786740307563595, 0.20080188287016143, -0.072571169313615527, -0.24969886405129307,
+	-0.095670858091272806, 0.18523778133873969, 0.2204803160870891, -0.036682618613840874,
+	-0.24519632010080741, -0.12852568604830611, 0.15859832104091098, 0.23538601629575526,
+	0.17677669529663689, 0.060745044975815995, -0.22048031608708873, -0.16788973871175467,
+	0.13889255825490046, 0.23538601629575523, -0.024504285082389991, -0.24729412749119525,
+	-0.09567085809127264, 0.20080188287016121, 0.19325261334068441, -0.10688877335757045,
+	-0.24519632010080766, -0.01226691858185463, 0.23923508393305223, 0.12852568604830597,
+	-0.17677669529663659, -0.21443215250006814, 0.072571169313615555, 0.2496988640512931,
+	0.048772580504032589, -0.2259973232808607, -0.15859832104091148, 0.14892482612310837,
+	0.23096988312782193, -0.036682618613840874, -0.2487961816680492, -0.084222463348055901,
+	0.20786740307563639, 0.18523778133874014, -0.11784918420649831, -0.24250781329863605,
+	0.17677669529663689, 0.036682618613840437, -0.23923508393305221, -0.10688877335757062,
+	0.20786740307563631, 0.16788973871175469, -0.15859832104091121, -0.21443215250006809,
+	0.095670858091272445, 0.24250781329863608, -0.024504285082389929, -0.2496988640512931,
+	-0.048772580504032499, 0.23538601629575509, 0.1178491842064996, -0.20080188287016115,
+	-0.17677669529663689, 0.14892482612310842, 0.22048031608708907, -0.084222463348054485,
+	-0.24519632010080769, 0.012266918581854171, 0.2487961816680492, 0.060745044975816939,
+	-0.23096988312782135, -0.12852568604830611, 0.1932526133406838, 0.18523778133874014,
+	-0.13889255825490018, -0.22599732328086097, 0.072571169313615375, 0.24729412749119525,
+	0.17677669529663689, 0.012266918581854531, -0.2487961816680492, -0.036682618613840576,
+	0.24519632010080758, 0.060745044975816058, -0.23923508393305212, -0.084222463348055249,
+	0.2309698831278216, 0.1068887733575707, -0.22048031608708868, -0.12852568604830594,
+	0.207867403075636, 0.14892482612310876, -0.19325261334068392, -0.16788973871175497,
+	0.17677669529663656, 0.18523778133874005, -0.15859832104091107, -0.20080188287016146,
+	0.13889255825490027, 0.2144321525000682, -0.11784918420649837, -0.22599732328086095,
+	0.095670858091271391, 0.23538601629575526, -0.072571169313614556, -0.24250781329863605,
+	0.048772580504031063, 0.24729412749119525, -0.024504285082389183, -0.2496988640512931,
+	0.17677669529663689, -0.012266918581854502, -0.24879618166804923, 0.036682618613840486,
+	0.24519632010080761, -0.060745044975815697, -0.23923508393305218, 0.084222463348055054,
+	0.23096988312782168, -0.10688877335757045, -0.22048031608708904, 0.12852568604830567,
+	0.2078674030756362, -0.14892482612310845, -0.19325261334068419, 0.16788973871175461,
+	0.17677669529663689, -0.18523778133873972, -0.15859832104091148, 0.2008018828701611,
+	0.13889255825490152, -0.21443215250006739, -0.11784918420649897, 0.22599732328086103,
+	0.095670858091272071, -0.23538601629575531, -0.072571169313615319, 0.24250781329863605,
+	0.048772580504031902, -0.24729412749119525, -0.024504285082390095, 0.2496988640512931,
+	0.17677669529663689, -0.036682618613840409, -0.23923508393305223, 0.10688877335757054,
+	0.20786740307563636, -0.16788973871175442, -0.15859832104091134, 0.21443215250006797,
+	0.095670858091272667, -0.24250781329863602, -0.024504285082390675, 0.2496988640512931,
+	-0.048772580504032145, -0.23538601629575523, 0.11784918420649923, 0.20080188287016143,
+	-0.17677669529663653, -0.14892482612310884, 0.22048031608708882, 0.084222463348055041,
+	-0.24519632010080741, -0.012266918581854813, 0.24879618166804918, -0.060745044975815399,
+	-0.23096988312782163, 0.12852568604830469, 0.19325261334068433, -0.185237781338739,
+	-0.13889255825490091, 0.22599732328086097, 0.072571169313616263, -0.24729412749119525,
+	0.17677669529663689, -0.060745044975815968, -0.22048031608708876, 0.16788973871175458,
+	0.13889255825490057, -0.23538601629575512, -0.024504285082390172, 0.24729412749119528,
+	-0.095670858091272418, -0.20080188287016137, 0.19325261334068394, 0.10688877335757035,
+	-0.24519632010080761, 0.012266918581854231, 0.23923508393305237, -0.12852568604830558,
+	-0.17677669529663692, 0.21443215250006786, 0.072571169313616082, -0.24969886405129307,
+	0.048772580504031118, 0.22599732328086133, -0.15859832104091165, -0.14892482612310823,
+	0.23096988312782166, 0.036682618613840749, -0.24879618166804929, 0.084222463348054291,
+	0.20786740307563686, -0.18523778133873894, -0.11784918420649912, 0.24250781329863602,
+	0.17677669529663689, -0.084222463348054985, -0.19325261334068428, 0.214432152500068,
+	0.048772580504032194, -0.24729412749119528, 0.11784918420649934, 0.16788973871175455,
+	-0.2309698831278216, -0.01226691858185463, 0.23923508393305234, -0.14892482612310845,
+	-0.13889255825490068, 0.24250781329863588, -0.024504285082390248, -0.22599732328086092,
+	0.1767766952966365, 0.10688877335757127, -0.2487961816680492, 0.060745044975816287,
+	0.20786740307563678, -0.20080188287016104, -0.072571169313615319, 0.24969886405129316,
+	-0.095670858091272126, -0.18523778133873961, 0.22048031608708832, 0.036682618613840812,
+	-0.24519632010080758, 0.12852568604830458, 0.15859832104091171, -0.23538601629575526,
+	0.17677669529663689, -0.10688877335757047, -0.15859832104091148, 0.24250781329863599,
+	-0.048772580504031826, -0.20080188287016135, 0.22048031608708868, 0.012266918581854599,
+	-0.23096988312782188, 0.18523778133873978, 0.072571169313615971, -0.24729412749119523,
+	0.13889255825490032, 0.12852568604830603, -0.2487961816680492, 0.084222463348054458,
+	0.17677669529663759, -0.23538601629575534, 0.024504285082390158, 0.21443215250006822,
+	-0.20786740307563586, -0.036682618613841603, 0.23923508393305215, -0.16788973871175447,
+	-0.095670858091272987, 0.24969886405129316, -0.1178491842064982, -0.14892482612310834,
+	0.24519632010080752, -0.060745044975815218, -0.19325261334068497, 0.22599732328086092,
+	0.17677669529663689, -0.12852568604830542, -0.11784918420649947, 0.2496988640512931,
+	-0.13889255825490043, -0.10688877335757067, 0.24879618166804923, -0.14892482612310814,
+	-0.095670858091272695, 0.24729412749119523, -0.15859832104091109, -0.084222463348054957,
+	0.24519632010080769, -0.16788973871175461, -0.072571169313616055, 0.24250781329863602,
+	-0.1767766952966365, -0.060745044975816107, 0.23923508393305215, -0.18523778133873903,
+	-0.048772580504032742, 0.23538601629575528, -0.19325261334068433, -0.036682618613841658,
+	0.23096988312782202, -0.20080188287016099, -0.024504285082390158, 0.22599732328086142,
+	-0.20786740307563578, -0.012266918581855057, 0.22048031608708882, -0.21443215250006814,
+	0.17677669529663689, -0.14892482612310834, -0.072571169313615611, 0.23538601629575523,
+	-0.20786740307563628, 0.012266918581854355, 0.19325261334068441, -0.24250781329863602,
+	0.09567085809127239, 0.12852568604830597, -0.24879618166804926, 0.16788973871175461,
+	0.048772580504032589, -0.22599732328086092, 0.22048031608708882, -0.036682618613840874,
+	-0.17677669529663698, 0.24729412749119514, -0.11784918420649831, -0.10688877335757055,
+	0.24519632010080772, -0.185237781338739, -0.024504285082390095, 0.21443215250006828,
+	-0.23096988312782127, 0.060745044975816107, 0.15859832104091171, -0.24969886405129305,
+	0.13889255825490074, 0.084222463348055332, -0.23923508393305196, 0.20080188287016035,
+	0.17677669529663689, -0.16788973871175461, -0.024504285082390113, 0.20080188287016132,
+	-0.24519632010080764, 0.12852568604830533, 0.072571169313615902, -0.22599732328086086,
+	0.23096988312782174, -0.084222463348054541, -0.11784918420649963, 0.24250781329863599,
+	-0.20786740307563595, 0.036682618613840028, 0.15859832104091151, -0.2496988640512931,
+	0.17677669529663709, 0.01226691858185573, -0.19325261334068486, 0.24729412749119514,
+	-0.13889255825490013, -0.060745044975816231, 0.22048031608708876, -0.23538601629575526,
+	0.095670858091271224, 0.10688877335757149, -0.23923508393305246, 0.21443215250006772,
+	-0.048772580504031722, -0.14892482612310842, 0.2487961816680492, -0.18523778133874003,
+	0.17677669529663689, -0.18523778133873972, 0.024504285082390023, 0.14892482612310831,
+	-0.24519632010080766, 0.21443215250006797, -0.072571169313615638, -0.10688877335757033,
+	0.23096988312782188, -0.23538601629575506, 0.11784918420649923, 0.060745044975816023,
+	-0.20786740307563625, 0.24729412749119514, -0.15859832104091171, -0.012266918581854813,
+	0.17677669529663761, -0.2496988640512931, 0.19325261334068378, -0.036682618613840749,
+	-0.13889255825490091, 0.24250781329863627, -0.22048031608708871, 0.084222463348054236,
+	0.095670858091272251, -0.22599732328086106, 0.23923508393305185, -0.12852568604830372,
+	-0.048772580504031243, 0.20080188287016115, -0.24879618166804915, 0.16788973871175361,
+	0.17677669529663689, -0.20080188287016121, 0.072571169313615513, 0.084222463348055013,
+	-0.20786740307563639, 0.2496988640512931, -0.19325261334068425, 0.060745044975815607,
+	0.095670858091272723, -0.21443215250006814, 0.2487961816680492, -0.18523778133873972,
+	0.048772580504032055, 0.10688877335757127, -0.22048031608708912, 0.24729412749119514,
+	-0.17677669529663645, 0.036682618613839903, 0.11784918420649983, -0.225997323280861,
+	0.24519632010080755, -0.16788973871175442, 0.024504285082389974, 0.12852568604830553,
+	-0.23096988312782171, 0.24250781329863602, -0.1585983210409101, 0.012266918581854691,
+	0.13889255825490182, -0.23538601629575509, 0.23923508393305182, -0.14892482612310873,
+	0.17677669529663689, -0.214432152500068, 0.1178491842064994, 0.012266918581854538,
+	-0.1388925582549006, 0.22599732328086086, -0.2487961816680492, 0.20080188287016118,
+	-0.095670858091272362, -0.036682618613840541, 0.15859832104091146, -0.23538601629575523,
+	0.24519632010080758, -0.18523778133873908, 0.072571169313615444, 0.060745044975817002,
+	-0.176776695296637, 0.24250781329863627, -0.23923508393305215, 0.16788973871175378,
+	-0.04877258050403184, -0.084222463348056081, 0.19325261334068439, -0.24729412749119542,
+	0.23096988312782157, -0.14892482612310881, 0.024504285082388087, 0.1068887733575716,
+	-0.20786740307563648, 0.24969886405129307, -0.22048031608708776, 0.12852568604830436,
+	0.17677669529663689, -0.22599732328086083, 0.1585983210409114, -0.060745044975815697,
+	-0.048772580504032007, 0.14892482612310837, -0.22048031608708904, 0.2496988640512931,
+	-0.23096988312782174, 0.16788973871175461, -0.072571169313615527, -0.036682618613840604,
+	0.13889255825490152, -0.21443215250006775, 0.24879618166804918, -0.23538601629575531,
+	0.17677669529663706, -0.084222463348055152, -0.024504285082390095, 0.12852568604830547,
+	-0.20786740307563639, 0.24729412749119528, -0.23923508393305212, 0.1852377813387395,
+	-0.095670858091270322, -0.012266918581856892, 0.11784918420649847, -0.20080188287016065,
+	0.24519632010080744, -0.24250781329863619, 0.19325261334068466, -0.10688877335757105,
+	0.17677669529663689, -0.23538601629575517, 0.19325261334068417, -0.12852568604830536,
+	0.048772580504031798, 0.036682618613840451, -0.11784918420649958, 0.18523778133874003,
+	-0.23096988312782191, 0.2496988640512931, -0.23923508393305221, 0.2008018828701611,
+	-0.13889255825490024, 0.060745044975816287, 0.02450428508239089, -0.10688877335757055,
+	0.17677669529663767, -0.225997323280861, 0.2487961816680492, -0.24250781329863583,
+	0.20786740307563628, -0.14892482612310745, 0.072571169313615208, 0.012266918581854202,
+	-0.095670858091273153, 0.16788973871175597, -0.22048031608708846, 0.24729412749119531,
+	-0.24519632010080733, 0.2144321525000667, -0.15859832104091132, 0.084222463348053944,
+	0.17677669529663689, -0.24250781329863599, 0.22048031608708871, -0.18523778133873983,
+	0.13889255825490041, -0.084222463348055027, 0.024504285082390342, 0.036682618613840506,
+	-0.095670858091272751, 0.14892482612310881, -0.19325261334068422, 0.22599732328086095,
+	-0.24519632010080752, 0.2496988640512931, -0.23923508393305218, 0.21443215250006781,
+	-0.17677669529663639, 0.12852568604830464, -0.072571169313614445, 0.012266918581854814,
+	0.04877258050403202, -0.10688877335757072, 0.15859832104091176, -0.20080188287016168,
+	0.23096988312782141, -0.24729412749119542, 0.24879618166804923, -0.23538601629575459,
+	0.20786740307563614, -0.16788973871175286, 0.11784918420649869, -0.060745044975816648,
+	0.17677669529663689, -0.24729412749119525, 0.23923508393305221, -0.22599732328086078,
+	0.20786740307563628, -0.1852377813387398, 0.15859832104091112, -0.12852568604830564,
+	0.095670858091272334, -0.060745044975815517, 0.02450428508239022, 0.012266918581855669,
+	-0.04877258050403268, 0.084222463348055096, -0.11784918420649901, 0.14892482612310898,
+	-0.17677669529663706, 0.20080188287016104, -0.22048031608708921, 0.23538601629575534,
+	-0.24519632010080758, 0.24969886405129316, -0.24879618166804898, 0.24250781329863555,
+	-0.23096988312782121, 0.21443215250006764, -0.19325261334068414, 0.16788973871175486,
+	-0.13889255825490129, 0.10688877335756862, -0.072571169313614084, 0.036682618613839417,
+	0.17677669529663689, -0.2496988640512931, 0.24879618166804923, -0.24729412749119525,
+	0.24519632010080761, -0.24250781329863602, 0.23923508393305223, -0.23538601629575506,
+	0.23096988312782171, -0.2259973232808607, 0.22048031608708882, -0.21443215250006739,
+	0.20786740307563639, -0.20080188287016104, 0.19325261334068378, -0.185237781338739,
+	0.176776695296637, -0.16788973871175442, 0.15859832104091084, -0.14892482612310745,
+	0.13889255825490074, -0.12852568604830372, 0.11784918420649729, -0.10688877335757116,
+	0.095670858091272695, -0.08422246334805486, 0.072571169313615028, -0.060745044975814982,
+	0.04877258050403064, -0.03668261861383857, 0.024504285082387844, -0.012266918581855303,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffF32, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffF32, 8)
+#endif
+const float dct_icoeffF32[1024] = {
+	0.176776692f, 0.249698862f, 0.24879618f, 0.247294128f,
+	0.245196313f, 0.242507815f, 0.239235088f, 0.235386014f,
+	0.230969876f, 0.225997329f, 0.220480323f, 0.21443215f,
+	0.207867399f, 0.200801879f, 0.193252608f, 0.18523778f,
+	0.176776692f, 0.167889744f, 0.158598319f, 0.148924828f,
+	0.138892561f, 0.128525689f, 0.117849186f, 0.106888771f,
+	0.0956708565f, 0.0842224658f, 0.0725711659f, 0.0607450455f,
+	0.0487725809f, 0.0366826169f, 0.0245042853f, 0.012266919f,
+	0.176776692f, 0.247294128f, 0.239235088f, 0.225997329f,
+	0.207867399f, 0.18523778f, 0.158598319f, 0.128525689f,
+	0.0956708565f, 0.0607450455f, 0.0245042853f, -0.012266919f,
+	-0.0487725809f, -0.0842224658f, -0.117849186f, -0.148924828f,
+	-0.176776692f, -0.200801879f, -0.220480323f, -0.235386014f,
+	-0.245196313f, -0.249698862f, -0.24879618f, -0.242507815f,
+	-0.230969876f, -0.21443215f, -0.193252608f, -0.167889744f,
+	-0.138892561f, -0.106888771f, -0.0725711659f, -0.0366826169f,
+	0.176776692f, 0.242507815f, 0.220480323f, 0.18523778f,
+	0.138892561f, 0.0842224658f, 0.0245042853f, -0.0366826169f,
+	-0.0956708565f, -0.148924828f, -0.193252608f, -0.225997329f,
+	-0.245196313f, -0.249698862f, -0.239235088f, -0.21443215f,
+	-0.176776692f, -0.128525689f, -0.0725711659f, -0.012266919f,
+	0.0487725809f, 0.106888771f, 0.158598319f, 0.200801879f,
+	0.230969876f, 0.247294128f, 0.24879618f, 0.235386014f,
+	0.207867399f, 0.167889744f, 0.117849186f, 0.0607450455f,
+	0.176776692f, 0.235386014f, 0.193252608f, 0.128525689f,
+	0.0487725809f, -0.0366826169f, -0.117849186f, -0.18523778f,
+	-0.230969876f, -0.249698862f, -0.239235088f, -0.200801879f,
+	-0.138892561f, -0.0607450455f, 0.0245042853f, 0.106888771f,
+	0.176776692f, 0.225997329f, 0.24879618f, 0.242507815f,
+	0.207867399f, 0.148924828f, 0.0725711659f, -0.012266919f,
+	-0.0956708565f, -0.167889744f, -0.220480323f, -0.247294128f,
+	-0.245196313f, -0.21443215f, -0.158598319f, -0.0842224658f,
+	0.176776692f, 0.225997329f, 0.158598319f, 0.0607450455f,
+	-0.0487725809f, -0.148924828f, -0.220480323f, -0.249698862f,
+	-0.230969876f, -0.167889744f, -0.0725711659f, 0.0366826169f,
+	0.138892561f, 0.21443215f, 0.24879618f, 0.235386014f,
+	0.176776692f, 0.0842224658f, -0.0245042853f, -0.128525689f,
+	-0.207867399f, -0.247294128f, -0.239235088f, -0.18523778f,
+	-0.0956708565f, 0.012266919f, 0.117849186f, 0.200801879f,
+	0.245196313f, 0.242507815f, 0.193252608f, 0.106888771f,
+	0.176776692f, 0.21443215f, 0.117849186f, -0.012266919f,
+	-0.138892561f, -0.225997329f, -0.24879618f, -0.200801879f,
+	-0.0956708565f, 0.0366826169f, 0.158598319f, 0.235386014f,
+	0.245196313f, 0.18523778f, 0.0725711659f, -0.0607450455f,
+	-0.176776692f, -0.242507815f, -0.239235088f, -0.167889744f,
+	-0.0487725809f, 0.0842224658f, 0.193252608f, 0.247294128f,
+	0.230969876f, 0.148924828f, 0.0245042853f, -0.106888771f,
+	-0.207867399f, -0.249698862f, -0.220480323f, -0.128525689f,
+	0.176776692f, 0.200801879f, 0.0725711659f, -0.0842224658f,
+	-0.207867399f, -0.249698862f, -0.193252608f, -0.0607450455f,
+	0.0956708565f, 0.21443215f, 0.24879618f, 0.18523778f,
+	0.0487725809f, -0.106888771f, -0.220480323f, -0.247294128f,
+	-0.176776692f, -0.0366826169f, 0.117849186f, 0.225997329f,
+	0.245196313f, 0.167889744f, 0.0245042853f, -0.128525689f,
+	-0.230969876f, -0.242507815f, -0.158598319f, -0.012266919f,
+	0.138892561f, 0.235386014f, 0.239235088f, 0.148924828f,
+	0.176776692f, 0.18523778f, 0.0245042853f, -0.148924828f,
+	-0.245196313f, -0.21443215f, -0.0725711659f, 0.106888771f,
+	0.230969876f, 0.235386014f, 0.117849186f, -0.0607450455f,
+	-0.207867399f, -0.247294128f, -0.158598319f, 0.012266919f,
+	0.176776692f, 0.249698862f, 0.193252608f, 0.0366826169f,
+	-0.138892561f, -0.242507815f, -0.220480323f, -0.0842224658f,
+	0.0956708565f, 0.225997329f, 0.239235088f, 0.128525689f,
+	-0.0487725809f, -0.200801879f, -0.24879618f, -0.167889744f,
+	0.176776692f, 0.167889744f, -0.0245042853f, -0.200801879f,
+	-0.245196313f, -0.128525689f, 0.0725711659f, 0.225997329f,
+	0.230969876f, 0.0842224658f, -0.117849186f, -0.242507815f,
+	-0.207867399f, -0.0366826169f, 0.158598319f, 0.249698862f,
+	0.176776692f, -0.012266919f, -0.193252608f, -0.247294128f,
+	-0.138892561f, 0.0607450455f, 0.220480323f, 0.235386014f,
+	0.0956708565f, -0.106888771f, -0.239235088f, -0.21443215f,
+	-0.0487725809f, 0.148924828f, 0.24879618f, 0.18523778f,
+	0.176776692f, 0.148924828f, -0.0725711659f, -0.235386014f,
+	-0.207867399f, -0.012266919f, 0.193252608f, 0.242507815f,
+	0.0956708565f, -0.128525689f, -0.24879618f, -0.167889744f,
+	0.0487725809f, 0.225997329f, 0.220480323f, 0.0366826169f,
+	-0.176776692f, -0.247294128f, -0.117849186f, 0.106888771f,
+	0.245196313f, 0.18523778f, -0.0245042853f, -0.21443215f,
+	-0.230969876f, -0.0607450455f, 0.158598319f, 0.249698862f,
+	0.138892561f, -0.0842224658f, -0.239235088f, -0.200801879f,
+	0.176776692f, 0.128525689f, -0.117849186f, -0.249698862f,
+	-0.138892561f, 0.106888771f, 0.24879618f, 0.148924828f,
+	-0.0956708565f, -0.247294128f, -0.158598319f, 0.0842224658f,
+	0.245196313f, 0.167889744f, -0.0725711659f, -0.242507815f,
+	-0.176776692f, 0.0607450455f, 0.239235088f, 0.18523778f,
+	-0.0487725809f, -0.235386014f, -0.193252608f, 0.0366826169f,
+	0.230969876f, 0.200801879f, -0.0245042853f, -0.225997329f,
+	-0.207867399f, 0.012266919f, 0.220480323f, 0.21443215f,
+	0.176776692f, 0.106888771f, -0.158598319f, -0.242507815f,
+	-0.0487725809f, 0.200801879f, 0.220480323f, -0.012266919f,
+	-0.230969876f, -0.18523778f, 0.0725711659f, 0.247294128f,
+	0.138892561f, -0.128525689f, -0.24879618f, -0.0842224658f,
+	0.176776692f, 0.235386014f, 0.0245042853f, -0.21443215f,
+	-0.207867399f, 0.0366826169f, 0.239235088f, 0.167889744f,
+	-0.0956708565f, -0.249698862f, -0.117849186f, 0.148924828f,
+	0.245196313f, 0.0607450455f, -0.193252608f, -0.225997329f,
+	0.176776692f, 0.0842224658f, -0.193252608f, -0.21443215f,
+	0.0487725809f, 0.247294128f, 0.117849186f, -0.167889744f,
+	-0.230969876f, 0.012266919f, 0.239235088f, 0.148924828f,
+	-0.138892561f, -0.242507815f, -0.0245042853f, 0.225997329f,
+	0.176776692f, -0.106888771f, -0.24879618f, -0.0607450455f,
+	0.207867399f, 0.200801879f, -0.0725711659f, -0.249698862f,
+	-0.0956708565f, 0.18523778f, 0.220480323f, -0.0366826169f,
+	-0.245196313f, -0.128525689f, 0.158598319f, 0.235386014f,
+	0.176776692f, 0.0607450455f, -0.220480323f, -0.167889744f,
+	0.138892561f, 0.235386014f, -0.0245042853f, -0.247294128f,
+	-0.0956708565f, 0.200801879f, 0.193252608f, -0.106888771f,
+	-0.245196313f, -0.012266919f, 0.239235088f, 0.128525689f,
+	-0.176776692f, -0.21443215f, 0.0725711659f, 0.249698862f,
+	0.0487725809f, -0.225997329f, -0.158598319f, 0.148924828f,
+	0.230969876f, -0.0366826169f, -0.24879618f, -0.0842224658f,
+	0.207867399f, 0.18523778f, -0.117849186f, -0.242507815f,
+	0.176776692f, 0.0366826169f, -0.239235088f, -0.106888771f,
+	0.207867399f, 0.167889744f, -0.158598319f, -0.21443215f,
+	0.0956708565f, 0.242507815f, -0.0245042853f, -0.249698862f,
+	-0.0487725809f, 0.235386014f, 0.117849186f, -0.200801879f,
+	-0.176776692f, 0.148924828f, 0.220480323f, -0.0842224658f,
+	-0.245196313f, 0.012266919f, 0.24879618f, 0.0607450455f,
+	-0.230969876f, -0.128525689f, 0.193252608f, 0.18523778f,
+	-0.138892561f, -0.225997329f, 0.0725711659f, 0.247294128f,
+	0.176776692f, 0.012266919f, -0.24879618f, -0.0366826169f,
+	0.245196313f, 0.0607450455f, -0.239235088f, -0.0842224658f,
+	0.230969876f, 0.106888771f, -0.220480323f, -0.128525689f,
+	0.207867399f, 0.148924828f, -0.193252608f, -0.167889744f,
+	0.176776692f, 0.18523778f, -0.158598319f, -0.200801879f,
+	0.138892561f, 0.21443215f, -0.117849186f, -0.225997329f,
+	0.0956708565f, 0.235386014f, -0.0725711659f, -0.242507815f,
+	0.0487725809f, 0.247294128f, -0.0245042853f, -0.249698862f,
+	0.176776692f, -0.012266919f, -0.24879618f, 0.0366826169f,
+	0.245196313f, -0.0607450455f, -0.239235088f, 0.0842224658f,
+	0.230969876f, -0.106888771f, -0.220480323f, 0.128525689f,
+	0.207867399f, -0.148924828f, -0.193252608f, 0.167889744f,
+	0.176776692f, -0.18523778f, -0.158598319f, 0.200801879f,
+	0.138892561f, -0.21443215f, -0.117849186f, 0.225997329f,
+	0.0956708565f, -0.235386014f, -0.0725711659f, 0.242507815f,
+	0.0487725809f, -0.247294128f, -0.0245042853f, 0.249698862f,
+	0.176776692f, -0.0366826169f, -0.239235088f, 0.106888771f,
+	0.207867399f, -0.167889744f, -0.158598319f, 0.21443215f,
+	0.0956708565f, -0.242507815f, -0.0245042853f, 0.249698862f,
+	-0.0487725809f, -0.235386014f, 0.117849186f, 0.200801879f,
+	-0.176776692f, -0.148924828f, 0.220480323f, 0.0842224658f,
+	-0.245196313f, -0.012266919f, 0.24879618f, -0.0607450455f,
+	-0.230969876f, 0.128525689f, 0.193252608f, -0.18523778f,
+	-0.138892561f, 0.225997329f, 0.0725711659f, -0.247294128f,
+	0.176776692f, -0.0607450455f, -0.220480323f, 0.167889744f,
+	0.138892561f, -0.235386014f, -0.0245042853f, 0.247294128f,
+	-0.0956708565f, -0.200801879f, 0.193252608f, 0.106888771f,
+	-0.245196313f, 0.012266919f, 0.239235088f, -0.128525689f,
+	-0.176776692f, 0.21443215f, 0.0725711659f, -0.249698862f,
+	0.0487725809f, 0.225997329f, -0.158598319f, -0.148924828f,
+	0.230969876f, 0.0366826169f, -0.24879618f, 0.0842224658f,
+	0.207867399f, -0.18523778f, -0.117849186f, 0.242507815f,
+	0.176776692f, -0.0842224658f, -0.193252608f, 0.21443215f,
+	0.0487725809f, -0.247294128f, 0.117849186f, 0.167889744f,
+	-0.230969876f, -0.012266919f, 0.239235088f, -0.148924828f,
+	-0.138892561f, 0.242507815f, -0.0245042853f, -0.225997329f,
+	0.176776692f, 0.106888771f, -0.24879618f, 0.0607450455f,
+	0.207867399f, -0.200801879f, -0.0725711659f, 0.249698862f,
+	-0.0956708565f, -0.18523778f, 0.220480323f, 0.0366826169f,
+	-0.245196313f, 0.128525689f, 0.158598319f, -0.235386014f,
+	0.176776692f, -0.106888771f, -0.158598319f, 0.242507815f,
+	-0.0487725809f, -0.200801879f, 0.220480323f, 0.012266919f,
+	-0.230969876f, 0.18523778f, 0.0725711659f, -0.247294128f,
+	0.138892561f, 0.128525689f, -0.24879618f, 0.0842224658f,
+	0.176776692f, -0.235386014f, 0.0245042853f, 0.21443215f,
+	-0.207867399f, -0.0366826169f, 0.239235088f, -0.167889744f,
+	-0.0956708565f, 0.249698862f, -0.117849186f, -0.148924828f,
+	0.245196313f, -0.0607450455f, -0.193252608f, 0.225997329f,
+	0.176776692f, -0.128525689f, -0.117849186f, 0.249698862f,
+	-0.138892561f, -0.106888771f, 0.24879618f, -0.148924828f,
+	-0.0956708565f, 0.247294128f, -0.158598319f, -0.0842224658f,
+	0.245196313f, -0.167889744f, -0.0725711659f, 0.242507815f,
+	-0.176776692f, -0.0607450455f, 0.239235088f, -0.18523778f,
+	-0.0487725809f, 0.235386014f, -0.193252608f, -0.0366826169f,
+	0.230969876f, -0.200801879f, -0.0245042853f, 0.225997329f,
+	-0.207867399f, -0.012266919f, 0.220480323f, -0.21443215f,
+	0.176776692f, -0.148924828f, -0.0725711659f, 0.235386014f,
+	-0.207867399f, 0.012266919f, 0.193252608f, -0.242507815f,
+	0.0956708565f, 0.128525689f, -0.24879618f, 0.167889744f,
+	0.0487725809f, -0.225997329f, 0.220480323f, -0.0366826169f,
+	-0.176776692f, 0.247294128f, -0.117849186f, -0.106888771f,
+	0.245196313f, -0.18523778f, -0.0245042853f, 0.21443215f,
+	-0.230969876f, 0.0607450455f, 0.158598319f, -0.249698862f,
+	0.138892561f, 0.0842224658f, -0.239235088f, 0.200801879f,
+	0.176776692f, -0.167889744f, -0.0245042853f, 0.200801879f,
+	-0.245196313f, 0.128525689f, 0.0725711659f, -0.225997329f,
+	0.230969876f, -0.0842224658f, -0.117849186f, 0.242507815f,
+	-0.207867399f, 0.0366826169f, 0.158598319f, -0.249698862f,
+	0.176776692f, 0.012266919f, -0.193252608f, 0.247294128f,
+	-0.138892561f, -0.0607450455f, 0.220480323f, -0.235386014f,
+	0.0956708565f, 0.106888771f, -0.239235088f, 0.21443215f,
+	-0.0487725809f, -0.148924828f, 0.24879618f, -0.18523778f,
+	0.176776692f, -0.18523778f, 0.0245042853f, 0.148924828f,
+	-0.245196313f, 0.21443215f, -0.0725711659f, -0.106888771f,
+	0.230969876f, -0.235386014f, 0.117849186f, 0.0607450455f,
+	-0.207867399f, 0.247294128f, -0.158598319f, -0.012266919f,
+	0.176776692f, -0.249698862f, 0.193252608f, -0.0366826169f,
+	-0.138892561f, 0.242507815f, -0.220480323f, 0.0842224658f,
+	0.0956708565f, -0.225997329f, 0.239235088f, -0.128525689f,
+	-0.0487725809f, 0.200801879f, -0.24879618f, 0.167889744f,
+	0.176776692f, -0.200801879f, 0.0725711659f, 0.0842224658f,
+	-0.207867399f, 0.249698862f, -0.193252608f, 0.0607450455f,
+	0.0956708565f, -0.21443215f, 0.24879618f, -0.18523778f,
+	0.0487725809f, 0.106888771f, -0.220480323f, 0.247294128f,
+	-0.176776692f, 0.0366826169f, 0.117849186f, -0.225997329f,
+	0.245196313f, -0.167889744f, 0.0245042853f, 0.128525689f,
+	-0.230969876f, 0.242507815f, -0.158598319f, 0.012266919f,
+	0.138892561f, -0.235386014f, 0.239235088f, -0.148924828f,
+	0.176776692f, -0.21443215f, 0.117849186f, 0.012266919f,
+	-0.138892561f, 0.225997329f, -0.24879618f, 0.200801879f,
+	-0.0956708565f, -0.0366826169f, 0.158598319f, -0.235386014f,
+	0.245196313f, -0.18523778f, 0.0725711659f, 0.0607450455f,
+	-0.176776692f, 0.242507815f, -0.239235088f, 0.167889744f,
+	-0.0487725809f, -0.0842224658f, 0.193252608f, -0.247294128f,
+	0.230969876f, -0.148924828f, 0.0245042853f, 0.106888771f,
+	-0.207867399f, 0.249698862f, -0.220480323f, 0.128525689f,
+	0.176776692f, -0.225997329f, 0.158598319f, -0.0607450455f,
+	-0.0487725809f, 0.148924828f, -0.220480323f, 0.249698862f,
+	-0.230969876f, 0.167889744f, -0.0725711659f, -0.0366826169f,
+	0.138892561f, -0.21443215f, 0.24879618f, -0.235386014f,
+	0.176776692f, -0.0842224658f, -0.0245042853f, 0.128525689f,
+	-0.207867399f, 0.247294128f, -0.239235088f, 0.18523778f,
+	-0.0956708565f, -0.012266919f, 0.117849186f, -0.200801879f,
+	0.245196313f, -0.242507815f, 0.193252608f, -0.106888771f,
+	0.176776692f, -0.235386014f, 0.193252608f, -0.128525689f,
+	0.0487725809f, 0.0366826169f, -0.117849186f, 0.18523778f,
+	-0.230969876f, 0.249698862f, -0.239235088f, 0.200801879f,
+	-0.138892561f, 0.0607450455f, 0.0245042853f, -0.106888771f,
+	0.176776692f, -0.225997329f, 0.24879618f, -0.242507815f,
+	0.207867399f, -0.148924828f, 0.0725711659f, 0.012266919f,
+	-0.0956708565f, 0.167889744f, -0.220480323f, 0.247294128f,
+	-0.245196313f, 0.21443215f, -0.158598319f, 0.0842224658f,
+	0.176776692f, -0.242507815f, 0.220480323f, -0.18523778f,
+	0.138892561f, -0.0842224658f, 0.0245042853f, 0.0366826169f,
+	-0.0956708565f, 0.148924828f, -0.193252608f, 0.225997329f,
+	-0.245196313f, 0.249698862f, -0.239235088f, 0.21443215f,
+	-0.176776692f, 0.128525689f, -0.0725711659f, 0.012266919f,
+	0.0487725809f, -0.106888771f, 0.158598319f, -0.200801879f,
+	0.230969876f, -0.247294128f, 0.24879618f, -0.235386014f,
+	0.207867399f, -0.167889744f, 0.117849186f, -0.0607450455f,
+	0.176776692f, -0.247294128f, 0.239235088f, -0.225997329f,
+	0.207867399f, -0.18523778f, 0.158598319f, -0.128525689f,
+	0.0956708565f, -0.0607450455f, 0.0245042853f, 0.012266919f,
+	-0.0487725809f, 0.0842224658f, -0.117849186f, 0.148924828f,
+	-0.176776692f, 0.200801879f, -0.220480323f, 0.235386014f,
+	-0.245196313f, 0.249698862f, -0.24879618f, 0.242507815f,
+	-0.230969876f, 0.21443215f, -0.193252608f, 0.167889744f,
+	-0.138892561f, 0.106888771f, -0.0725711659f, 0.0366826169f,
+	0.176776692f, -0.249698862f, 0.24879618f, -0.247294128f,
+	0.245196313f, -0.242507815f, 0.239235088f, -0.235386014f,
+	0.230969876f, -0.225997329f, 0.220480323f, -0.21443215f,
+	0.207867399f, -0.200801879f, 0.193252608f, -0.18523778f,
+	0.176776692f, -0.167889744f, 0.158598319f, -0.148924828f,
+	0.138892561f, -0.128525689f, 0.117849186f, -0.106888771f,
+	0.0956708565f, -0.0842224658f, 0.0725711659f, -0.0607450455f,
+	0.0487725809f, -0.0366826169f, 0.0245042853f, -0.012266919f,
+};
+
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_icoeffQ15_32, ".const:dct")
+#pragma DATA_ALIGN(dct_icoeffQ15_32, 8)
+#endif
+const short dct_icoeffQ15_32[1024] = {
+	5793, 8182, 8153, 8103, 8035, 7946, 7839, 7713,
+	7568, 7405, 7225, 7027, 6811, 6580, 6333, 6070,
+	5793, 5501, 5197, 4880, 4551, 4212, 3862, 3503,
+	3135, 2760, 2378, 1990, 1598, 1202, 803, 402,
+	5793, 8103, 7839, 7405, 6811, 6070, 5197, 4212,
+	3135, 1990, 803, -402, -1598, -2760, -3862, -4880,
+	-5793, -6580, -7225, -7713, -8035, -8182, -8153, -7946,
+	-7568, -7027, -6333, -5501, -4551, -3503, -2378, -1202,
+	5793, 7946, 7225, 6070, 4551, 2760, 803, -1202,
+	-3135, -4880, -6333, -7405, -8035, -8182, -7839, -7027,
+	-5793, -4212, -2378, -402, 1598, 3503, 5197, 6580,
+	7568, 8103, 8153, 7713, 6811, 5501, 3862, 1990,
+	5793, 7713, 6333, 4212, 1598, -1202, -3862, -6070,
+	-7568, -8182, -7839, -6580, -4551, -1990, 803, 3503,
+	5793, 7405, 8153, 7946, 6811, 4880, 2378, -402,
+	-3135, -5501, -7225, -8103, -8035, -7027, -5197, -2760,
+	5793, 7405, 5197, 1990, -1598, -4880, -7225, -8182,
+	-7568, -5501, -2378, 1202, 4551, 7027, 8153, 7713,
+	5793, 2760, -803, -4212, -6811, -8103, -7839, -6070,
+	-3135, 402, 3862, 6580, 8035, 7946, 6333, 3503,
+	5793, 7027, 3862, -402, -4551, -7405, -8153, -6580,
+	-3135, 1202, 5197, 7713, 8035, 6070, 2378, -1990,
+	-5793, -7946, -7839, -5501, -1598, 2760, 6333, 8103,
+	7568, 4880, 803, -3503, -6811, -8182, -7225, -4212,
+	5793, 6580, 2378, -2760, -6811, -8182, -6333, -1990,
+	3135, 7027, 8153, 6070, 1598, -3503, -7225, -8103,
+	-5793, -1202, 3862, 7405, 8035, 5501, 803, -4212,
+	-7568, -7946, -5197, -402, 4551, 7713, 7839, 4880,
+	5793, 6070, 803, -4880, -8035, -7027, -2378, 3503,
+	7568, 7713, 3862, -1990, -6811, -8103, -5197, 402,
+	5793, 8182, 6333, 1202, -4551, -7946, -7225, -2760,
+	3135, 7405, 7839, 4212, -1598, -6580, -8153, -5501,
+	5793, 5501, -803, -6580, -8035, -4212, 2378, 7405,
+	7568, 2760, -3862, -7946, -6811, -1202, 5197, 8182,
+	5793, -402, -6333, -8103, -4551, 1990, 7225, 7713,
+	3135, -3503, -7839, -7027, -1598, 4880, 8153, 6070,
+	5793, 4880, -2378, -7713, -6811, -402, 6333, 7946,
+	3135, -4212, -8153, -5501, 1598, 7405, 7225, 1202,
+	-5793, -8103, -3862, 3503, 8035, 6070, -803, -7027,
+	-7568, -1990, 5197, 8182, 4551, -2760, -7839, -6580,
+	5793, 4212, -3862, -8182, -4551, 3503, 8153, 4880,
+	-3135, -8103, -5197, 2760, 8035, 5501, -2378, -7946,
+	-5793, 1990, 7839, 6070, -1598, -7713, -6333, 1202,
+	7568, 6580, -803, -7405, -6811, 402, 7225, 7027,
+	5793, 3503, -5197, -7946, -1598, 6580, 7225, -402,
+	-7568, -6070, 2378, 8103, 4551, -4212, -8153, -2760,
+	5793, 7713, 803, -7027, -6811, 1202, 7839, 5501,
+	-3135, -8182, -3862, 4880, 8035, 1990, -6333, -7405,
+	5793, 2760, -6333, -7027, 1598, 8103, 3862, -5501,
+	-7568, 402, 7839, 4880, -4551, -7946, -803, 7405,
+	5793, -3503, -8153, -1990, 6811, 6580, -2378, -8182,
+	-3135, 6070, 7225, -1202, -8035, -4212, 5197, 7713,
+	5793, 1990, -7225, -5501, 4551, 7713, -803, -8103,
+	-3135, 6580, 6333, -3503, -8035, -402, 7839, 4212,
+	-5793, -7027, 2378, 8182, 1598, -7405, -5197, 4880,
+	7568, -1202, -8153, -2760, 6811, 6070, -3862, -7946,
+	5793, 1202, -7839, -3503, 6811, 5501, -5197, -7027,
+	3135, 7946, -803, -8182, -1598, 7713, 3862, -6580,
+	-5793, 4880, 7225, -2760, -8035, 402, 8153, 1990,
+	-7568, -4212, 6333, 6070, -4551, -7405, 2378, 8103,
+	5793, 402, -8153, -1202, 8035, 1990, -7839, -2760,
+	7568, 3503, -7225, -4212, 6811, 4880, -6333, -5501,
+	5793, 6070, -5197, -6580, 4551, 7027, -3862, -7405,
+	3135, 7713, -2378, -7946, 1598, 8103, -803, -8182,
+	5793, -402, -8153, 1202, 8035, -1990, -7839, 2760,
+	7568, -3503, -7225, 4212, 6811, -4880, -6333, 5501,
+	5793, -6070, -5197, 6580, 4551, -7027, -3862, 7405,
+	3135, -7713, -2378, 7946, 1598, -8103, -803, 8182,
+	5793, -1202, -7839, 3503, 6811, -5501, -5197, 7027,
+	3135, -7946, -803, 8182, -1598, -7713, 3862, 6580,
+	-5793, -4880, 7225, 2760, -8035, -402, 8153, -1990,
+	-7568, 4212, 6333, -6070, -4551, 7405, 2378, -8103,
+	5793, -1990, -7225, 5501, 4551, -7713, -803, 8103,
+	-3135, -6580, 6333, 3503, -8035, 402, 7839, -4212,
+	-5793, 7027, 2378, -8182, 1598, 7405, -5197, -4880,
+	7568, 1202, -8153, 2760, 6811, -6070, -3862, 7946,
+	5793, -2760, -6333, 7027, 1598, -8103, 3862, 5501,
+	-7568, -402, 7839, -4880, -4551, 7946, -803, -7405,
+	5793, 3503, -8153, 1990, 6811, -6580, -2378, 8182,
+	-3135, -6070, 7225, 1202, -8035, 4212, 5197, -7713,
+	5793, -3503, -5197, 7946, -1598, -6580, 7225, 402,
+	-7568, 6070, 2378, -8103, 4551, 4212, -8153, 2760,
+	5793, -7713, 803, 7027, -6811, -1202, 7839, -5501,
+	-3135, 8182, -3862, -4880, 8035, -1990, -6333, 7405,
+	5793, -4212, -3862, 8182, -4551, -3503, 8153, -4880,
+	-3135, 8103, -5197, -2760, 8035, -5501, -2378, 7946,
+	-5793, -1990, 7839, -6070, -1598, 7713, -6333, -1202,
+	7568, -6580, -803, 7405, -6811, -402, 7225, -7027,
+	5793, -4880, -2378, 7713, -6811, 402, 6333, -7946,
+	3135, 4212, -8153, 5501, 1598, -7405, 7225, -1202,
+	-5793, 8103, -3862, -3503, 8035, -6070, -803, 7027,
+	-7568, 1990, 5197, -8182, 4551, 2760, -7839, 6580,
+	5793, -5501, -803, 6580, -8035, 4212, 2378, -7405,
+	7568, -2760, -3862, 7946, -6811, 1202, 5197, -8182,
+	5793, 402, -6333, 8103, -4551, -1990, 7225, -7713,
+	3135, 3503, -7839, 7027, -1598, -4880, 8153, -6070,
+	5793, -6070, 803, 4880, -8035, 7027, -2378, -3503,
+	7568, -7713, 3862, 1990, -6811, 8103, -5197, -402,
+	5793, -8182, 6333, -1202, -4551, 7946, -7225, 2760,
+	3135, -7405, 7839, -4212, -1598, 6580, -8153, 5501,
+	5793, -6580, 2378, 2760, -6811, 8182, -6333, 1990,
+	3135, -7027, 8153, -6070, 1598, 3503, -7225, 8103,
+	-5793, 1202, 3862, -7405, 8035, -5501, 803, 4212,
+	-7568, 7946, -5197, 402, 4551, -7713, 7839, -4880,
+	5793, -7027, 3862, 402, -4551, 7405, -8153, 6580,
+	-3135, -1202, 5197, -7713, 8035, -6070, 2378, 1990,
+	-5793, 7946, -7839, 5501, -1598, -2760, 6333, -8103,
+	7568, -4880, 803, 3503, -6811, 8182, -7225, 4212,
+	5793, -7405, 5197, -1990, -1598, 4880, -7225, 8182,
+	-7568, 5501, -2378, -1202, 4551, -7027, 8153, -7713,
+	5793, -2760, -803, 4212, -6811, 8103, -7839, 6070,
+	-3135, -402, 3862, -6580, 8035, -7946, 6333, -3503,
+	5793, -7713, 6333, -4212, 1598, 1202, -3862, 6070,
+	-7568, 8182, -7839, 6580, -4551, 1990, 803, -3503,
+	5793, -7405, 8153, -7946, 6811, -4880, 2378, 402,
+	-3135, 5501, -7225, 8103, -8035, 7027, -5197, 2760,
+	5793, -7946, 7225, -6070, 4551, -2760, 803, 1202,
+	-3135, 4880, -6333, 7405, -8035, 8182, -7839, 7027,
+	-5793, 4212, -2378, 402, 1598, -3503, 5197, -6580,
+	7568, -8103, 8153, -7713, 6811, -5501, 3862, -1990,
+	5793, -8103, 7839, -7405, 6811, -6070, 5197, -4212,
+	3135, -1990, 803, 402, -1598, 2760, -3862, 4880,
+	-5793, 6580, -7225, 7713, -8035, 8182, -8153, 7946,
+	-7568, 7027, -6333, 5501, -4551, 3503, -2378, 1202,
+	5793, -8182, 8153, -8103, 8035, -7946, 7839, -7713,
+	7568, -7405, 7225, -7027, 6811, -6580, 6333, -6070,
+	5793, -5501, 5197, -4880, 4551, -4212, 3862, -3503,
+	3135, -2760, 2378, -1990, 1598, -1202, 803, -402,
+};
+
+/* fast 16-point DCT odd part, cos((2n+1)(2m+1)pi/32) */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_fastOdd16, ".const:dct")
+#pragma DATA_ALIGN(dct_fastOdd16, 8)
+#endif
+const double dct_fastOdd16[64] = {
+	0.99518472667219693, 0.95694033573220882, 0.88192126434835505, 0.77301045336273699,
+	0.63439328416364549, 0.47139673682599781, 0.29028467725446233, 0.09801714032956077,
+	0.95694033573220882, 0.63439328416364549, 0.09801714032956077, -0.4713967368259977,
+	-0.88192126434835494, -0.99518472667219693, -0.7730104533627371, -0.29028467725446244,
+	0.88192126434835505, 0.09801714032956077, -0.77301045336273699, -0.95694033573220894,
+	-0.29028467725446244, 0.6343932841636456, 0.99518472667219693, 0.47139673682599798,
+	0.77301045336273699, -0.4713967368259977, -0.95694033573220894, 0.09801714032956009,
+	0.99518472667219693, 0.29028467725446255, -0.88192126434835483, -0.63439328416364538,
+	0.63439328416364549, -0.88192126434835494, -0.29028467725446244, 0.99518472667219693,
+	-0.098017140329559965, -0.95694033573220871, 0.47139673682599736, 0.77301045336273766,
+	0.47139673682599781, -0.99518472667219693, 0.6343932841636456, 0.29028467725446255,
+	-0.95694033573220871, 0.77301045336273699, 0.098017140329560812, -0.88192126434835616,
+	0.29028467725446233, -0.7730104533627371, 0.99518472667219693, -0.88192126434835483,
+	0.47139673682599736, 0.098017140329560812, -0.6343932841636456, 0.95694033573220938,
+	0.09801714032956077, -0.29028467725446244, 0.47139673682599798, -0.63439328416364538,
+	0.77301045336273766, -0.88192126434835616, 0.95694033573220938, -0.99518472667219704,
+};
+
+/* fast 8 x 8 DCT descale factors */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_fastDescale8, ".const:dct")
+#pragma DATA_ALIGN(dct_fastDescale8, 8)
+#endif
+const double dct_fastDescale8[64] = {
+	0.12499999999999997, 0.090119977750868482, 0.095670858091272418, 0.10630376184590706,
+	0.12500000000000006, 0.15909482257160421, 0.23096988312782168, 0.45306372317644383,
+	0.090119977750868482, 0.064972883118536259, 0.068974844820735751, 0.076640741219094144,
+	0.090119977750868524, 0.11470097496345075, 0.16652000582879992, 0.32664074121909414,
+	0.095670858091272418, 0.068974844820735751, 0.073223304703363107, 0.081361376913025571,
+	0.095670858091272473, 0.12176590554643291, 0.17677669529663689, 0.34675996133053683,
+	0.10630376184590706, 0.076640741219094144, 0.081361376913025571, 0.090403918260730617,
+	0.1063037618459071, 0.13529902503654925, 0.19642373959677559, 0.38529902503654928,
+	0.12500000000000006, 0.090119977750868524, 0.095670858091272473, 0.1063037618459071,
+	0.12500000000000011, 0.15909482257160429, 0.23096988312782182, 0.45306372317644411,
+	0.15909482257160421, 0.11470097496345075, 0.12176590554643291, 0.13529902503654925,
+	0.15909482257160429, 0.20248930055272182, 0.29396890060483971, 0.57664074121909403,
+	0.23096988312782168, 0.16652000582879992, 0.17677669529663689, 0.19642373959677559,
+	0.23096988312782182, 0.29396890060483971, 0.42677669529663698, 0.83715260153215221,
+	0.45306372317644383, 0.32664074121909414, 0.34675996133053683, 0.38529902503654928,
+	0.45306372317644411, 0.57664074121909403, 0.83715260153215221, 1.6421338980680111,
+};
+
+/* fast 8 x 8 inverse DCT prescale factors */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_fastPrescale8, ".const:dct")
+#pragma DATA_ALIGN(dct_fastPrescale8, 8)
+#endif
+const double dct_fastPrescale8[64] = {
+	0.12500000000000003, 0.17337998066526844, 0.16332037060954707, 0.14698445030241986,
+	0.12500000000000003, 0.098211869798387794, 0.06764951251827464, 0.034487422410367889,
+	0.17337998066526844, 0.24048494156391081, 0.22653186158822192, 0.2038732892122293,
+	0.17337998066526844, 0.13622377669395469, 0.093832569379466324, 0.047835429045636237,
+	0.16332037060954707, 0.22653186158822192, 0.21338834764831843, 0.19204443917785408,
+	0.16332037060954707, 0.12831999178983422, 0.088388347648318447, 0.045059988875434255,
+	0.14698445030241986, 0.2038732892122293, 0.19204443917785408, 0.1728354290456362,
+	0.14698445030241986, 0.11548494156391086, 0.07954741128580213, 0.040552918602682224,
+	0.12500000000000003, 0.17337998066526844, 0.16332037060954707, 0.14698445030241986,
+	0.12500000000000003, 0.098211869798387794, 0.06764951251827464, 0.034487422410367889,
+	0.098211869798387794, 0.13622377669395469, 0.12831999178983422, 0.11548494156391086,
+	0.098211869798387794, 0.077164570954363798, 0.053151880922953545, 0.027096593915592413,
+	0.06764951251827464, 0.093832569379466324, 0.088388347648318447, 0.07954741128580213,
+	0.06764951251827464, 0.053151880922953545, 0.036611652351681567, 0.01866445851258566,
+	0.034487422410367889, 0.047835429045636237, 0.045059988875434255, 0.040552918602682224,
+	0.034487422410367889, 0.027096593915592413, 0.01866445851258566, 0.0095150584360891594,
+};
+
+/* fast 16 x 16 DCT descale factors */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_fastDescale16, ".const:dct")
+#pragma DATA_ALIGN(dct_fastDescale16, 8)
+#endif
+const double dct_fastDescale16[256] = {
+	0.0625, 0.088388347648318447, 0.045059988875434241, 0.088388347648318447,
+	0.047835429045636223, 0.088388347648318433, 0.053151880922953532, 0.088388347648318433,
+	0.062500000000000042, 0.088388347648318405, 0.079547411285802144, 0.088388347648318419,
+	0.11548494156391086, 0.088388347648318433, 0.22653186158822197, 0.088388347648318377,
+	0.088388347648318447, 0.12500000000000003, 0.063724447388019897, 0.12500000000000003,
+	0.067649512518274627, 0.125, 0.075168110866880675, 0.125,
+	0.088388347648318502, 0.12499999999999997, 0.112497027892052, 0.12499999999999997,
+	0.1633203706095471, 0.125, 0.3203644309676883, 0.12499999999999992,
+	0.045059988875434241, 0.063724447388019897, 0.032486441559268123, 0.063724447388019897,
+	0.034487422410367875, 0.063724447388019884, 0.038320370609547065, 0.063724447388019884,
+	0.045059988875434269, 0.06372444738801987, 0.057350487481725387, 0.06372444738801987,
+	0.083260002914399958, 0.063724447388019884, 0.16332037060954707, 0.063724447388019842,
+	0.088388347648318447, 0.12500000000000003, 0.063724447388019897, 0.12500000000000003,
+	0.067649512518274627, 0.125, 0.075168110866880675, 0.125,
+	0.088388347648318502, 0.12499999999999997, 0.112497027892052, 0.12499999999999997,
+	0.1633203706095471, 0.125, 0.3203644309676883, 0.12499999999999992,
+	0.047835429045636223, 0.067649512518274627, 0.034487422410367875, 0.067649512518274627,
+	0.036611652351681553, 0.067649512518274613, 0.040680688456512785, 0.067649512518274613,
+	0.04783542904563625, 0.067649512518274585, 0.060882952773216481, 0.067649512518274613,
+	0.088388347648318447, 0.067649512518274613, 0.17337998066526844, 0.067649512518274571,
+	0.088388347648318433, 0.125, 0.063724447388019884, 0.125,
+	0.067649512518274613, 0.12499999999999997, 0.075168110866880661, 0.12499999999999997,
+	0.088388347648318488, 0.12499999999999994, 0.11249702789205197, 0.12499999999999997,
+	0.16332037060954707, 0.12499999999999997, 0.32036443096768824, 0.12499999999999992,
+	0.053151880922953532, 0.075168110866880675, 0.038320370609547065, 0.075168110866880675,
+	0.040680688456512785, 0.075168110866880661, 0.045201959130365302, 0.075168110866880661,
+	0.053151880922953573, 0.075168110866880647, 0.06764951251827464, 0.075168110866880647,
+	0.098211869798387794, 0.075168110866880661, 0.19264951251827464, 0.075168110866880605,
+	0.088388347648318433, 0.125, 0.063724447388019884, 0.125,
+	0.067649512518274613, 0.12499999999999997, 0.075168110866880661, 0.12499999999999997,
+	0.088388347648318488, 0.12499999999999994, 0.11249702789205197, 0.12499999999999997,
+	0.16332037060954707, 0.12499999999999997, 0.32036443096768824, 0.12499999999999992,
+	0.062500000000000042, 0.088388347648318502, 0.045059988875434269, 0.088388347648318502,
+	0.04783542904563625, 0.088388347648318488, 0.053151880922953573, 0.088388347648318488,
+	0.062500000000000083, 0.08838834764831846, 0.0795474112858022, 0.088388347648318474,
+	0.11548494156391094, 0.088388347648318488, 0.22653186158822211, 0.088388347648318433,
+	0.088388347648318405, 0.12499999999999997, 0.06372444738801987, 0.12499999999999997,
+	0.067649512518274585, 0.12499999999999994, 0.075168110866880647, 0.12499999999999994,
+	0.08838834764831846, 0.12499999999999992, 0.11249702789205195, 0.12499999999999992,
+	0.16332037060954704, 0.12499999999999994, 0.32036443096768819, 0.12499999999999986,
+	0.079547411285802144, 0.112497027892052, 0.057350487481725387, 0.112497027892052,
+	0.060882952773216481, 0.11249702789205197, 0.06764951251827464, 0.11249702789205197,
+	0.0795474112858022, 0.11249702789205195, 0.10124465027636098, 0.11249702789205197,
+	0.14698445030241988, 0.11249702789205197, 0.28832037060954713, 0.1124970278920519,
+	0.088388347648318419, 0.12499999999999997, 0.06372444738801987, 0.12499999999999997,
+	0.067649512518274613, 0.12499999999999997, 0.075168110866880647, 0.12499999999999997,
+	0.088388347648318474, 0.12499999999999992, 0.11249702789205197, 0.12499999999999994,
+	0.16332037060954707, 0.12499999999999997, 0.32036443096768824, 0.12499999999999989,
+	0.11548494156391086, 0.1633203706095471, 0.083260002914399958, 0.1633203706095471,
+	0.088388347648318447, 0.16332037060954707, 0.098211869798387794, 0.16332037060954707,
+	0.11548494156391094, 0.16332037060954704, 0.14698445030241988, 0.16332037060954707,
+	0.21338834764831852, 0.16332037060954707, 0.4185763007660761, 0.16332037060954696,
+	0.088388347648318433, 0.125, 0.063724447388019884, 0.125,
+	0.067649512518274613, 0.12499999999999997, 0.075168110866880661, 0.12499999999999997,
+	0.088388347648318488, 0.12499999999999994, 0.11249702789205197, 0.12499999999999997,
+	0.16332037060954707, 0.12499999999999997, 0.32036443096768824, 0.12499999999999992,
+	0.22653186158822197, 0.3203644309676883, 0.16332037060954707, 0.3203644309676883,
+	0.17337998066526844, 0.32036443096768824, 0.19264951251827464, 0.32036443096768824,
+	0.22653186158822211, 0.32036443096768819, 0.28832037060954713, 0.32036443096768824,
+	0.4185763007660761, 0.32036443096768824, 0.82106694903400579, 0.32036443096768807,
+	0.088388347648318377, 0.12499999999999992, 0.063724447388019842, 0.12499999999999992,
+	0.067649512518274571, 0.12499999999999992, 0.075168110866880605, 0.12499999999999992,
+	0.088388347648318433, 0.12499999999999986, 0.1124970278920519, 0.12499999999999989,
+	0.16332037060954696, 0.12499999999999992, 0.32036443096768807, 0.12499999999999983,
+};
+
+/* fast 16 x 16 inverse DCT prescale factors */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_fastPrescale16, ".const:dct")
+#pragma DATA_ALIGN(dct_fastPrescale16, 8)
+#endif
+const double dct_fastPrescale16[256] = {
+	0.0625, 0.088388347648318447, 0.08668999033263422, 0.088388347648318447,
+	0.081660185304773536, 0.088388347648318447, 0.073492225151209928, 0.088388347648318447,
+	0.062500000000000014, 0.088388347648318447, 0.049105934899193897, 0.088388347648318447,
+	0.03382475625913732, 0.088388347648318447, 0.017243711205183945, 0.088388347648318433,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.08668999033263422, 0.12259816005040383, 0.12024247078195544, 0.12259816005040383,
+	0.11326593079411099, 0.12259816005040383, 0.10193664460611467, 0.12259816005040383,
+	0.086689990332634234, 0.12259816005040383, 0.068111888346977345, 0.12259816005040383,
+	0.046916284689733169, 0.12259816005040383, 0.023917714522818122, 0.1225981600504038,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.081660185304773536, 0.11548494156391086, 0.11326593079411099, 0.11548494156391086,
+	0.10669417382415922, 0.11548494156391086, 0.096022219588927038, 0.11548494156391086,
+	0.08166018530477355, 0.11548494156391086, 0.06415999589491711, 0.11548494156391086,
+	0.04419417382415923, 0.11548494156391086, 0.022529994437717128, 0.11548494156391084,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.073492225151209928, 0.10393370153781817, 0.10193664460611467, 0.10393370153781817,
+	0.096022219588927038, 0.10393370153781817, 0.086417714522818115, 0.10393370153781817,
+	0.073492225151209942, 0.10393370153781817, 0.057742470781955442, 0.10393370153781817,
+	0.039773705642901072, 0.10393370153781817, 0.020276459301341115, 0.10393370153781815,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.062500000000000014, 0.08838834764831846, 0.086689990332634234, 0.08838834764831846,
+	0.08166018530477355, 0.08838834764831846, 0.073492225151209942, 0.08838834764831846,
+	0.062500000000000028, 0.08838834764831846, 0.049105934899193904, 0.08838834764831846,
+	0.033824756259137327, 0.08838834764831846, 0.017243711205183948, 0.088388347648318447,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.049105934899193897, 0.0694462791274503, 0.068111888346977345, 0.0694462791274503,
+	0.06415999589491711, 0.0694462791274503, 0.057742470781955442, 0.0694462791274503,
+	0.049105934899193904, 0.0694462791274503, 0.038582285477181906, 0.0694462791274503,
+	0.026575940461476776, 0.0694462791274503, 0.01354829695779621, 0.069446279127450286,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.03382475625913732, 0.047835429045636237, 0.046916284689733169, 0.047835429045636237,
+	0.04419417382415923, 0.047835429045636237, 0.039773705642901072, 0.047835429045636237,
+	0.033824756259137327, 0.047835429045636237, 0.026575940461476776, 0.047835429045636237,
+	0.018305826175840791, 0.047835429045636237, 0.0093322292562928299, 0.04783542904563623,
+	0.088388347648318447, 0.12500000000000003, 0.12259816005040383, 0.12500000000000003,
+	0.11548494156391086, 0.12500000000000003, 0.10393370153781817, 0.12500000000000003,
+	0.08838834764831846, 0.12500000000000003, 0.0694462791274503, 0.12500000000000003,
+	0.047835429045636237, 0.12500000000000003, 0.024386290252016045, 0.125,
+	0.017243711205183945, 0.024386290252016045, 0.023917714522818122, 0.024386290252016045,
+	0.022529994437717128, 0.024386290252016045, 0.020276459301341115, 0.024386290252016045,
+	0.017243711205183948, 0.024386290252016045, 0.01354829695779621, 0.024386290252016045,
+	0.0093322292562928299, 0.024386290252016045, 0.0047575292180445806, 0.024386290252016041,
+	0.088388347648318433, 0.125, 0.1225981600504038, 0.125,
+	0.11548494156391084, 0.125, 0.10393370153781815, 0.125,
+	0.088388347648318447, 0.125, 0.069446279127450286, 0.125,
+	0.04783542904563623, 0.125, 0.024386290252016041, 0.12499999999999997,
+};
+
+/* 8 x 8 zigzag scan, row-major index of each position */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_zigzag8, ".const:dct")
+#pragma DATA_ALIGN(dct_zigzag8, 8)
+#endif
+const unsigned char dct_zigzag8[64] = {
+	0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/* 16 x 16 zigzag scan, row-major index of each position */
+#ifdef _TMS320C6X
+#pragma DATA_SECTION(dct_zigzag16, ".const:dct")
+#pragma DATA_ALIGN(dct_zigzag16, 8)
+#endif
+const unsigned char dct_zigzag16[256] = {
+	0, 1, 16, 32, 17, 2, 3, 18, 33, 48, 64, 49, 34, 19, 4, 5,
+	20, 35, 50, 65, 80, 96, 81, 66, 51, 36, 21, 6, 7, 22, 37, 52,
+	67, 82, 97, 112, 128, 113, 98, 83, 68, 53, 38, 23, 8, 9, 24, 39,
+	54, 69, 84, 99, 114, 129, 144, 160, 145, 130, 115, 100, 85, 70, 55, 40,
+	25, 10, 11, 26, 41, 56, 71, 86, 101, 116, 131, 146, 161, 176, 192, 177,
+	162, 147, 132, 117, 102, 87, 72, 57, 42, 27, 12, 13, 28, 43, 58, 73,
+	88, 103, 118, 133, 148, 163, 178, 193, 208, 224, 209, 194, 179, 164, 149, 134,
+	119, 104, 89, 74, 59, 44, 29, 14, 15, 30, 45, 60, 75, 90, 105, 120,
+	135, 150, 165, 180, 195, 210, 225, 240, 241, 226, 211, 196, 181, 166, 151, 136,
+	121, 106, 91, 76, 61, 46, 31, 47, 62, 77, 92, 107, 122, 137, 152, 167,
+	182, 197, 212, 227, 242, 243, 228, 213, 198, 183, 168, 153, 138, 123, 108, 93,
+	78, 63, 79, 94, 109, 124, 139, 154, 169, 184, 199, 214, 229, 244, 245, 230,
+	215, 200, 185, 170, 155, 140, 125, 110, 95, 111, 126, 141, 156, 171, 186, 201,
+	216, 231, 246, 247, 232, 217, 202, 187, 172, 157, 142, 127, 143, 158, 173, 188,
+	203, 218, 233, 248, 249, 234, 219, 204, 189, 174, 159, 175, 190, 205, 220, 235,
+	250, 251, 236, 221, 206, 191, 207, 222, 237, 252, 253, 238, 223, 239, 254, 255,
+};
@@ -0,0 +1,63 @@
+/*
+ *  ======== dct_tables.h ========
+ *  Constant DCT-II coefficient tables C[k][n] (row-major, N x N) and their
+ *  transposes C' for every supported block size, in double, float and Q15.
+ *
+ *  The definitions live in dct_tables.c, generated by host/dct_gentables.c.
+ *  They are placed in the .const:dct section, see dct_multicore.cfg.
+ */
+
+#ifndef DCT_TABLES_H_
+#define DCT_TABLES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const double dct_coeffD4[4 * 4];
+extern const double dct_coeffD8[8 * 8];
+extern const double dct_coeffD16[16 * 16];
+extern const double dct_coeffD32[32 * 32];
+
+extern const float dct_coeffF4[4 * 4];
+extern const float dct_coeffF8[8 * 8];
+extern const float dct_coeffF16[16 * 16];
+extern const float dct_coeffF32[32 * 32];
+
+extern const short dct_coeffQ15_4[4 * 4];
+extern const short dct_coeffQ15_8[8 * 8];
+extern const short dct_coeffQ15_16[16 * 16];
+extern const short dct_coeffQ15_32[32 * 32];
+
+/* inverse tables, C' */
+extern const double dct_icoeffD4[4 * 4];
+extern const double dct_icoeffD8[8 * 8];
+extern const double dct_icoeffD16[16 * 16];
+extern const double dct_icoeffD32[32 * 32];
+
+extern const float dct_icoeffF4[4 * 4];
+extern const float dct_icoeffF8[8 * 8];
+extern const float dct_icoeffF16[16 * 16];
+extern const float dct_icoeffF32[32 * 32];
+
+extern const short dct_icoeffQ15_4[4 * 4];
+extern const short dct_icoeffQ15_8[8 * 8];
+extern const short dct_icoeffQ15_16[16 * 16];
+extern const short dct_icoeffQ15_32[32 * 32];
+
+/* fast DCT (dct_fast.c) odd part, descale and inverse prescale factors */
+extern const double dct_fastOdd16[8 * 8];
+extern const double dct_fastDescale8[8 * 8];
+extern const double dct_fastDescale16[16 * 16];
+extern const double dct_fastPrescale8[8 * 8];
+extern const double dct_fastPrescale16[16 * 16];
+
+/* zigzag scan orders, row-major index of each scan position */
+extern const unsigned char dct_zigzag8[8 * 8];
+extern const unsigned char dct_zigzag16[16 * 16];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DCT_TABLES_H_ */
@@ -0,0 +1,64 @@
+/*
+ *  ======== dct_timer.h ========
+ *  Time stamp used by the DCT benchmarks. On the C66x this is the 64-bit
+ *  TSCH:TSCL counter (CPU cycles); on a host it is CLOCK_MONOTONIC in ns.
+ *  DCT_TIMER_HZ is the number of ticks per second.
+ */
+
+#ifndef DCT_TIMER_H_
+#define DCT_TIMER_H_
+
+#ifdef _TMS320C6X
+
+#include <c6x.h>
+
+#define DCT_TIMER_UNIT "cycles"
+
+/* C6670 core clock, build with -DDCT_TIMER_HZ=1200000000 on 1.2 GHz parts */
+#ifndef DCT_TIMER_HZ
+#define DCT_TIMER_HZ 1000000000.0
+#endif
+
+/*
+ *  ======== dct_timerInit ========
+ *  Any write to TSCL starts the free-running counter.
+ */
+static inline void dct_timerInit(void)
+{
+	TSCL = 0;
+}
+
+/*
+ *  ======== dct_timerRead ========
+ *  TSCL must be read first, it latches TSCH.
+ */
+static inline unsigned long long dct_timerRead(void)
+{
+	unsigned int lo = TSCL;
+	unsigned int hi = TSCH;
+
+	return _itoll(hi, lo);
+}
+
+#else
+
+#include <time.h>
+
+#define DCT_TIMER_UNIT "ns"
+#define DCT_TIMER_HZ 1000000000.0
+
+static inline void dct_timerInit(void)
+{
+}
+
+static inline unsigned long long dct_timerRead(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#endif /* _TMS320C6X */
+
+#endif /* DCT_TIMER_H_ */
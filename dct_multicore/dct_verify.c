@@ -0,0 +1,295 @@
+/*
+ *  ======== dct_verify.c ========
+ *  DCT round-trip validation. For every variant and block size a batch of
+ *  random level shifted 8-bit blocks goes through the forward and the
+ *  inverse transform. Each line reports, against the double precision
+ *  path:
+ *
+ *      fwd     max error of the forward coefficients
+ *      inv     max error of the inverse of the reference coefficients
+ *      psnr    PSNR of forward -> inverse against the input (peak 255)
+ *      max     max error of forward -> inverse against the input
+ *
+ *  The scaled fast transform (fast-scale) is descaled by the verifier
+ *  before the comparison and prescaled before its inverse.
+ *
+ *  Q15 runs once per rounding/saturation mode. The fused quantizing kernel
+ *  (fast-quant) is checked against the reference coefficients divided by
+ *  a ramp table, in zigzag order; fwd is then in quantization steps and
+ *  the round trip goes through the dequantized coefficients.
+ *
+ *  A case fails when the round-trip PSNR is below its limit, or fwd is
+ *  above its limit where it has one. Runs on a
+ *  core (see DCT_VERIFY in main_dct_multicore.c) or on a host through
+ *  host/dct_verify_main.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "dct.h"
+#include "dct_verify.h"
+
+/* samples per batch, whatever the block size */
+#define VERIFY_SAMPLES  4096
+
+/* round-trip PSNR limits in dB, identical blocks report VERIFY_PSNR_MAX */
+#define VERIFY_PSNR_MAX     99.99
+#define VERIFY_PSNR_DOUBLE  90.0
+#define VERIFY_PSNR_FLOAT   80.0
+#define VERIFY_PSNR_Q15     40.0
+#define VERIFY_PSNR_QUANT   30.0
+
+/*
+ *  fast-quant against the unrounded quotient, in quantization steps: half
+ *  a step for rounding to nearest, plus double rounding noise at the ties
+ */
+#define VERIFY_QUANT_STEPS  (0.5 + 1e-9)
+
+static const int sizes[] = { DCT_SIZE_4, DCT_SIZE_8, DCT_SIZE_16, DCT_SIZE_32 };
+
+static const struct {
+	int flags;
+	const char *name;
+} q15Modes[] = {
+	{ DCT_Q15_TRUNCATE, "q15-trunc" },
+	{ DCT_Q15_ROUND, "q15-round" },
+	{ DCT_Q15_SATURATE, "q15-sat" },
+	{ DCT_Q15_DEFAULT, "q15" },
+};
+
+static Dct_Obj verifyObj;
+static Dct_SpObj verifySpObj;
+static Dct_Q15Obj verifyQ15Obj;
+static Dct_FastObj verifyFastObj;
+static Dct_QuantObj verifyQuantObj;
+static unsigned short verifyQTable[16 * 16];
+
+#ifdef _TMS320C6X
+#pragma DATA_ALIGN(verifySpObj, 8)
+#pragma DATA_ALIGN(verifyIn, 8)
+#pragma DATA_ALIGN(verifyRef, 8)
+#pragma DATA_ALIGN(verifyCoef, 8)
+#pragma DATA_ALIGN(verifyOut, 8)
+#pragma DATA_ALIGN(verifyInF, 8)
+#pragma DATA_ALIGN(verifyOutF, 8)
+#pragma DATA_ALIGN(verifyInQ, 8)
+#pragma DATA_ALIGN(verifyOutQ, 8)
+#endif
+static double verifyIn[VERIFY_SAMPLES];
+static double verifyRef[VERIFY_SAMPLES];    /* reference coefficients */
+static double verifyCoef[VERIFY_SAMPLES];
+static double verifyOut[VERIFY_SAMPLES];
+static float verifyInF[VERIFY_SAMPLES];
+static float verifyOutF[VERIFY_SAMPLES];
+static short verifyInQ[VERIFY_SAMPLES];
+static short verifyOutQ[VERIFY_SAMPLES];
+static unsigned char verifyPix[VERIFY_SAMPLES];
+
+typedef struct VerifyErr {
+	double max;
+	double sse;
+} VerifyErr;
+
+static void errReset(VerifyErr *e)
+{
+	e->max = 0;
+	e->sse = 0;
+}
+
+static void errAdd(VerifyErr *e, double got, double want)
+{
+	double d = fabs(got - want);
+
+	if (d > e->max)
+		e->max = d;
+	e->sse += d * d;
+}
+
+static double errPsnr(const VerifyErr *e, int count)
+{
+	double mse = e->sse / count;
+	double psnr;
+
+	if (mse == 0)
+		return VERIFY_PSNR_MAX;
+	psnr = 10 * log10(255.0 * 255.0 / mse);
+	return (psnr > VERIFY_PSNR_MAX) ? VERIFY_PSNR_MAX : psnr;
+}
+
+/*
+ *  ======== verifyReport ========
+ *  Prints one case and returns 1 if it fails. A fwdLimit of 0 leaves the
+ *  forward error unchecked.
+ */
+static int verifyReport(const char *name, int n, const VerifyErr *fwd,
+		const VerifyErr *inv, const VerifyErr *rt, double limit,
+		double fwdLimit)
+{
+	double psnr = errPsnr(rt, VERIFY_SAMPLES);
+	int fail = (psnr < limit) || (fwdLimit > 0 && fwd->max > fwdLimit);
+
+	printf("%-10s %4d %12.3g %12.3g %8.2f %12.3g  %s\n", name, n, fwd->max,
+			inv->max, psnr, rt->max, fail ? "FAIL" : "PASS");
+	return fail;
+}
+
+/*
+ *  ======== dct_verifyRun ========
+ */
+int dct_verifyRun(void)
+{
+	unsigned int s, m;
+	int i, b, z, n, numBlocks;
+	int failures = 0;
+	const double *descale, *prescale;
+	VerifyErr fwd, inv, rt;
+
+	srand(1);
+	for (i = 0; i < VERIFY_SAMPLES; i++) {
+		verifyIn[i] = (rand() & 0xff) - 128;
+		verifyPix[i] = (unsigned char)(verifyIn[i] + 128);
+	}
+
+	printf("%-10s %4s %12s %12s %8s %12s\n", "variant", "N", "fwd max",
+			"inv max", "psnr dB", "rt max");
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		n = sizes[s];
+		numBlocks = VERIFY_SAMPLES / (n * n);
+
+		/* double: the reference itself */
+		dct_init(&verifyObj, n);
+		dct_forwardBlocks(&verifyObj, verifyIn, verifyRef, numBlocks);
+		dct_inverseBlocks(&verifyObj, verifyRef, verifyOut, numBlocks);
+		errReset(&fwd);
+		errReset(&rt);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&rt, verifyOut[i], verifyIn[i]);
+		inv = rt;
+		failures += verifyReport("double", n, &fwd, &inv, &rt,
+				VERIFY_PSNR_DOUBLE, 0);
+
+		/* single precision SIMD */
+		dct_initSp(&verifySpObj, n);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			verifyInF[i] = (float)verifyIn[i];
+		dct_forwardBlocksSp(&verifySpObj, verifyInF, verifyOutF, numBlocks);
+		errReset(&fwd);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&fwd, verifyOutF[i], verifyRef[i]);
+		dct_inverseBlocksSp(&verifySpObj, verifyOutF, verifyInF, numBlocks);
+		errReset(&rt);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&rt, verifyInF[i], verifyIn[i]);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			verifyInF[i] = (float)verifyRef[i];
+		dct_inverseBlocksSp(&verifySpObj, verifyInF, verifyOutF, numBlocks);
+		errReset(&inv);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&inv, verifyOutF[i], verifyIn[i]);
+		failures += verifyReport("float-simd", n, &fwd, &inv, &rt,
+				VERIFY_PSNR_FLOAT, 0);
+
+		/* Q15, every mode, coefficients are rounded to integers in between */
+		for (m = 0; m < sizeof(q15Modes) / sizeof(q15Modes[0]); m++) {
+			dct_initQ15(&verifyQ15Obj, n, q15Modes[m].flags);
+			for (i = 0; i < VERIFY_SAMPLES; i++)
+				verifyInQ[i] = (short)verifyIn[i];
+			dct_forwardBlocksQ15(&verifyQ15Obj, verifyInQ, verifyOutQ,
+					numBlocks);
+			errReset(&fwd);
+			for (i = 0; i < VERIFY_SAMPLES; i++)
+				errAdd(&fwd, verifyOutQ[i], verifyRef[i]);
+			dct_inverseBlocksQ15(&verifyQ15Obj, verifyOutQ, verifyInQ,
+					numBlocks);
+			errReset(&rt);
+			for (i = 0; i < VERIFY_SAMPLES; i++)
+				errAdd(&rt, verifyInQ[i], verifyIn[i]);
+			for (i = 0; i < VERIFY_SAMPLES; i++)
+				verifyInQ[i] = (short)floor(verifyRef[i] + 0.5);
+			dct_inverseBlocksQ15(&verifyQ15Obj, verifyInQ, verifyOutQ,
+					numBlocks);
+			errReset(&inv);
+			for (i = 0; i < VERIFY_SAMPLES; i++)
+				errAdd(&inv, verifyOutQ[i], verifyIn[i]);
+			failures += verifyReport(q15Modes[m].name, n, &fwd, &inv, &rt,
+					VERIFY_PSNR_Q15, 0);
+		}
+
+		/* fast butterflies, N = 8 and 16 only */
+		if (!dct_isFastSupported(n))
+			continue;
+		dct_initFast(&verifyFastObj, n, 0);
+		dct_forwardBlocksFast(&verifyFastObj, verifyIn, verifyCoef, numBlocks);
+		errReset(&fwd);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&fwd, verifyCoef[i], verifyRef[i]);
+		dct_inverseBlocksFast(&verifyFastObj, verifyCoef, verifyOut,
+				numBlocks);
+		errReset(&rt);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&rt, verifyOut[i], verifyIn[i]);
+		dct_inverseBlocksFast(&verifyFastObj, verifyRef, verifyOut, numBlocks);
+		errReset(&inv);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&inv, verifyOut[i], verifyIn[i]);
+		failures += verifyReport("fast", n, &fwd, &inv, &rt,
+				VERIFY_PSNR_DOUBLE, 0);
+
+		/* scaled fast butterflies, descaled here instead of in the kernel */
+		dct_initFast(&verifyFastObj, n, DCT_FAST_SCALED);
+		descale = dct_fastDescaleTable(n);
+		prescale = dct_fastPrescaleTable(n);
+		dct_forwardBlocksFast(&verifyFastObj, verifyIn, verifyCoef, numBlocks);
+		errReset(&fwd);
+		for (i = 0; i < VERIFY_SAMPLES; i++) {
+			z = i % (n * n);
+			errAdd(&fwd, verifyCoef[i] * descale[z], verifyRef[i]);
+			verifyCoef[i] *= descale[z] * prescale[z];
+		}
+		dct_inverseBlocksFast(&verifyFastObj, verifyCoef, verifyOut,
+				numBlocks);
+		errReset(&rt);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&rt, verifyOut[i], verifyIn[i]);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			verifyCoef[i] = verifyRef[i] * prescale[i % (n * n)];
+		dct_inverseBlocksFast(&verifyFastObj, verifyCoef, verifyOut,
+				numBlocks);
+		errReset(&inv);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&inv, verifyOut[i], verifyIn[i]);
+		failures += verifyReport("fast-scale", n, &fwd, &inv, &rt,
+				VERIFY_PSNR_DOUBLE, 0);
+
+		/* fused quantization, one block at a time, stride n */
+		for (i = 0; i < n * n; i++)
+			verifyQTable[i] = (unsigned short)(1 + (i / n + i % n) / 2);
+		dct_initQuant(&verifyQuantObj, n, verifyQTable);
+		for (b = 0; b < numBlocks; b++)
+			dct_forwardQuant(&verifyQuantObj, verifyPix + b * n * n, n,
+					verifyOutQ + b * n * n);
+		errReset(&fwd);
+		for (b = 0; b < numBlocks; b++) {
+			for (i = 0; i < n * n; i++) {
+				z = verifyQuantObj.zigzag[i];
+				errAdd(&fwd, verifyOutQ[b * n * n + i],
+						verifyRef[b * n * n + z] / verifyQTable[z]);
+				verifyCoef[b * n * n + z] = (double)verifyOutQ[b * n * n + i]
+						* verifyQTable[z];
+			}
+		}
+		dct_inverseBlocks(&verifyObj, verifyCoef, verifyOut, numBlocks);
+		errReset(&rt);
+		for (i = 0; i < VERIFY_SAMPLES; i++)
+			errAdd(&rt, verifyOut[i], verifyIn[i]);
+		errReset(&inv);
+		failures += verifyReport("fast-quant", n, &fwd, &inv, &rt,
+				VERIFY_PSNR_QUANT, VERIFY_QUANT_STEPS);
+	}
+
+	printf("%d case(s) failed\n", failures);
+	return failures;
+}
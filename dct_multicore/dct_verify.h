@@ -0,0 +1,25 @@
+/*
+ *  ======== dct_verify.h ========
+ *  DCT round-trip validation, shared by the DSP build and the host build.
+ */
+
+#ifndef DCT_VERIFY_H_
+#define DCT_VERIFY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  ======== dct_verifyRun ========
+ *  Runs forward -> inverse on a batch of random 8-bit blocks for every
+ *  DCT variant and block size, prints one line per case and returns the
+ *  number of cases that missed their accuracy limits.
+ */
+int dct_verifyRun(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DCT_VERIFY_H_ */
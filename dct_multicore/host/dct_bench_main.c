@@ -0,0 +1,20 @@
+/*
+ *  ======== dct_bench_main.c ========
+ *  Host entry point for the DCT benchmark in dct_bench.c. Times are in ns
+ *  from CLOCK_MONOTONIC and only one core is measured; the "all cores"
+ *  rows come from the target run.
+ *
+ *  Build and run on a Linux host from the dct_multicore directory:
+ *
+ *      gcc -O2 -I. -o dct_bench host/dct_bench_main.c dct_bench.c dct.c \
+ *          dct_q15.c dct_sp.c dct_fast.c dct_quant.c dct_tables.c -lm
+ *      ./dct_bench
+ */
+
+#include "dct_bench.h"
+
+int main(void)
+{
+	dct_benchRun();
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ *  ======== dct_compare.c ========
+ *  Host program that runs the same random blocks through the double and
+ *  the fixed-point DCT paths and reports the error and time of each.
+ *
+ *  Build and run on a Linux host from the dct_multicore directory:
+ *
+ *      gcc -O2 -I. -o dct_compare host/dct_compare.c dct.c dct_q15.c \
+ *          dct_tables.c -lm
+ *      ./dct_compare
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "dct.h"
+
+#define NUM_BLOCKS  4096
+
+static const int sizes[] = { DCT_SIZE_4, DCT_SIZE_8, DCT_SIZE_16, DCT_SIZE_32 };
+
+static Dct_Obj dctObj;
+static Dct_Q15Obj dctQ15Obj;
+
+static double inD[NUM_BLOCKS * DCT_MAX_BLOCK];
+static double outD[NUM_BLOCKS * DCT_MAX_BLOCK];
+static short inQ[NUM_BLOCKS * DCT_MAX_BLOCK];
+static short outQ[NUM_BLOCKS * DCT_MAX_BLOCK];
+
+static double seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+	unsigned int s;
+	int n, i, len;
+	double t0, tD, tQ, err, maxErr, sumErr;
+
+	printf("%4s %12s %12s %10s %10s\n", "N", "double(us)", "q15(us)",
+			"maxErr", "meanErr");
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		n = sizes[s];
+		len = NUM_BLOCKS * n * n;
+
+		dct_init(&dctObj, n);
+		dct_initQ15(&dctQ15Obj, n, DCT_Q15_DEFAULT);
+
+		/* level shifted 8-bit pixels */
+		srand(1);
+		for (i = 0; i < len; i++) {
+			inQ[i] = (short)((rand() & 0xff) - 128);
+			inD[i] = inQ[i];
+		}
+
+		t0 = seconds();
+		dct_forwardBlocks(&dctObj, inD, outD, NUM_BLOCKS);
+		tD = seconds() - t0;
+
+		t0 = seconds();
+		dct_forwardBlocksQ15(&dctQ15Obj, inQ, outQ, NUM_BLOCKS);
+		tQ = seconds() - t0;
+
+		maxErr = 0;
+		sumErr = 0;
+		for (i = 0; i < len; i++) {
+			err = fabs(outD[i] - outQ[i]);
+			sumErr += err;
+			if (err > maxErr)
+				maxErr = err;
+		}
+
+		printf("%4d %12.3f %12.3f %10.3f %10.4f\n", n,
+				tD * 1e6 / NUM_BLOCKS, tQ * 1e6 / NUM_BLOCKS,
+				maxErr, sumErr / len);
+	}
+
+	return 0;
+}
@@ -0,0 +1,253 @@
+/*
+ *  ======== dct_gentables.c ========
+ *  Host tool that generates dct_tables.c, the constant DCT-II coefficient
+ *  tables used by the dct_multicore engine.
+ *
+ *  Build and run on a Linux host from the dct_multicore directory:
+ *
+ *      gcc -O2 -I. -o dct_gentables host/dct_gentables.c -lm
+ *      ./dct_gentables > dct_tables.c
+ *
+ *  For every supported size N it emits C[k][n] (row-major, N x N) and
+ *  its transpose as double, float and Q15. It also emits the odd-part
+ *  matrix of the fast 16-point DCT and the 2D descale/prescale factors of
+ *  the fast 8 and 16-point DCTs and inverse DCTs, measured by running the
+ *  dct_fast1d.h butterflies on the DCT basis vectors, and the zigzag scan
+ *  orders used by the fused quantizer.
+ *  All tables go to the .const:dct subsection so the linker command or
+ *  the .cfg can pin them to L2SRAM.
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#include "dct_fast1d.h"
+
+#define DCT_PI 3.14159265358979323846
+
+static const int sizes[] = { 4, 8, 16, 32 };
+
+static double coeff(int n, int k, int j)
+{
+	double alpha = (k == 0) ? sqrt(1 / (double)n) : sqrt(2 / (double)n);
+
+	return alpha * cos(((2 * j + 1) * k * DCT_PI) / (double)(2 * n));
+}
+
+static short toQ15(double c)
+{
+	double q = floor(c * 32768.0 + 0.5);
+
+	if (q > 32767.0)
+		q = 32767.0;
+	if (q < -32768.0)
+		q = -32768.0;
+	return (short)q;
+}
+
+static const char *sep(int j, int n, int perLine)
+{
+	if (j == n - 1)
+		return "\n";
+	return (j % perLine == perLine - 1) ? "\n\t" : " ";
+}
+
+static void emitHeader(const char *type, const char *name, int n, int len)
+{
+	printf("#ifdef _TMS320C6X\n");
+	printf("#pragma DATA_SECTION(%s%d, \".const:dct\")\n", name, n);
+	printf("#pragma DATA_ALIGN(%s%d, 8)\n", name, n);
+	printf("#endif\n");
+	printf("const %s %s%d[%d] = {\n", type, name, n, len);
+}
+
+static void emitDoubles(const double *v, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		printf("%s%.17g,%s", (i % 4 == 0) ? "\t" : "", v[i],
+				(i % 4 == 3 || i == len - 1) ? "\n" : " ");
+	printf("};\n");
+}
+
+/*
+ *  Scale s[k] of output k of a fast 1D kernel: feeding basis vector k of
+ *  the orthonormal DCT must give s[k] at position k and zero elsewhere.
+ */
+static void fastScale(int n, const double *odd, double *scale)
+{
+	double basis[16];
+	double out[16];
+	int k, j;
+
+	for (k = 0; k < n; k++) {
+		for (j = 0; j < n; j++)
+			basis[j] = coeff(n, k, j);
+		if (n == 8)
+			dct_fast8(basis, 1, out, 1);
+		else
+			dct_fast16(odd, basis, 1, out, 1);
+		scale[k] = out[k];
+	}
+}
+
+/*
+ *  Same for the inverse kernels: feeding unit vector k must give t[k]
+ *  times basis vector k, so prescaling input k by 1 / t[k] gives the
+ *  orthonormal inverse. Position 0 is used, C[k][0] is never zero.
+ */
+static void ifastScale(int n, const double *odd, double *scale)
+{
+	double unit[16];
+	double out[16];
+	int k, j;
+
+	for (k = 0; k < n; k++) {
+		for (j = 0; j < n; j++)
+			unit[j] = (j == k) ? 1 : 0;
+		if (n == 8)
+			dct_ifast8(unit, 1, out, 1);
+		else
+			dct_ifast16(odd, unit, 1, out, 1);
+		scale[k] = out[0] / coeff(n, k, 0);
+	}
+}
+
+static void emitFast(void)
+{
+	double odd[64];
+	double scale[16];
+	double descale[256];
+	int n, m, u, v;
+
+	for (m = 0; m < 8; m++)
+		for (n = 0; n < 8; n++)
+			odd[m * 8 + n] = cos((2 * n + 1) * (2 * m + 1) * DCT_PI / 32);
+
+	printf("\n/* fast 16-point DCT odd part, cos((2n+1)(2m+1)pi/32) */\n");
+	emitHeader("double", "dct_fastOdd", 16, 64);
+	emitDoubles(odd, 64);
+
+	for (n = 8; n <= 16; n += 8) {
+		fastScale(n, odd, scale);
+		for (u = 0; u < n; u++)
+			for (v = 0; v < n; v++)
+				descale[u * n + v] = 1 / (scale[u] * scale[v]);
+
+		printf("\n/* fast %d x %d DCT descale factors */\n", n, n);
+		emitHeader("double", "dct_fastDescale", n, n * n);
+		emitDoubles(descale, n * n);
+
+		ifastScale(n, odd, scale);
+		for (u = 0; u < n; u++)
+			for (v = 0; v < n; v++)
+				descale[u * n + v] = 1 / (scale[u] * scale[v]);
+
+		printf("\n/* fast %d x %d inverse DCT prescale factors */\n", n, n);
+		emitHeader("double", "dct_fastPrescale", n, n * n);
+		emitDoubles(descale, n * n);
+	}
+}
+
+/*
+ *  JPEG style zigzag: walk the anti-diagonals, downwards on odd ones and
+ *  upwards on even ones. zz[i] is the row-major index of scan position i.
+ */
+static void emitZigzag(int n)
+{
+	int zz[256];
+	int i = 0;
+	int d, r, lo, hi;
+
+	for (d = 0; d < 2 * n - 1; d++) {
+		lo = (d < n) ? 0 : d - n + 1;
+		hi = (d < n) ? d : n - 1;
+		if (d & 1) {
+			for (r = lo; r <= hi; r++)
+				zz[i++] = r * n + (d - r);
+		} else {
+			for (r = hi; r >= lo; r--)
+				zz[i++] = r * n + (d - r);
+		}
+	}
+
+	printf("\n/* %d x %d zigzag scan, row-major index of each position */\n",
+			n, n);
+	emitHeader("unsigned char", "dct_zigzag", n, n * n);
+	for (i = 0; i < n * n; i++)
+		printf("%s%d,%s", (i % 16 == 0) ? "\t" : "", zz[i],
+				(i % 16 == 15 || i == n * n - 1) ? "\n" : " ");
+	printf("};\n");
+}
+
+/*
+ *  Coefficient tables of one size in the three precisions. The inverse
+ *  tables hold C', so the inverse can reuse the forward kernels.
+ */
+static void emitCoeff(int n, int inverse)
+{
+	int k, j;
+	double c;
+
+	emitHeader("double", inverse ? "dct_icoeffD" : "dct_coeffD", n, n * n);
+	for (k = 0; k < n; k++) {
+		printf("\t");
+		for (j = 0; j < n; j++) {
+			c = inverse ? coeff(n, j, k) : coeff(n, k, j);
+			printf("%.17g,%s", c, sep(j, n, 4));
+		}
+	}
+	printf("};\n\n");
+
+	emitHeader("float", inverse ? "dct_icoeffF" : "dct_coeffF", n, n * n);
+	for (k = 0; k < n; k++) {
+		printf("\t");
+		for (j = 0; j < n; j++) {
+			c = inverse ? coeff(n, j, k) : coeff(n, k, j);
+			printf("%.9gf,%s", (float)c, sep(j, n, 4));
+		}
+	}
+	printf("};\n\n");
+
+	emitHeader("short", inverse ? "dct_icoeffQ15_" : "dct_coeffQ15_", n,
+			n * n);
+	for (k = 0; k < n; k++) {
+		printf("\t");
+		for (j = 0; j < n; j++) {
+			c = inverse ? coeff(n, j, k) : coeff(n, k, j);
+			printf("%d,%s", toQ15(c), sep(j, n, 8));
+		}
+	}
+	printf("};\n");
+}
+
+int main(void)
+{
+	unsigned int s;
+	int n;
+
+	printf("/*\n");
+	printf(" *  ======== dct_tables.c ========\n");
+	printf(" *  DCT-II coefficient tables C[k][n], row-major.\n");
+	printf(" *\n");
+	printf(" *  GENERATED by host/dct_gentables.c, do not edit.\n");
+	printf(" */\n\n");
+	printf("#include \"dct_tables.h\"\n");
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		n = sizes[s];
+
+		printf("\n/* N = %d */\n", n);
+		emitCoeff(n, 0);
+
+		printf("\n/* N = %d, inverse (transposed) */\n", n);
+		emitCoeff(n, 1);
+	}
+
+	emitFast();
+	emitZigzag(8);
+	emitZigzag(16);
+
+	return 0;
+}
@@ -0,0 +1,18 @@
+/*
+ *  ======== dct_verify_main.c ========
+ *  Host entry point for the DCT round-trip validation in dct_verify.c.
+ *  Exits with a non-zero status if any case fails.
+ *
+ *  Build and run on a Linux host from the dct_multicore directory:
+ *
+ *      gcc -O2 -I. -o dct_verify host/dct_verify_main.c dct_verify.c dct.c \
+ *          dct_q15.c dct_sp.c dct_fast.c dct_quant.c dct_tables.c -lm
+ *      ./dct_verify
+ */
+
+#include "dct_verify.h"
+
+int main(void)
+{
+	return dct_verifyRun() ? 1 : 0;
+}
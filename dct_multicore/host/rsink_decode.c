@@ -0,0 +1,155 @@
+/*
+ *  ======== rsink_decode.c ========
+ *  Host decoder for the binary result sink (result_sink.h) used by
+ *  dct_multicore, core_multi_task and real_multicore_tsk.
+ *
+ *  After the run, save rsinkBuf (sizeof(rsinkBuf) bytes) from any core as
+ *  a raw binary file, with Save Memory in the CCS memory browser or
+ *  memory.saveBinary() in a DSS script. Then, from the dct_multicore
+ *  directory:
+ *
+ *      gcc -O2 -I../common -o rsink_decode host/rsink_decode.c
+ *      ./rsink_decode rsink.bin            text, one line per record
+ *      ./rsink_decode -c rsink.bin         CSV
+ *
+ *  Blocks without RSINK_MAGIC (cores that never called rsink_init) are
+ *  skipped. The dump must come from a little endian target.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "result_sink.h"
+
+/* the dump is only usable if the host lays the block out like the DSP */
+typedef char rsinkLayoutCheck[(sizeof(Rsink_Core) == 128
+		+ RSINK_MAX_TAGS * 32 + RSINK_MAX_RECORDS * 16) ? 1 : -1];
+
+static const char *const typeNames[] = { "int", "uint", "float", "u64" };
+
+/*
+ *  ======== tagType ========
+ *  Type of the tag of r; RSINK_UINT, the default format, for a tag number
+ *  out of range in a corrupt or truncated dump.
+ */
+static unsigned int tagType(const Rsink_Core *blk, const Rsink_Record *r)
+{
+	return (r->tag < RSINK_MAX_TAGS) ? blk->tags[r->tag].type : RSINK_UINT;
+}
+
+/*
+ *  ======== formatValues ========
+ *  Formats the two values of r according to the type of its tag.
+ */
+static void formatValues(const Rsink_Core *blk, const Rsink_Record *r,
+		char *buf, size_t len, char sep)
+{
+	float f0, f1;
+
+	switch (tagType(blk, r)) {
+	case RSINK_INT:
+		snprintf(buf, len, "%d%c%d", (int)r->val[0], sep, (int)r->val[1]);
+		break;
+	case RSINK_FLOAT:
+		memcpy(&f0, &r->val[0], sizeof(f0));
+		memcpy(&f1, &r->val[1], sizeof(f1));
+		snprintf(buf, len, "%.9g%c%.9g", f0, sep, f1);
+		break;
+	case RSINK_U64:
+		snprintf(buf, len, "%llu%c",
+				((unsigned long long)r->val[1] << 32) | r->val[0], sep);
+		break;
+	default:
+		snprintf(buf, len, "%u%c%u", r->val[0], sep, r->val[1]);
+		break;
+	}
+}
+
+/*
+ *  ======== decodeCore ========
+ */
+static void decodeCore(const Rsink_Core *blk, int csv)
+{
+	unsigned int i, count;
+	const Rsink_Record *r;
+	const char *name;
+	char unnamed[16];
+	char values[64];
+
+	count = blk->count;
+	if (count > RSINK_MAX_RECORDS) {
+		fprintf(stderr, "core %u: bad record count %u\n", blk->core, count);
+		count = RSINK_MAX_RECORDS;
+	}
+
+	if (!csv) {
+		printf("# core %u: %u records, %u dropped\n", blk->core, blk->count,
+				blk->dropped);
+	}
+
+	for (i = 0; i < count; i++) {
+		r = &blk->rec[i];
+
+		if (r->tag < RSINK_MAX_TAGS && blk->tags[r->tag].name[0] != '\0') {
+			name = blk->tags[r->tag].name;
+		} else {
+			snprintf(unnamed, sizeof(unnamed), "tag%u", r->tag);
+			name = unnamed;
+		}
+		formatValues(blk, r, values, sizeof(values), csv ? ',' : ' ');
+
+		if (csv) {
+			printf("%u,%u,%u,%s,%s,%s\n", blk->core, r->seq, r->time, name,
+					typeNames[tagType(blk, r) & 3],
+					values);
+		} else {
+			printf("core %u #%-5u t=%-10u %-20s %s\n", blk->core, r->seq,
+					r->time, name, values);
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	static Rsink_Core blk;
+	const char *path;
+	FILE *fp;
+	int csv = 0;
+	int found = 0;
+
+	if (argc == 3 && strcmp(argv[1], "-c") == 0) {
+		csv = 1;
+		path = argv[2];
+	} else if (argc == 2) {
+		path = argv[1];
+	} else {
+		fprintf(stderr, "usage: %s [-c] rsink.bin\n", argv[0]);
+		return 2;
+	}
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) {
+		perror(path);
+		return 1;
+	}
+
+	if (csv) {
+		printf("core,seq,time,tag,type,v0,v1\n");
+	}
+
+	while (fread(&blk, sizeof(blk), 1, fp) == 1) {
+		if (blk.magic != RSINK_MAGIC) {
+			continue;
+		}
+		decodeCore(&blk, csv);
+		found++;
+	}
+	fclose(fp);
+
+	if (found == 0) {
+		fprintf(stderr, "%s: no result sink blocks found\n", path);
+		return 1;
+	}
+	return 0;
+}
@@ -4,7 +4,6 @@
 
 // C includes
 #include <stdio.h>
-#include <math.h>
 
 //CCS includes
 #include <xdc/std.h>
@@ -19,23 +18,118 @@
 /*CSL*/
 // To access register and indentify core number
 #include <ti/csl/csl_chip.h>
+#include <ti/csl/csl_cacheAux.h>
+
+#include "dct.h"
+#include "dct_image.h"
+#include "dct_bench.h"
+#include "dct_verify.h"
+#include "dct_timer.h"
+#include "result_sink.h"
 
 //DEFINES
-#define SIZE 2
+/* uncomment to run the DCT benchmark on all the cores instead of the tasks */
+//#define DCT_BENCHMARK
+/* uncomment to run the forward -> inverse validation on core 0 instead */
+//#define DCT_VERIFY
+
+#define NUMBER_OF_CORES 4
+#define SYSINIT 0
+
+#define SIZE DCT_SIZE_8
+#define FRAME_WIDTH 256
+#define FRAME_HEIGHT 256
+#define BLOCK_ROWS (FRAME_HEIGHT / SIZE)
+#define BLOCKS_PER_ROW (FRAME_WIDTH / SIZE)
+
+/* result sink tags, see result_sink.h */
+#define TAG_SLICE 0		/* blocks, cycles of one core */
+#define TAG_FRAME 1		/* blocks, cycles of the whole frame */
+#define TAG_DC 2		/* DC coefficient of the first block */
+
+/* one status line per core, padded to a full L2 cache line */
+#define CACHE_LINE 128
+
+typedef struct CoreStatus {
+	volatile Uint32 done;
+	volatile Uint32 cycles;
+	volatile Uint32 blocks;
+	Uint8 pad[CACHE_LINE - 3 * sizeof(Uint32)];
+} CoreStatus;
+
+/*
+ * The frame, its coefficients and the sync flags are shared by all the
+ * cores: .dct_shared is mapped to MSMCSRAM in dct_multicore.cfg
+ */
+#pragma DATA_SECTION(frame, ".dct_shared")
+#pragma DATA_ALIGN(frame, CACHE_LINE)
+Uint8 frame[FRAME_WIDTH * FRAME_HEIGHT];
+
+#pragma DATA_SECTION(frameCoef, ".dct_shared")
+#pragma DATA_ALIGN(frameCoef, CACHE_LINE)
+float frameCoef[FRAME_WIDTH * FRAME_HEIGHT];
+
+/*
+ * frame handshake, one line per core and direction, see waitFrame.
+ * MSMCSRAM keeps its contents across loads and runs, so no flag in it
+ * can be trusted to start cleared
+ */
+typedef struct SyncLine {
+	volatile Uint32 value;
+	Uint8 pad[CACHE_LINE - sizeof(Uint32)];
+} SyncLine;
+
+#pragma DATA_SECTION(frameHello, ".dct_shared")
+#pragma DATA_ALIGN(frameHello, CACHE_LINE)
+SyncLine frameHello[NUMBER_OF_CORES];		/* written by each reader */
+
+#pragma DATA_SECTION(frameAck, ".dct_shared")
+#pragma DATA_ALIGN(frameAck, CACHE_LINE)
+SyncLine frameAck[NUMBER_OF_CORES];		/* written by core 0 */
+
+#pragma DATA_SECTION(frameStarted, ".dct_shared")
+#pragma DATA_ALIGN(frameStarted, CACHE_LINE)
+SyncLine frameStarted[NUMBER_OF_CORES];	/* set by each reader */
+
+#pragma DATA_SECTION(coreStatus, ".dct_shared")
+#pragma DATA_ALIGN(coreStatus, CACHE_LINE)
+CoreStatus coreStatus[NUMBER_OF_CORES];
+
+/*
+ * benchmark results of each core, see DCT_BENCHMARK. The header is padded
+ * so no cache line holds results of two cores.
+ */
+typedef struct CoreBench {
+	volatile Uint32 done;
+	Int32 numCases;
+	Uint8 pad[CACHE_LINE - 2 * sizeof(Uint32)];
+	Dct_BenchCase cases[DCT_BENCH_MAX_CASES];
+} CoreBench;
+
+#pragma DATA_SECTION(coreBench, ".dct_shared")
+#pragma DATA_ALIGN(coreBench, CACHE_LINE)
+CoreBench coreBench[NUMBER_OF_CORES];
+
+/*
+ * transform object and block row scratch are private, they live in each
+ * core's own L2
+ */
+#pragma DATA_ALIGN(dctObj, 8)
+Dct_SpObj dctObj;
+#pragma DATA_ALIGN(rowScratch, 8)
+float rowScratch[FRAME_WIDTH * SIZE];
 
 /*
  *Task definitions
  *
  */
 
-Void task0(UArg arg0, UArg arg1);
-Void task1(UArg arg0, UArg arg1);
-Void task2(UArg arg0, UArg arg1);
-Void task3(UArg arg0, UArg arg1);
+Void dctFrameTask(UArg arg0, UArg arg1);
+Void benchRun(Uint32 coreNum);
 
 /*
  *  ======== taskMstr ========
- *  Calls different taskts depending on which core we are working
+ *  Starts the frame DCT task, the same body runs on every core
  */
 Void taskMstr(UArg a0, UArg a1){
 	Uint32 coreNum;
@@ -44,26 +138,36 @@ Void taskMstr(UArg a0, UArg a1){
 	Task_Params tskpr;
 	Task_Params_init(&tskpr);
 
-	/*
-	 * no need to add semaphores to remove concurrency possibility
-	 */
+	rsink_init(coreNum);
+	rsink_tag(TAG_SLICE, "slice", RSINK_UINT);
+	rsink_tag(TAG_FRAME, "frame", RSINK_UINT);
+	rsink_tag(TAG_DC, "dc", RSINK_FLOAT);
+
+#ifdef DCT_BENCHMARK
+	benchRun(coreNum);
+	return;
+#endif
+
+#ifdef DCT_VERIFY
 	if(coreNum == 0){
-		Task_create(task0, NULL, NULL);
-	}else if(coreNum == 1){
-		Task_create(task1, NULL, NULL);
-	}else if(coreNum == 2){
-		Task_create(task2, NULL, NULL);
-	}else{
-		Task_create(task3, NULL, NULL);
+		if(dct_verifyRun() != 0){
+			System_printf("DCT validation failed\n");
+		}
 	}
+	return;
+#endif
 
-
+	tskpr.arg0 = coreNum;
+	if(Task_create(dctFrameTask, &tskpr, NULL) == NULL){
+		System_printf("Task_create() failed!\n");
+		BIOS_exit(0);
+	}
 }
 /*
  *  ======== main ========
  */
 Int main()
-{ 
+{
     Task_Handle task;
     Error_Block eb;
 
@@ -80,206 +184,180 @@ Int main()
     return(0);
 }
 
-Void task0(UArg a0, UArg a1){
-
-double dctcoeff[SIZE][SIZE];
-double input[2][2]={{1,1},{1,1}};
-double result[2][2];
-int i,j;
-double alpha;
-double denominator;
-
-/*
-*calculate the coeffs
-*/
-for(i=0;i<SIZE;i++){
-        dctcoeff[0][i]= sqrt(1/(double)SIZE);
-}
-
 /*
-*calculate alpha and denominator
-*/
-alpha = sqrt(2/(double)SIZE);
-denominator = (double)2*SIZE;
-
-/*
-*generate final coeffs
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<0;j++){
-                dctcoeff[i][j]= alpha * cos(((2*j+1)*i*3.14159)/denominator);
-        }
-}
+ *  ======== generateFrame ========
+ *  Test frame: a diagonal gradient
+ */
+Void generateFrame(){
+	int x,y;
 
-/*
-*multiply for the input
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<SIZE;j++){
-                result[i][j]=input[i][j]*dctcoeff[i][j];
-        }
+	for(y=0;y<FRAME_HEIGHT;y++){
+		for(x=0;x<FRAME_WIDTH;x++){
+			frame[y*FRAME_WIDTH+x]=(Uint8)(x+y);
+		}
+	}
 }
 
 /*
-*print result
-*/
-for(i=0;i<SIZE;i++){
-	for(j=0;j<SIZE;j++){
-		printf("[%d][%d]=%lf\n",i,j,result[i][j]);
+ *  ======== waitFrame ========
+ *  Core 0 produces the frame and clears the status lines, the other
+ *  cores wait until it is published. Each reader posts a token one above
+ *  the last value of its hello line and waits for core 0 to echo it:
+ *  core 0 only echoes once the frame is ready, and only ever echoes hello
+ *  values, so no ack left in MSMCSRAM can match a new token. Core 0 goes
+ *  on once every reader has marked its started line, which core 0 clears
+ *  before it echoes anything
+ */
+Void waitFrame(Uint32 coreNum){
+	int i, pending;
+	Uint32 token;
+
+	if(coreNum == SYSINIT){
+		generateFrame();
+		CACHE_wbL1d((void *)frame, sizeof(frame), CACHE_WAIT);
+
+		for(i=0;i<NUMBER_OF_CORES;i++){
+			coreStatus[i].done = 0;
+			coreBench[i].done = 0;
+			CACHE_wbL1d((void *)&coreBench[i], CACHE_LINE, CACHE_WAIT);
+			frameStarted[i].value = 0;
+		}
+		CACHE_wbL1d((void *)coreStatus, sizeof(coreStatus), CACHE_WAIT);
+		CACHE_wbL1d((void *)frameStarted, sizeof(frameStarted), CACHE_WAIT);
+
+		do{
+			pending = 0;
+			for(i=0;i<NUMBER_OF_CORES;i++){
+				if(i == SYSINIT){
+					continue;
+				}
+				CACHE_invL1d((void *)&frameStarted[i], CACHE_LINE, CACHE_WAIT);
+				if(frameStarted[i].value != 0){
+					continue;
+				}
+				pending++;
+				CACHE_invL1d((void *)&frameHello[i], CACHE_LINE, CACHE_WAIT);
+				if(frameHello[i].value != frameAck[i].value){
+					frameAck[i].value = frameHello[i].value;
+					CACHE_wbL1d((void *)&frameAck[i], CACHE_LINE, CACHE_WAIT);
+				}
+			}
+		}while(pending > 0);
+	}else{
+		CACHE_invL1d((void *)&frameHello[coreNum], CACHE_LINE, CACHE_WAIT);
+		token = frameHello[coreNum].value + 1;
+		if(token == 0){
+			token = 1;
+		}
+		frameHello[coreNum].value = token;
+		CACHE_wbL1d((void *)&frameHello[coreNum], CACHE_LINE, CACHE_WAIT);
+
+		do{
+			CACHE_invL1d((void *)&frameAck[coreNum], CACHE_LINE, CACHE_WAIT);
+		}while(frameAck[coreNum].value != token);
+
+		frameStarted[coreNum].value = token;
+		CACHE_wbL1d((void *)&frameStarted[coreNum], CACHE_LINE, CACHE_WAIT);
 	}
 }
 
-}
-
-Void task1(UArg a0, UArg a1){
-
-double dctcoeff[SIZE][SIZE];
-double input[2][2]={{2,2},{2,2}};
-double result[2][2];
-int i,j;
-double alpha;
-double denominator;
-
 /*
-*calculate the coeffs
-*/
-for(i=0;i<SIZE;i++){
-        dctcoeff[0][i]= sqrt(1/(double)SIZE);
-}
+ *  ======== dctFrameTask ========
+ *  Transforms this core's slice of block rows and signals completion in
+ *  its status line. Every core records its slice in the result sink,
+ *  core 0 then waits for all the cores and records the frame totals.
+ */
+Void dctFrameTask(UArg a0, UArg a1){
+	Uint32 coreNum = (Uint32)a0;
+	int first, count, i;
+	unsigned long long t0, t1;
+	Uint32 maxCycles = 0;
+	Uint32 totalBlocks = 0;
+
+	if(dct_initSp(&dctObj, SIZE) != DCT_SOK){
+		System_printf("core %d: dct_initSp(%d) failed\n", coreNum, SIZE);
+		return;
+	}
 
-/*
-*calculate alpha and denominator
-*/
-alpha = sqrt(2/(double)SIZE);
-denominator = (double)2*SIZE;
+	dct_timerInit();
+	waitFrame(coreNum);
 
-/*
-*generate final coeffs
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<0;j++){
-                dctcoeff[i][j]= alpha * cos(((2*j+1)*i*3.14159)/denominator);
-        }
-}
+	dct_imageSlice(BLOCK_ROWS, coreNum, NUMBER_OF_CORES, &first, &count);
 
-/*
-*multiply for the input
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<SIZE;j++){
-                result[i][j]=input[i][j]*dctcoeff[i][j];
-        }
-}
+	t0 = dct_timerRead();
 
-/*
-*print result
-*/
-for(i=0;i<SIZE;i++){
-	for(j=0;j<SIZE;j++){
-		printf("[%d][%d]=%lf\n",i,j,result[i][j]);
-	}
-}
+	/* drop stale lines of our slice before reading it */
+	CACHE_invL1d((void *)&frame[first*SIZE*FRAME_WIDTH],
+			count*SIZE*FRAME_WIDTH, CACHE_WAIT);
 
-}
+	dct_imageForwardRows(&dctObj, frame, FRAME_WIDTH, FRAME_WIDTH,
+			frameCoef, first, count, rowScratch);
 
-Void task2(UArg a0, UArg a1){
+	CACHE_wbL1d((void *)&frameCoef[first*BLOCKS_PER_ROW*SIZE*SIZE],
+			count*BLOCKS_PER_ROW*SIZE*SIZE*sizeof(float), CACHE_WAIT);
 
-double dctcoeff[SIZE][SIZE];
-double input[2][2]={{3,3},{3,3}};
-double result[2][2];
-int i,j;
-double alpha;
-double denominator;
+	t1 = dct_timerRead();
 
-/*
-*calculate the coeffs
-*/
-for(i=0;i<SIZE;i++){
-        dctcoeff[0][i]= sqrt(1/(double)SIZE);
-}
+	coreStatus[coreNum].cycles = (Uint32)(t1 - t0);
+	coreStatus[coreNum].blocks = count * BLOCKS_PER_ROW;
+	coreStatus[coreNum].done = 1;
+	CACHE_wbL1d((void *)&coreStatus[coreNum], sizeof(CoreStatus), CACHE_WAIT);
 
-/*
-*calculate alpha and denominator
-*/
-alpha = sqrt(2/(double)SIZE);
-denominator = (double)2*SIZE;
+	rsink_put(TAG_SLICE, coreStatus[coreNum].blocks, coreStatus[coreNum].cycles);
 
-/*
-*generate final coeffs
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<0;j++){
-                dctcoeff[i][j]= alpha * cos(((2*j+1)*i*3.14159)/denominator);
-        }
-}
+	if(coreNum != SYSINIT){
+		rsink_flush();
+		return;
+	}
 
-/*
-*multiply for the input
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<SIZE;j++){
-                result[i][j]=input[i][j]*dctcoeff[i][j];
-        }
-}
+	for(i=0;i<NUMBER_OF_CORES;i++){
+		do{
+			CACHE_invL1d((void *)&coreStatus[i], sizeof(CoreStatus), CACHE_WAIT);
+		}while(coreStatus[i].done == 0);
 
-/*
-*print result
-*/
-for(i=0;i<SIZE;i++){
-	for(j=0;j<SIZE;j++){
-		printf("[%d][%d]=%lf\n",i,j,result[i][j]);
+		totalBlocks += coreStatus[i].blocks;
+		if(coreStatus[i].cycles > maxCycles){
+			maxCycles = coreStatus[i].cycles;
+		}
 	}
-}
 
+	/*
+	*record result, decode it on the host with host/rsink_decode.c
+	*/
+	CACHE_invL1d((void *)frameCoef, SIZE*SIZE*sizeof(float), CACHE_WAIT);
+	rsink_put(TAG_FRAME, totalBlocks, maxCycles);
+	rsink_putFloat(TAG_DC, frameCoef[0], 0);
+	rsink_flush();
 }
 
-Void task3(UArg a0, UArg a1){
-
-double dctcoeff[SIZE][SIZE];
-double input[2][2]={{4,4},{4,4}};
-double result[2][2];
-int i,j;
-double alpha;
-double denominator;
-
 /*
-*calculate the coeffs
-*/
-for(i=0;i<SIZE;i++){
-        dctcoeff[0][i]= sqrt(1/(double)SIZE);
-}
+ *  ======== benchRun ========
+ *  Every core measures all the benchmark cases at the same time, core 0
+ *  then prints them per core and summed over the cores
+ */
+Void benchRun(Uint32 coreNum){
+	int i;
+	Dct_BenchCase *perCore[NUMBER_OF_CORES];
 
-/*
-*calculate alpha and denominator
-*/
-alpha = sqrt(2/(double)SIZE);
-denominator = (double)2*SIZE;
+	waitFrame(coreNum);
 
-/*
-*generate final coeffs
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<0;j++){
-                dctcoeff[i][j]= alpha * cos(((2*j+1)*i*3.14159)/denominator);
-        }
-}
+	coreBench[coreNum].numCases = dct_benchMeasure(coreBench[coreNum].cases,
+			DCT_BENCH_MAX_CASES);
+	coreBench[coreNum].done = 1;
+	CACHE_wbL1d((void *)&coreBench[coreNum], sizeof(CoreBench), CACHE_WAIT);
 
-/*
-*multiply for the input
-*/
-for(i=0;i<SIZE;i++){
-        for(j=0;j<SIZE;j++){
-                result[i][j]=input[i][j]*dctcoeff[i][j];
-        }
-}
+	if(coreNum != SYSINIT){
+		return;
+	}
 
-/*
-*print result
-*/
-for(i=0;i<SIZE;i++){
-	for(j=0;j<SIZE;j++){
-		printf("[%d][%d]=%lf\n",i,j,result[i][j]);
+	for(i=0;i<NUMBER_OF_CORES;i++){
+		do{
+			CACHE_invL1d((void *)&coreBench[i], CACHE_LINE, CACHE_WAIT);
+		}while(coreBench[i].done == 0);
+		CACHE_invL1d((void *)coreBench[i].cases, sizeof(coreBench[i].cases),
+				CACHE_WAIT);
+		perCore[i] = coreBench[i].cases;
 	}
-}
 
+	dct_benchPrint(perCore, coreBench[0].numCases, NUMBER_OF_CORES);
 }
@@ -18,6 +18,11 @@
 #include <ti/csl/csl_pscAux.h>
 #include <ti/csl/csl_chip.h>
 
+#include "result_sink.h"
+
+/* result sink tags, decode with dct_multicore/host/rsink_decode.c */
+#define TAG_RESULT 0
+
 /**
  * cannot access shared resource, why?
  *
@@ -30,19 +35,23 @@
 
 Void task0(UArg a0, UArg a1){
 	int c1=1;
-	printf("a1=%d\n",c1);
+	rsink_putInt(TAG_RESULT, 1, c1);
+	rsink_flush();
 }
 Void task1(UArg a0, UArg a1){
 	int c2=1;
-	printf("a2=%d\n",c2);
+	rsink_putInt(TAG_RESULT, 2, c2);
+	rsink_flush();
 }
 Void task2(UArg a0, UArg a1){
 	int c3=1;
-	printf("a3=%d\n",c3);
+	rsink_putInt(TAG_RESULT, 3, c3);
+	rsink_flush();
 }
 Void task3(UArg a0, UArg a1){
 	int c4=1;
-	printf("a4=%d\n",c4);
+	rsink_putInt(TAG_RESULT, 4, c4);
+	rsink_flush();
 }
 
 /*
@@ -53,6 +62,9 @@ Void taskMst(UArg a0, UArg a1)
 	Uint32 coreNum = 0;
 	coreNum = CSL_chipReadReg (CSL_CHIP_DNUM);
 
+	rsink_init(coreNum);
+	rsink_tag(TAG_RESULT, "result", RSINK_INT);
+
 	Task_Handle tsk;
 	if(coreNum==0){
 		tsk = Task_create(task0, NULL, NULL);
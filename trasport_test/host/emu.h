@@ -0,0 +1,82 @@
+/*
+ *  ======== emu.h ========
+ *  Internal interface of the host QMSS/CPPI/SYS-BIOS emulation that lets
+ *  the trasport_test programs build and run on Linux. See emu_bios.c for
+ *  the build line.
+ *
+ *  The four C6670 cores are four threads running the program's main(),
+ *  each task is one more thread of the core that created it. All of them
+ *  share one address space: globals that are private per core on the
+ *  DSP are shared here, so per-core state must be indexed by DNUM to
+ *  behave the same on both.
+ */
+
+#ifndef EMU_H_
+#define EMU_H_
+
+#include <stdio.h>
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+
+#define EMU_NUM_CORES       4
+
+/* SYS/BIOS Clock tick used by Task_sleep, in microseconds */
+#define EMU_TICK_US         1000
+
+/* accumulator timer tick, the unit of the pacing delays */
+#define EMU_ACC_TICK_US     25
+
+/* first queue handed out when the queue number is not specified */
+#define EMU_GP_QUEUE_BASE   896
+
+/*
+ *  ======== emu_hostAddr ========
+ *  Maps a C66x global L2 address (0x1n800000 + offset, see
+ *  l2_global_address in the programs) back to the host address it was
+ *  computed from. Other addresses are returned unchanged.
+ */
+void *emu_hostAddr(uintptr_t addr);
+
+/*
+ *  ======== emu_descSize ========
+ *  Size of the descriptor at desc from its memory region, 0 if desc is
+ *  in no region.
+ */
+uint32_t emu_descSize(void *desc);
+
+/*
+ *  ======== emu_regionDesc ========
+ *  Address and size of descriptor index of a memory region, NULL past
+ *  the end of the region.
+ */
+void *emu_regionDesc(int region, uint32_t index, uint32_t *descSize);
+
+/*
+ *  ======== emu_queueAlloc ========
+ *  Returns a general purpose queue number nobody has opened yet.
+ */
+int emu_queueAlloc(void);
+
+/*
+ *  ======== emu_raiseEvent ========
+ *  Runs the Hwi created for eventId on core, if any, in the calling
+ *  thread. Handlers of one core never run concurrently.
+ */
+void emu_raiseEvent(Uint32 core, Int eventId);
+
+/*
+ *  ======== emu_qmssReport / emu_cppiReport / emu_accReport ========
+ *  Print the queue, DMA and accumulator counters at the end of a run.
+ */
+void emu_qmssReport(FILE *fp);
+void emu_cppiReport(FILE *fp);
+void emu_accReport(FILE *fp);
+
+/*
+ *  ======== emu_finish ========
+ *  Prints the reports and ends the process with status stat.
+ */
+void emu_finish(int stat);
+
+#endif /* EMU_H_ */
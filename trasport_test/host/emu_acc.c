@@ -0,0 +1,261 @@
+/*
+ *  ======== emu_acc.c ========
+ *  Host emulation of the QMSS high priority accumulator (PDSP1 firmware).
+ *
+ *  A thread scans the enabled channels every accumulator timer tick. It
+ *  pops the watched queue into the page being filled and hands the page
+ *  to the host (count word, interrupt) when it is full or when the pacing
+ *  delay has run out. A page stays with the host until Qmss_ackInterrupt;
+ *  while both pages are with the host the channel leaves the queue alone.
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <ti/drv/qmss/qmss_firmware.h>
+
+#include "emu.h"
+
+/* high priority channels, channel n interrupts core n % 4 */
+#define EMU_ACC_HI_CHANNELS     32
+#define EMU_ACC_HI_EVENT        48
+
+typedef struct EmuAcc {
+	uint32_t active;
+	Qmss_AccCmdCfg cfg;
+	uint32_t *list;             /* host address of the ping/pong pages */
+	uint32_t page;              /* page being filled */
+	uint32_t count;             /* entries in it */
+	uint32_t owned;             /* pages with the host, not acked yet */
+	uint64_t lastIrq;           /* pacing times, us */
+	uint64_t firstNew;
+	uint64_t lastNew;
+	uint64_t interrupts;
+	uint64_t entries;
+} EmuAcc;
+
+/* the images Qmss_InitCfg.pdspFirmware names, never run */
+const unsigned int acc48_le[1];
+const unsigned int acc48_be[1];
+
+static EmuAcc emuAcc[EMU_ACC_HI_CHANNELS];
+static pthread_mutex_t emuAccLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t emuAccOnce = PTHREAD_ONCE_INIT;
+
+static uint64_t nowUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ *  ======== deadline ========
+ *  Time the pacing mode lets the page with entries go to the host.
+ */
+static uint64_t deadline(EmuAcc *a)
+{
+	uint64_t delay = (uint64_t)a->cfg.timerLoadCount * EMU_ACC_TICK_US;
+
+	switch (a->cfg.interruptPacingMode) {
+	case Qmss_AccPacingMode_LAST_INTERRUPT:
+		return a->lastIrq + delay;
+	case Qmss_AccPacingMode_FIRST_NEW_PACKET:
+		return a->firstNew + delay;
+	case Qmss_AccPacingMode_LAST_NEW_PACKET:
+		return a->lastNew + delay;
+	default:
+		return 0;
+	}
+}
+
+/*
+ *  ======== scan ========
+ */
+static void scan(uint32_t ch, EmuAcc *a, uint64_t now)
+{
+	uint32_t cap = a->cfg.maxPageEntries - 1;
+	uint32_t first = (a->cfg.listCountMode == Qmss_AccCountMode_ENTRY_COUNT);
+	uint32_t *page;
+	void *desc;
+
+	if (__atomic_load_n(&a->owned, __ATOMIC_ACQUIRE) >= 2) {
+		return;
+	}
+
+	page = a->list + a->page * a->cfg.maxPageEntries;
+	while (a->count < cap
+			&& (desc = Qmss_queuePop(a->cfg.queMgrIndex)) != NULL) {
+		if (a->count == 0) {
+			a->firstNew = now;
+		}
+		a->lastNew = now;
+		page[first + a->count++] = (uint32_t)(uintptr_t)desc;
+	}
+
+	if (a->count == 0 || (a->count < cap && now < deadline(a))) {
+		return;
+	}
+
+	if (first) {
+		page[0] = a->count;
+	} else {
+		page[a->count] = 0;
+	}
+
+	a->entries += a->count;
+	a->interrupts++;
+	a->lastIrq = now;
+	a->count = 0;
+	a->page ^= 1;
+	__atomic_add_fetch(&a->owned, 1, __ATOMIC_RELEASE);
+
+	emu_raiseEvent(ch % EMU_NUM_CORES,
+			EMU_ACC_HI_EVENT + ch / EMU_NUM_CORES);
+}
+
+/*
+ *  ======== accThread ========
+ */
+static void *accThread(void *arg)
+{
+	struct timespec tick = { 0, EMU_ACC_TICK_US * 1000 };
+	uint32_t ch;
+
+	(void)arg;
+
+	for (;;) {
+		nanosleep(&tick, NULL);
+		for (ch = 0; ch < EMU_ACC_HI_CHANNELS; ch++) {
+			if (__atomic_load_n(&emuAcc[ch].active, __ATOMIC_ACQUIRE)) {
+				scan(ch, &emuAcc[ch], nowUs());
+			}
+		}
+	}
+
+	return NULL;
+}
+
+static void accStart(void)
+{
+	pthread_t th;
+
+	if (pthread_create(&th, NULL, accThread, NULL) != 0) {
+		fprintf(stderr, "emu: cannot start the accumulator thread\n");
+		abort();
+	}
+	pthread_detach(th);
+}
+
+/*
+ *  ======== Qmss_programAccumulator ========
+ *  Single queue channels with Qmss_AccEntrySize_REG_D entries only.
+ */
+Qmss_Result Qmss_programAccumulator(Qmss_PdspId pdspId, Qmss_AccCmdCfg *cfg)
+{
+	EmuAcc *a;
+	Qmss_Result ret = QMSS_ACC_SOK;
+
+	if (pdspId != Qmss_PdspId_PDSP1 || cfg->channel >= EMU_ACC_HI_CHANNELS) {
+		return QMSS_ACC_INVALID_CHANNEL;
+	}
+	if (cfg->command == Qmss_AccCmd_DISABLE_CHANNEL) {
+		return Qmss_disableAccumulator(pdspId, cfg->channel);
+	}
+	if (cfg->command != Qmss_AccCmd_ENABLE_CHANNEL
+			|| cfg->multiQueueMode != Qmss_AccQueueMode_SINGLE_QUEUE
+			|| cfg->listEntrySize != Qmss_AccEntrySize_REG_D
+			|| cfg->maxPageEntries < 2) {
+		return QMSS_ACC_INVALID_COMMAND;
+	}
+
+	a = &emuAcc[cfg->channel];
+
+	pthread_mutex_lock(&emuAccLock);
+	if (a->active) {
+		ret = QMSS_ACC_CHANNEL_ALREADY_ACTIVE;
+	} else {
+		a->cfg = *cfg;
+		a->list = emu_hostAddr(cfg->listAddress);
+		a->page = 0;
+		a->count = 0;
+		a->owned = 0;
+		a->lastIrq = nowUs();
+		__atomic_store_n(&a->active, 1, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&emuAccLock);
+
+	pthread_once(&emuAccOnce, accStart);
+	return ret;
+}
+
+/*
+ *  ======== Qmss_disableAccumulator ========
+ */
+Qmss_Result Qmss_disableAccumulator(Qmss_PdspId pdspId, uint8_t channel)
+{
+	if (pdspId != Qmss_PdspId_PDSP1 || channel >= EMU_ACC_HI_CHANNELS) {
+		return QMSS_ACC_INVALID_CHANNEL;
+	}
+	if (!__atomic_exchange_n(&emuAcc[channel].active, 0, __ATOMIC_ACQ_REL)) {
+		return QMSS_ACC_CHANNEL_NOT_ACTIVE;
+	}
+	return QMSS_ACC_SOK;
+}
+
+/*
+ *  ======== Qmss_ackInterrupt ========
+ *  Gives value pages back to the channel.
+ */
+Qmss_Result Qmss_ackInterrupt(uint8_t interruptNum, uint8_t value)
+{
+	EmuAcc *a;
+	uint32_t owned;
+
+	if (interruptNum >= EMU_ACC_HI_CHANNELS) {
+		return QMSS_INVALID_PARAM;
+	}
+
+	a = &emuAcc[interruptNum];
+	owned = __atomic_load_n(&a->owned, __ATOMIC_RELAXED);
+	do {
+		if (owned < value) {
+			value = (uint8_t)owned;
+		}
+	} while (!__atomic_compare_exchange_n(&a->owned, &owned, owned - value,
+			1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== Qmss_setEoiVector ========
+ *  Interrupts are raised per page, nothing to re-arm.
+ */
+Qmss_Result Qmss_setEoiVector(Qmss_IntdInterruptType type, uint8_t accumCh)
+{
+	(void)type;
+	(void)accumCh;
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== emu_accReport ========
+ */
+void emu_accReport(FILE *fp)
+{
+	uint32_t ch;
+
+	for (ch = 0; ch < EMU_ACC_HI_CHANNELS; ch++) {
+		if (emuAcc[ch].interrupts == 0) {
+			continue;
+		}
+		fprintf(fp, "emu: acc %2u: %llu interrupts %llu entries "
+				"(%.1f per interrupt)\n", (unsigned)ch,
+				(unsigned long long)emuAcc[ch].interrupts,
+				(unsigned long long)emuAcc[ch].entries,
+				(double)emuAcc[ch].entries / emuAcc[ch].interrupts);
+	}
+}
@@ -0,0 +1,419 @@
+/*
+ *  ======== emu_bios.c ========
+ *  Host emulation of the SYS/BIOS Task, Semaphore, Hwi and BIOS calls and
+ *  the CSL hardware semaphores used by the trasport_test programs, and the
+ *  host main() that starts the four emulated C6670 cores. Together with
+ *  emu_qmss.c, emu_cppi.c and emu_acc.c it lets the QMSS/CPPI code be run
+ *  and debugged on Linux:
+ *
+ *      gcc -O2 -no-pie -Ihost/include -Dmain=emu_appMain \
+ *          -Wno-unknown-pragmas -Wno-pointer-to-int-cast \
+ *          -Wno-int-to-pointer-cast -o transport_host transport_main.c \
+ *          transport_desc.c transport_hdesc.c transport_bench.c \
+ *          transport_stats.c transport_latency.c transport_credit.c \
+ *          host/emu_bios.c host/emu_qmss.c host/emu_cppi.c host/emu_acc.c \
+ *          -lpthread
+ *
+ *  (main_qmss.c builds the same way in place of transport_main.c and the
+ *  transport_*.c files but transport_stats.c, transport_latency.c and
+ *  transport_ipc.c, with host/emu_ipc.c; the transport_sweep benchmark in
+ *  place of transport_main.c, transport_bench.c and transport_credit.c,
+ *  with transport_ring.c and transport_bcast.c.)
+ *  -no-pie keeps the program's addresses below 4 GB, where the 32-bit
+ *  descriptor and buffer pointers of the C66x code can hold them.
+ *
+ *      ./transport_host [ms]
+ *
+ *  runs the program for ms milliseconds (default 2000), then prints the
+ *  queue, DMA and accumulator counters on stderr and exits.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/csl/csl_chip.h>
+#include <ti/csl/csl_semAux.h>
+
+#include "emu.h"
+
+/* the program's main(), renamed by -Dmain=emu_appMain */
+#undef main
+extern int emu_appMain();
+
+#define EMU_MAX_PENDING     16
+#define EMU_MAX_HWI         16
+#define EMU_RUN_MS          2000
+
+typedef struct Task_Object {
+	Task_FuncPtr fxn;
+	UArg arg0;
+	UArg arg1;
+	Uint32 core;
+	pthread_t thread;
+} Task_Object;
+
+typedef struct Semaphore_Object {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	Int count;
+	Semaphore_Mode mode;
+} Semaphore_Object;
+
+typedef struct Hwi_Object {
+	Hwi_FuncPtr fxn;
+	UArg arg;
+	Int eventId;
+} Hwi_Object;
+
+/* tasks created before BIOS_start and interrupt handlers, per core */
+typedef struct EmuCore {
+	int started;
+	int numPending;
+	Task_Object *pending[EMU_MAX_PENDING];
+	pthread_mutex_t hwiLock;
+	int numHwi;
+	Hwi_Object hwi[EMU_MAX_HWI];
+} EmuCore;
+
+static __thread Uint32 emuCore;
+static EmuCore emuCores[EMU_NUM_CORES] = {
+	[0 ... EMU_NUM_CORES - 1] = { .hwiLock = PTHREAD_MUTEX_INITIALIZER }
+};
+static pthread_mutex_t emuExitLock = PTHREAD_MUTEX_INITIALIZER;
+static Uint8 emuHwSem[EMU_NUM_HW_SEM];
+
+/*
+ *  ======== emu_coreNum ========
+ */
+Uint32 emu_coreNum(void)
+{
+	return emuCore;
+}
+
+/*
+ *  ======== taskThread ========
+ */
+static void *taskThread(void *arg)
+{
+	Task_Object *task = (Task_Object *)arg;
+
+	emuCore = task->core;
+	task->fxn(task->arg0, task->arg1);
+	return NULL;
+}
+
+static void taskStart(Task_Object *task)
+{
+	if (pthread_create(&task->thread, NULL, taskThread, task) != 0) {
+		fprintf(stderr, "emu: cannot start a task\n");
+		abort();
+	}
+	pthread_detach(task->thread);
+}
+
+/*
+ *  ======== Task_Params_init ========
+ */
+Void Task_Params_init(Task_Params *params)
+{
+	memset(params, 0, sizeof(*params));
+	params->priority = 1;
+	params->stackSize = 2048;
+	params->vitalTaskFlag = TRUE;
+}
+
+/*
+ *  ======== Task_create ========
+ *  Tasks created before BIOS_start wait for it, like on the DSP; later
+ *  ones start right away.
+ */
+Task_Handle Task_create(Task_FuncPtr fxn, const Task_Params *params,
+		Error_Block *eb)
+{
+	EmuCore *core = &emuCores[emuCore];
+	Task_Object *task;
+
+	(void)eb;
+
+	task = calloc(1, sizeof(*task));
+	if (task == NULL) {
+		return NULL;
+	}
+	task->fxn = fxn;
+	task->core = emuCore;
+	if (params != NULL) {
+		task->arg0 = params->arg0;
+		task->arg1 = params->arg1;
+	}
+
+	if (core->started) {
+		taskStart(task);
+	} else if (core->numPending < EMU_MAX_PENDING) {
+		core->pending[core->numPending++] = task;
+	} else {
+		free(task);
+		return NULL;
+	}
+	return task;
+}
+
+/*
+ *  ======== Task_sleep ========
+ */
+Void Task_sleep(UInt32 nticks)
+{
+	struct timespec ts;
+	uint64_t us = (uint64_t)nticks * EMU_TICK_US;
+
+	ts.tv_sec = us / 1000000;
+	ts.tv_nsec = (us % 1000000) * 1000;
+	nanosleep(&ts, NULL);
+}
+
+/*
+ *  ======== Task_yield ========
+ */
+Void Task_yield(Void)
+{
+	sched_yield();
+}
+
+/*
+ *  ======== Task_exit ========
+ */
+Void Task_exit(Void)
+{
+	pthread_exit(NULL);
+}
+
+/*
+ *  ======== Semaphore_Params_init ========
+ */
+Void Semaphore_Params_init(Semaphore_Params *params)
+{
+	params->mode = Semaphore_Mode_COUNTING;
+}
+
+/*
+ *  ======== Semaphore_create ========
+ */
+Semaphore_Handle Semaphore_create(Int count, const Semaphore_Params *params,
+		Error_Block *eb)
+{
+	Semaphore_Object *sem;
+
+	(void)eb;
+
+	sem = calloc(1, sizeof(*sem));
+	if (sem == NULL) {
+		return NULL;
+	}
+	pthread_mutex_init(&sem->lock, NULL);
+	pthread_cond_init(&sem->cond, NULL);
+	sem->mode = (params != NULL) ? params->mode : Semaphore_Mode_COUNTING;
+	sem->count = (sem->mode == Semaphore_Mode_BINARY && count > 1) ? 1 : count;
+	return sem;
+}
+
+/*
+ *  ======== Semaphore_pend ========
+ */
+Bool Semaphore_pend(Semaphore_Handle sem, UInt32 timeout)
+{
+	struct timespec ts;
+	uint64_t ns;
+	Bool ok = TRUE;
+
+	pthread_mutex_lock(&sem->lock);
+
+	if (timeout == BIOS_WAIT_FOREVER) {
+		while (sem->count == 0) {
+			pthread_cond_wait(&sem->cond, &sem->lock);
+		}
+	} else {
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ns = ts.tv_nsec + (uint64_t)timeout * EMU_TICK_US * 1000;
+		ts.tv_sec += ns / 1000000000;
+		ts.tv_nsec = ns % 1000000000;
+		while (sem->count == 0 && ok) {
+			ok = (pthread_cond_timedwait(&sem->cond, &sem->lock, &ts) == 0)
+					|| sem->count > 0;
+		}
+	}
+
+	if (ok) {
+		sem->count--;
+	}
+
+	pthread_mutex_unlock(&sem->lock);
+	return ok;
+}
+
+/*
+ *  ======== Semaphore_post ========
+ */
+Void Semaphore_post(Semaphore_Handle sem)
+{
+	pthread_mutex_lock(&sem->lock);
+	if (sem->mode == Semaphore_Mode_COUNTING || sem->count == 0) {
+		sem->count++;
+	}
+	pthread_cond_signal(&sem->cond);
+	pthread_mutex_unlock(&sem->lock);
+}
+
+/*
+ *  ======== Semaphore_getCount ========
+ */
+Int Semaphore_getCount(Semaphore_Handle sem)
+{
+	return __atomic_load_n(&sem->count, __ATOMIC_RELAXED);
+}
+
+/*
+ *  ======== Hwi_Params_init ========
+ */
+Void Hwi_Params_init(Hwi_Params *params)
+{
+	memset(params, 0, sizeof(*params));
+	params->eventId = -1;
+	params->priority = -1;
+	params->enableInt = TRUE;
+}
+
+/*
+ *  ======== Hwi_create ========
+ */
+Hwi_Handle Hwi_create(Int intNum, Hwi_FuncPtr hwiFxn,
+		const Hwi_Params *params, Error_Block *eb)
+{
+	EmuCore *core = &emuCores[emuCore];
+	Hwi_Object *hwi = NULL;
+
+	(void)intNum;
+	(void)eb;
+
+	pthread_mutex_lock(&core->hwiLock);
+	if (params != NULL && core->numHwi < EMU_MAX_HWI) {
+		hwi = &core->hwi[core->numHwi++];
+		hwi->fxn = hwiFxn;
+		hwi->arg = params->arg;
+		hwi->eventId = params->eventId;
+	}
+	pthread_mutex_unlock(&core->hwiLock);
+
+	return hwi;
+}
+
+/*
+ *  ======== emu_raiseEvent ========
+ */
+void emu_raiseEvent(Uint32 core, Int eventId)
+{
+	EmuCore *c = &emuCores[core % EMU_NUM_CORES];
+	int i;
+
+	pthread_mutex_lock(&c->hwiLock);
+	for (i = 0; i < c->numHwi; i++) {
+		if (c->hwi[i].eventId == eventId) {
+			c->hwi[i].fxn(c->hwi[i].arg);
+		}
+	}
+	pthread_mutex_unlock(&c->hwiLock);
+}
+
+/*
+ *  ======== CSL_semAcquireDirect ========
+ */
+Uint8 CSL_semAcquireDirect(Uint8 semNum)
+{
+	return __atomic_exchange_n(&emuHwSem[semNum % EMU_NUM_HW_SEM], 1,
+			__ATOMIC_ACQUIRE) == 0;
+}
+
+/*
+ *  ======== CSL_semReleaseSemaphore ========
+ */
+void CSL_semReleaseSemaphore(Uint8 semNum)
+{
+	__atomic_store_n(&emuHwSem[semNum % EMU_NUM_HW_SEM], 0, __ATOMIC_RELEASE);
+}
+
+/*
+ *  ======== BIOS_start ========
+ *  Starts the core's pending tasks; the calling thread is the core's
+ *  idle loop and just goes away.
+ */
+Void BIOS_start(Void)
+{
+	EmuCore *core = &emuCores[emuCore];
+	int i;
+
+	core->started = 1;
+	for (i = 0; i < core->numPending; i++) {
+		taskStart(core->pending[i]);
+	}
+	core->numPending = 0;
+
+	pthread_exit(NULL);
+}
+
+/*
+ *  ======== BIOS_exit ========
+ */
+Void BIOS_exit(Int stat)
+{
+	emu_finish(stat);
+}
+
+/*
+ *  ======== emu_finish ========
+ */
+void emu_finish(int stat)
+{
+	pthread_mutex_lock(&emuExitLock);
+	fflush(stdout);
+	emu_qmssReport(stderr);
+	emu_cppiReport(stderr);
+	emu_accReport(stderr);
+	exit(stat);
+}
+
+/*
+ *  ======== coreThread ========
+ */
+static void *coreThread(void *arg)
+{
+	emuCore = (Uint32)(uintptr_t)arg;
+	emu_appMain();
+	return NULL;
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+	pthread_t th;
+	uintptr_t i;
+	long ms = (argc > 1) ? strtol(argv[1], NULL, 0) : EMU_RUN_MS;
+
+	for (i = 0; i < EMU_NUM_CORES; i++) {
+		if (pthread_create(&th, NULL, coreThread, (void *)i) != 0) {
+			fprintf(stderr, "emu: cannot start core %u\n", (unsigned)i);
+			return 1;
+		}
+		pthread_detach(th);
+	}
+
+	Task_sleep((UInt32)(ms * 1000 / EMU_TICK_US));
+	emu_finish(0);
+	return 0;
+}
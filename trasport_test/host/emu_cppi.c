@@ -0,0 +1,724 @@
+/*
+ *  ======== emu_cppi.c ========
+ *  Host emulation of the CPPI LLD for the QMSS infrastructure PKTDMA:
+ *  descriptor initialization, Tx/Rx channels, Rx flows and a DMA thread
+ *  that moves packets from the Tx queues to the Rx flows.
+ *
+ *  Tx channel n takes descriptors from queue QMSS_INFRASTRUCTURE_QUEUE_BASE
+ *  + n and is looped back to Rx channel n; both must be enabled for the
+ *  channel to move data. Monolithic and host descriptors are moved, the
+ *  latter with linked buffers on both sides; EPIB and PS words are not. Channels, flows and the DMA state are only
+ *  touched by the DMA thread once enabled, so the data path is lock free.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <ti/drv/cppi/cppi_drv.h>
+
+#include "emu.h"
+
+/* idle DMA loops before the thread starts to sleep between polls */
+#define EMU_DMA_SPIN    1000
+
+typedef struct EmuChannel {
+	uint32_t num;
+	uint32_t opened;
+	uint32_t enabled;
+	int isTx;
+} EmuChannel;
+
+typedef struct EmuFlow {
+	uint32_t opened;
+	Cppi_RxFlowCfg cfg;
+} EmuFlow;
+
+typedef struct EmuDmaStats {
+	uint64_t packets;
+	uint64_t bytes;
+	uint64_t starved;               /* no free Rx descriptor */
+	uint64_t dropped;               /* starved without retry, bad flow */
+	uint64_t oversize;              /* payload did not fit */
+} EmuDmaStats;
+
+Cppi_GlobalConfigParams cppiGblCfgParams;
+
+static EmuChannel emuTxCh[CPPI_MAX_TX_CH];
+static EmuChannel emuRxCh[CPPI_MAX_RX_CH];
+static EmuFlow emuFlows[CPPI_MAX_RX_FLOW];
+static pthread_mutex_t emuCppiLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t emuDmaOnce = PTHREAD_ONCE_INIT;
+static uint32_t emuCppiInitialized;
+static EmuDmaStats emuDma;
+
+/* Tx descriptor waiting for a free Rx descriptor, per channel */
+static Cppi_Desc *emuPending[CPPI_MAX_TX_CH];
+
+/* the QMSS CPDMA instance, the handle Cppi_open returns */
+static int emuQmssCpdma;
+
+/*
+ *  ======== queueOf ========
+ */
+static Qmss_QueueHnd queueOf(uint16_t qMgr, uint16_t qNum)
+{
+	Qmss_Queue queue;
+
+	queue.qMgr = qMgr;
+	queue.qNum = qNum;
+	return Qmss_getQueueHandle(queue);
+}
+
+/*
+ *  ======== freeQueue ========
+ *  Free descriptor queue of flow f for a packet of len bytes, from the
+ *  size thresholds (in 32-byte units).
+ */
+static Qmss_QueueHnd freeQueue(const Cppi_RxFlowCfg *f, uint32_t len)
+{
+	if (f->rx_size_thresh0_en && len > ((uint32_t)f->rx_size_thresh0 << 5)) {
+		if (f->rx_size_thresh1_en
+				&& len > ((uint32_t)f->rx_size_thresh1 << 5)) {
+			if (f->rx_size_thresh2_en
+					&& len > ((uint32_t)f->rx_size_thresh2 << 5)) {
+				return queueOf(f->rx_fdq0_sz3_qmgr, f->rx_fdq0_sz3_qnum);
+			}
+			return queueOf(f->rx_fdq0_sz2_qmgr, f->rx_fdq0_sz2_qnum);
+		}
+		return queueOf(f->rx_fdq0_sz1_qmgr, f->rx_fdq0_sz1_qnum);
+	}
+	return queueOf(f->rx_fdq0_sz0_qmgr, f->rx_fdq0_sz0_qnum);
+}
+
+/*
+ *  ======== nextBD ========
+ */
+static Cppi_Desc *nextBD(Cppi_Desc *desc)
+{
+	return (Cppi_Desc *)emu_hostAddr(
+			((Cppi_HostDesc *)desc)->nextBDPtr);
+}
+
+/*
+ *  ======== recycle ========
+ *  Sends a Tx packet back: a monolithic descriptor or a host chain with
+ *  Cppi_ReturnPolicy_RETURN_ENTIRE_PACKET goes to the return queue of the
+ *  SOP descriptor in one piece, the descriptors of a host chain with
+ *  Cppi_ReturnPolicy_RETURN_BUFFER each to their own return queue.
+ */
+static void recycle(Cppi_Desc *desc)
+{
+	Cppi_DescType type = Cppi_getDescType(desc);
+	Cppi_Desc *next;
+	Qmss_Queue ret;
+
+	if (type == Cppi_DescType_MONOLITHIC
+			|| !((((uint32_t *)desc)[2] >> CPPI_RETURN_POLICY_SHIFT) & 1)) {
+		ret = Cppi_getReturnQueue(type, desc);
+		Qmss_queuePushDesc(Qmss_getQueueHandle(ret), desc);
+		return;
+	}
+
+	for (; desc != NULL; desc = next) {
+		next = nextBD(desc);
+		ret = Cppi_getReturnQueue(type, desc);
+		Qmss_queuePushDesc(Qmss_getQueueHandle(ret), desc);
+	}
+}
+
+/*
+ *  ======== EmuSeg ========
+ *  Reads the payload of a Tx packet across the buffers of a host chain.
+ */
+typedef struct EmuSeg {
+	Cppi_Desc *desc;
+	uint8_t *ptr;
+	uint32_t left;              /* bytes left in the current buffer */
+} EmuSeg;
+
+static void segStart(EmuSeg *s, Cppi_Desc *tx)
+{
+	uint8_t *buf;
+
+	s->desc = tx;
+	Cppi_getData(Cppi_getDescType(tx), tx, &buf, &s->left);
+	s->ptr = emu_hostAddr((uintptr_t)buf);
+}
+
+/*
+ *  ======== segCopy ========
+ *  Copies up to n bytes to dst, returns how many the chain still had.
+ */
+static uint32_t segCopy(EmuSeg *s, uint8_t *dst, uint32_t n)
+{
+	uint32_t done = 0, k;
+
+	while (done < n) {
+		if (s->left == 0) {
+			if (Cppi_getDescType(s->desc) != Cppi_DescType_HOST
+					|| (s->desc = nextBD(s->desc)) == NULL) {
+				break;
+			}
+			segStart(s, s->desc);
+			continue;
+		}
+		k = (s->left < n - done) ? s->left : n - done;
+		memcpy(dst + done, s->ptr, k);
+		s->ptr += k;
+		s->left -= k;
+		done += k;
+	}
+	return done;
+}
+
+/*
+ *  ======== hostFreeQueue ========
+ *  Free descriptor queue for buffer index of a host packet: the SOP one
+ *  by size, then rx_fdq1, rx_fdq2 and rx_fdq3 for all the others.
+ */
+static Qmss_QueueHnd hostFreeQueue(const Cppi_RxFlowCfg *f, uint32_t index,
+		uint32_t len)
+{
+	switch (index) {
+	case 0:
+		return freeQueue(f, len);
+	case 1:
+		return queueOf(f->rx_fdq1_qmgr, f->rx_fdq1_qnum);
+	case 2:
+		return queueOf(f->rx_fdq2_qmgr, f->rx_fdq2_qnum);
+	default:
+		return queueOf(f->rx_fdq3_qmgr, f->rx_fdq3_qnum);
+	}
+}
+
+/*
+ *  ======== rxMono ========
+ *  Receives len bytes into one monolithic descriptor. Returns it, NULL
+ *  when the free queue is empty.
+ */
+static Cppi_Desc *rxMono(const Cppi_RxFlowCfg *f, EmuSeg *src, uint32_t len,
+		Cppi_DescTag *tag)
+{
+	Cppi_Desc *rx;
+	uint32_t room;
+
+	rx = (Cppi_Desc *)Qmss_queuePop(freeQueue(f, len));
+	if (rx == NULL) {
+		return NULL;
+	}
+
+	room = emu_descSize(rx);
+	if (room < f->rx_sop_offset + len) {
+		emuDma.oversize++;
+		len = (room > f->rx_sop_offset) ? room - f->rx_sop_offset : 0;
+	}
+
+	((Cppi_MonolithicDesc *)rx)->descInfo =
+			(Cppi_DescType_MONOLITHIC << CPPI_DESC_TYPE_SHIFT);
+	Cppi_setDataOffset(Cppi_DescType_MONOLITHIC, rx, f->rx_sop_offset);
+	len = segCopy(src, (uint8_t *)rx + f->rx_sop_offset, len);
+	Cppi_setPacketLen(Cppi_DescType_MONOLITHIC, rx, len);
+	Cppi_setTag(Cppi_DescType_MONOLITHIC, rx, tag);
+	return rx;
+}
+
+/*
+ *  ======== rxHost ========
+ *  Scatters len bytes over host descriptors from the flow's free queues,
+ *  each filling the buffer attached to it (the original buffer words).
+ *  Returns the SOP descriptor, NULL when a free queue is empty; the
+ *  descriptors taken until then go back. Rx buffers are never shared by
+ *  two packets, like on the PKTDMA.
+ */
+static Cppi_Desc *rxHost(const Cppi_RxFlowCfg *f, EmuSeg *src, uint32_t len,
+		Cppi_DescTag *tag)
+{
+	Cppi_Desc *sop = NULL, *tail = NULL, *rx, *next;
+	uint8_t *buf;
+	uint32_t room, index = 0, left = len;
+
+	do {
+		rx = (Cppi_Desc *)Qmss_queuePop(hostFreeQueue(f, index, len));
+		if (rx == NULL) {
+			for (index = 0, rx = sop; rx != NULL; rx = next, index++) {
+				next = nextBD(rx);
+				Qmss_queuePushDesc(hostFreeQueue(f, index, len), rx);
+			}
+			return NULL;
+		}
+
+		Cppi_getOriginalBufInfo(Cppi_DescType_HOST, rx, &buf, &room);
+		room = segCopy(src, emu_hostAddr((uintptr_t)buf),
+				(room < left) ? room : left);
+		if (room == 0) {
+			// empty buffer or short Tx chain: end the packet here
+			emuDma.oversize++;
+			len -= left;
+			left = 0;
+		}
+		left -= room;
+
+		Cppi_setData(Cppi_DescType_HOST, rx, buf, room);
+		Cppi_linkNextBD(Cppi_DescType_HOST, rx, NULL);
+		if (sop == NULL) {
+			sop = rx;
+		} else {
+			Cppi_linkNextBD(Cppi_DescType_HOST, tail, rx);
+		}
+		tail = rx;
+		index++;
+	} while (left > 0);
+
+	((Cppi_HostDesc *)sop)->descInfo =
+			(Cppi_DescType_HOST << CPPI_DESC_TYPE_SHIFT);
+	Cppi_setPacketLen(Cppi_DescType_HOST, sop, len);
+	Cppi_setTag(Cppi_DescType_HOST, sop, tag);
+	return sop;
+}
+
+/*
+ *  ======== dmaPacket ========
+ *  Moves one Tx packet, a monolithic descriptor or a host chain, to a
+ *  monolithic descriptor or a host chain as the flow says. Returns 0 if
+ *  it has to wait for free Rx descriptors, 1 once it is consumed.
+ */
+static int dmaPacket(Cppi_Desc *tx)
+{
+	Cppi_DescType type = Cppi_getDescType(tx);
+	Cppi_DescTag tag = Cppi_getTag(type, tx);
+	Cppi_RxFlowCfg *f;
+	Cppi_Desc *rx;
+	EmuSeg src;
+	uint32_t len;
+
+	if (tag.srcTagLo >= CPPI_MAX_RX_FLOW || !emuFlows[tag.srcTagLo].opened) {
+		emuDma.dropped++;
+		recycle(tx);
+		return 1;
+	}
+	f = &emuFlows[tag.srcTagLo].cfg;
+
+	/* selector 1 overwrites a tag byte with the flow's value, the others
+	 * (keep it, or take it from the flow id or the PS words) keep it here
+	 */
+	if (f->rx_dest_tag_lo_sel == 1) {
+		tag.destTagLo = f->rx_dest_tag_lo;
+	}
+	if (f->rx_dest_tag_hi_sel == 1) {
+		tag.destTagHi = f->rx_dest_tag_hi;
+	}
+	if (f->rx_src_tag_lo_sel == 1) {
+		tag.srcTagLo = f->rx_src_tag_lo;
+	}
+	if (f->rx_src_tag_hi_sel == 1) {
+		tag.srcTagHi = f->rx_src_tag_hi;
+	}
+
+	len = Cppi_getPacketLen(type, tx);
+	segStart(&src, tx);
+
+	if (f->rx_desc_type == Cppi_DescType_HOST) {
+		rx = rxHost(f, &src, len, &tag);
+	} else {
+		rx = rxMono(f, &src, len, &tag);
+	}
+	if (rx == NULL) {
+		emuDma.starved++;
+		if (f->rx_error_handling) {
+			return 0;
+		}
+		emuDma.dropped++;
+		recycle(tx);
+		return 1;
+	}
+
+	emuDma.packets++;
+	emuDma.bytes += Cppi_getPacketLen(Cppi_getDescType(rx), rx);
+
+	Qmss_queuePushDesc(queueOf(f->rx_dest_qmgr, f->rx_dest_qnum), rx);
+	recycle(tx);
+	return 1;
+}
+
+/*
+ *  ======== dmaThread ========
+ *  Polls the Tx queues of the enabled channels, backing off to short
+ *  sleeps when there is nothing to move.
+ */
+static void *dmaThread(void *arg)
+{
+	struct timespec nap = { 0, 10000 };
+	uint32_t ch;
+	int idle = 0;
+	int moved;
+	Cppi_Desc *desc;
+
+	(void)arg;
+
+	for (;;) {
+		moved = 0;
+
+		for (ch = 0; ch < CPPI_MAX_TX_CH; ch++) {
+			if (!__atomic_load_n(&emuTxCh[ch].enabled, __ATOMIC_ACQUIRE)
+					|| !__atomic_load_n(&emuRxCh[ch].enabled,
+							__ATOMIC_ACQUIRE)) {
+				continue;
+			}
+
+			desc = emuPending[ch];
+			if (desc == NULL) {
+				desc = (Cppi_Desc *)Qmss_queuePop(
+						QMSS_INFRASTRUCTURE_QUEUE_BASE + ch);
+			}
+			if (desc == NULL) {
+				continue;
+			}
+
+			if (dmaPacket(desc)) {
+				emuPending[ch] = NULL;
+				moved = 1;
+			} else {
+				emuPending[ch] = desc;
+			}
+		}
+
+		if (moved) {
+			idle = 0;
+		} else if (++idle < EMU_DMA_SPIN) {
+			sched_yield();
+		} else {
+			nanosleep(&nap, NULL);
+		}
+	}
+
+	return NULL;
+}
+
+static void dmaStart(void)
+{
+	pthread_t th;
+
+	if (pthread_create(&th, NULL, dmaThread, NULL) != 0) {
+		fprintf(stderr, "emu: cannot start the DMA thread\n");
+		abort();
+	}
+	pthread_detach(th);
+}
+
+/*
+ *  ======== Cppi_init ========
+ */
+Cppi_Result Cppi_init(Cppi_GlobalConfigParams *cppiGblCfgParams)
+{
+	uint32_t ch;
+
+	(void)cppiGblCfgParams;
+
+	for (ch = 0; ch < CPPI_MAX_TX_CH; ch++) {
+		emuTxCh[ch].num = ch;
+		emuTxCh[ch].isTx = 1;
+		emuRxCh[ch].num = ch;
+	}
+	__atomic_store_n(&emuCppiInitialized, 1, __ATOMIC_RELEASE);
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_exit ========
+ */
+Cppi_Result Cppi_exit(void)
+{
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_open ========
+ *  Only the QMSS CPDMA exists in the emulation.
+ */
+Cppi_Handle Cppi_open(Cppi_CpDmaInitCfg *initCfg)
+{
+	if (!__atomic_load_n(&emuCppiInitialized, __ATOMIC_ACQUIRE)
+			|| initCfg == NULL || initCfg->dmaNum != Cppi_CpDma_QMSS_CPDMA) {
+		return NULL;
+	}
+
+	pthread_once(&emuDmaOnce, dmaStart);
+	return &emuQmssCpdma;
+}
+
+/*
+ *  ======== Cppi_close ========
+ */
+Cppi_Result Cppi_close(Cppi_Handle hnd)
+{
+	(void)hnd;
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== channelOpen ========
+ */
+static EmuChannel *channelOpen(EmuChannel *table, int max, int32_t num,
+		int enable, uint8_t *isAllocated)
+{
+	EmuChannel *c = NULL;
+	int i;
+
+	pthread_mutex_lock(&emuCppiLock);
+
+	if (num == CPPI_PARAM_NOT_SPECIFIED) {
+		for (i = 0; i < max; i++) {
+			if (!table[i].opened) {
+				c = &table[i];
+				break;
+			}
+		}
+	} else if (num >= 0 && num < max) {
+		c = &table[num];
+	}
+
+	if (c != NULL) {
+		c->opened++;
+		if (isAllocated != NULL) {
+			*isAllocated = (uint8_t)c->opened;
+		}
+		if (enable) {
+			__atomic_store_n(&c->enabled, 1, __ATOMIC_RELEASE);
+		}
+	}
+
+	pthread_mutex_unlock(&emuCppiLock);
+	return c;
+}
+
+/*
+ *  ======== Cppi_txChannelOpen ========
+ */
+Cppi_ChHnd Cppi_txChannelOpen(Cppi_Handle hnd, Cppi_TxChInitCfg *txChCfg,
+		uint8_t *isAllocated)
+{
+	if (hnd != &emuQmssCpdma || txChCfg == NULL) {
+		return NULL;
+	}
+	return channelOpen(emuTxCh, CPPI_MAX_TX_CH, txChCfg->channelNum,
+			txChCfg->txEnable == Cppi_ChState_CHANNEL_ENABLE, isAllocated);
+}
+
+/*
+ *  ======== Cppi_rxChannelOpen ========
+ */
+Cppi_ChHnd Cppi_rxChannelOpen(Cppi_Handle hnd, Cppi_RxChInitCfg *rxChCfg,
+		uint8_t *isAllocated)
+{
+	if (hnd != &emuQmssCpdma || rxChCfg == NULL) {
+		return NULL;
+	}
+	return channelOpen(emuRxCh, CPPI_MAX_RX_CH, rxChCfg->channelNum,
+			rxChCfg->rxEnable == Cppi_ChState_CHANNEL_ENABLE, isAllocated);
+}
+
+/*
+ *  ======== Cppi_channelEnable ========
+ */
+Cppi_Result Cppi_channelEnable(Cppi_ChHnd hnd)
+{
+	if (hnd == NULL) {
+		return CPPI_INVALID_PARAM;
+	}
+	__atomic_store_n(&((EmuChannel *)hnd)->enabled, 1, __ATOMIC_RELEASE);
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_channelDisable ========
+ */
+Cppi_Result Cppi_channelDisable(Cppi_ChHnd hnd)
+{
+	if (hnd == NULL) {
+		return CPPI_INVALID_PARAM;
+	}
+	__atomic_store_n(&((EmuChannel *)hnd)->enabled, 0, __ATOMIC_RELEASE);
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_channelClose ========
+ */
+Cppi_Result Cppi_channelClose(Cppi_ChHnd hnd)
+{
+	EmuChannel *c = (EmuChannel *)hnd;
+
+	if (c == NULL) {
+		return CPPI_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&emuCppiLock);
+	if (c->opened > 0 && --c->opened == 0) {
+		__atomic_store_n(&c->enabled, 0, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&emuCppiLock);
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_getChID ========
+ */
+uint32_t Cppi_getChID(Cppi_ChHnd hnd)
+{
+	return ((EmuChannel *)hnd)->num;
+}
+
+/*
+ *  ======== Cppi_configureRxFlow ========
+ *  The configuration is copied before the flow is marked open, so the
+ *  DMA thread never sees a half written flow.
+ */
+Cppi_FlowHnd Cppi_configureRxFlow(Cppi_Handle hnd, Cppi_RxFlowCfg *cfg,
+		uint8_t *isAllocated)
+{
+	EmuFlow *f = NULL;
+	int i;
+
+	if (hnd != &emuQmssCpdma || cfg == NULL) {
+		return NULL;
+	}
+
+	pthread_mutex_lock(&emuCppiLock);
+
+	if (cfg->flowIdNum == CPPI_PARAM_NOT_SPECIFIED) {
+		for (i = 0; i < CPPI_MAX_RX_FLOW; i++) {
+			if (!emuFlows[i].opened) {
+				f = &emuFlows[i];
+				cfg->flowIdNum = (int16_t)i;
+				break;
+			}
+		}
+	} else if (cfg->flowIdNum >= 0 && cfg->flowIdNum < CPPI_MAX_RX_FLOW) {
+		f = &emuFlows[cfg->flowIdNum];
+	}
+
+	if (f != NULL) {
+		if (!f->opened) {
+			f->cfg = *cfg;
+		}
+		__atomic_add_fetch(&f->opened, 1, __ATOMIC_RELEASE);
+		if (isAllocated != NULL) {
+			*isAllocated = (uint8_t)f->opened;
+		}
+	}
+
+	pthread_mutex_unlock(&emuCppiLock);
+	return f;
+}
+
+/*
+ *  ======== Cppi_closeRxFlow ========
+ */
+Cppi_Result Cppi_closeRxFlow(Cppi_FlowHnd hnd)
+{
+	EmuFlow *f = (EmuFlow *)hnd;
+
+	if (f == NULL) {
+		return CPPI_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&emuCppiLock);
+	if (f->opened > 0) {
+		__atomic_sub_fetch(&f->opened, 1, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&emuCppiLock);
+	return CPPI_SOK;
+}
+
+/*
+ *  ======== Cppi_getFlowId ========
+ */
+uint32_t Cppi_getFlowId(Cppi_FlowHnd hnd)
+{
+	return (uint32_t)(((EmuFlow *)hnd) - emuFlows);
+}
+
+/*
+ *  ======== Cppi_initDescriptor ========
+ *  Formats descNum unused descriptors of the region and pushes them to
+ *  the destination queue.
+ */
+Qmss_QueueHnd Cppi_initDescriptor(Cppi_DescCfg *descCfg,
+		uint32_t *numAllocated)
+{
+	static uint32_t regionUsed[QMSS_MAX_MEM_REGIONS];
+	Qmss_QueueHnd dest;
+	Qmss_Queue ret;
+	Cppi_Desc *desc;
+	uint32_t *w;
+	uint32_t i, descSize;
+	uint8_t isAllocated;
+
+	*numAllocated = 0;
+	if (descCfg == NULL || descCfg->memRegion < 0
+			|| descCfg->memRegion >= QMSS_MAX_MEM_REGIONS) {
+		return QMSS_INVALID_PARAM;
+	}
+
+	dest = Qmss_queueOpen(descCfg->queueType, descCfg->destQueueNum,
+			&isAllocated);
+	if (dest < 0) {
+		return dest;
+	}
+
+	ret = descCfg->returnQueue;
+	if (ret.qNum == 0xffff) {
+		ret = Qmss_getQueueNumber(dest);
+	}
+
+	pthread_mutex_lock(&emuCppiLock);
+
+	for (i = 0; i < descCfg->descNum; i++) {
+		desc = emu_regionDesc(descCfg->memRegion,
+				regionUsed[descCfg->memRegion], &descSize);
+		if (desc == NULL) {
+			break;
+		}
+		regionUsed[descCfg->memRegion]++;
+
+		if (descCfg->initDesc == Cppi_InitDesc_INIT_DESCRIPTOR) {
+			memset(desc, 0, descSize);
+			w = (uint32_t *)desc;
+			w[0] = (uint32_t)descCfg->descType << CPPI_DESC_TYPE_SHIFT;
+			if (descCfg->epibPresent) {
+				w[2] |= 1u << 31;
+			}
+			if (descCfg->descType == Cppi_DescType_MONOLITHIC) {
+				Cppi_setDataOffset(descCfg->descType, desc,
+						descCfg->cfg.mono.dataOffset);
+			} else {
+				w[2] |= (uint32_t)descCfg->cfg.host.returnPolicy
+						<< CPPI_RETURN_POLICY_SHIFT;
+			}
+			Cppi_setReturnQueue(descCfg->descType, desc, ret);
+		}
+
+		Qmss_queuePushDesc(dest, desc);
+		(*numAllocated)++;
+	}
+
+	pthread_mutex_unlock(&emuCppiLock);
+	return dest;
+}
+
+/*
+ *  ======== emu_cppiReport ========
+ */
+void emu_cppiReport(FILE *fp)
+{
+	fprintf(fp, "emu: pktdma: %llu packets %llu bytes, %llu starved "
+			"%llu dropped %llu oversize\n",
+			(unsigned long long)emuDma.packets,
+			(unsigned long long)emuDma.bytes,
+			(unsigned long long)emuDma.starved,
+			(unsigned long long)emuDma.dropped,
+			(unsigned long long)emuDma.oversize);
+}
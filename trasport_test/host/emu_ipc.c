@@ -0,0 +1,333 @@
+/*
+ *  ======== emu_ipc.c ========
+ *  Host emulation of the IPC GateMP, HeapMemMP and ListMP calls used by
+ *  main_qmss.c's IPC backend (transport_ipc.c).
+ *
+ *  SharedRegion 0 is a static block in the program's data, below 4 GB
+ *  like the descriptors, so shared region pointers can stay 32-bit
+ *  addresses. Objects created by name are found by ListMP_open and the
+ *  others from any emulated core; their shared state is in the region,
+ *  their handles are host memory.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <ti/ipc/GateMP.h>
+#include <ti/ipc/HeapMemMP.h>
+#include <ti/ipc/ListMP.h>
+#include <ti/ipc/SharedRegion.h>
+
+#include "emu.h"
+
+#define EMU_SR0_SIZE        0x00100000
+#define EMU_SR0_ALIGN       128
+#define EMU_MAX_NAMED       32
+
+typedef enum EmuIpcKind {
+	EMU_IPC_GATE,
+	EMU_IPC_HEAP,
+	EMU_IPC_LIST
+} EmuIpcKind;
+
+typedef struct GateMP_Object {
+	pthread_mutex_t lock;
+} GateMP_Object;
+
+typedef struct HeapMemMP_Object {
+	GateMP_Handle gate;
+	uint8_t *base;
+	uint32_t size;
+	uint32_t used;
+} HeapMemMP_Object;
+
+typedef struct ListMP_Object {
+	GateMP_Handle gate;
+	ListMP_Elem *head;          /* in SharedRegion 0 */
+} ListMP_Object;
+
+typedef struct EmuNamed {
+	EmuIpcKind kind;
+	char name[32];
+	void *obj;
+} EmuNamed;
+
+static uint8_t emuSr0[EMU_SR0_SIZE] __attribute__((aligned(EMU_SR0_ALIGN)));
+static uint32_t emuSr0Used;
+static EmuNamed emuNamed[EMU_MAX_NAMED];
+static int emuNumNamed;
+static pthread_mutex_t emuIpcLock = PTHREAD_MUTEX_INITIALIZER;
+static GateMP_Object emuDefaultGate = { PTHREAD_MUTEX_INITIALIZER };
+
+/*
+ *  ======== sr0Alloc ========
+ *  size bytes of SharedRegion 0, EMU_SR0_ALIGN aligned; NULL when it is
+ *  used up.
+ */
+static void *sr0Alloc(uint32_t size)
+{
+	void *p = NULL;
+
+	size = (size + EMU_SR0_ALIGN - 1) & ~(EMU_SR0_ALIGN - 1);
+	pthread_mutex_lock(&emuIpcLock);
+	if (size <= EMU_SR0_SIZE - emuSr0Used) {
+		p = emuSr0 + emuSr0Used;
+		emuSr0Used += size;
+	}
+	pthread_mutex_unlock(&emuIpcLock);
+	return p;
+}
+
+/*
+ *  ======== publish / lookup ========
+ *  The registry of named objects.
+ */
+static void publish(EmuIpcKind kind, String name, void *obj)
+{
+	if (name == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&emuIpcLock);
+	if (emuNumNamed < EMU_MAX_NAMED) {
+		emuNamed[emuNumNamed].kind = kind;
+		strncpy(emuNamed[emuNumNamed].name, name,
+				sizeof(emuNamed[emuNumNamed].name) - 1);
+		emuNamed[emuNumNamed].obj = obj;
+		emuNumNamed++;
+	}
+	pthread_mutex_unlock(&emuIpcLock);
+}
+
+static void *lookup(EmuIpcKind kind, String name)
+{
+	void *obj = NULL;
+	int i;
+
+	pthread_mutex_lock(&emuIpcLock);
+	for (i = 0; i < emuNumNamed; i++) {
+		if (emuNamed[i].kind == kind && strcmp(emuNamed[i].name, name) == 0) {
+			obj = emuNamed[i].obj;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&emuIpcLock);
+	return obj;
+}
+
+/*
+ *  ======== GateMP_Params_init ========
+ */
+Void GateMP_Params_init(GateMP_Params *params)
+{
+	memset(params, 0, sizeof(*params));
+	params->localProtect = GateMP_LocalProtect_THREAD;
+	params->remoteProtect = GateMP_RemoteProtect_SYSTEM;
+}
+
+/*
+ *  ======== GateMP_create ========
+ */
+GateMP_Handle GateMP_create(const GateMP_Params *params)
+{
+	GateMP_Object *gate = calloc(1, sizeof(*gate));
+
+	if (gate == NULL) {
+		return NULL;
+	}
+	pthread_mutex_init(&gate->lock, NULL);
+	publish(EMU_IPC_GATE, params->name, gate);
+	return gate;
+}
+
+/*
+ *  ======== GateMP_open ========
+ */
+Int GateMP_open(String name, GateMP_Handle *handlePtr)
+{
+	*handlePtr = lookup(EMU_IPC_GATE, name);
+	return (*handlePtr != NULL) ? GateMP_S_SUCCESS : GateMP_E_NOTFOUND;
+}
+
+/*
+ *  ======== GateMP_enter / GateMP_leave ========
+ */
+IArg GateMP_enter(GateMP_Handle handle)
+{
+	pthread_mutex_lock(&handle->lock);
+	return 0;
+}
+
+Void GateMP_leave(GateMP_Handle handle, IArg key)
+{
+	(void)key;
+	pthread_mutex_unlock(&handle->lock);
+}
+
+/*
+ *  ======== HeapMemMP_Params_init ========
+ */
+Void HeapMemMP_Params_init(HeapMemMP_Params *params)
+{
+	memset(params, 0, sizeof(*params));
+}
+
+/*
+ *  ======== HeapMemMP_create ========
+ *  Takes sharedBufSize bytes of SharedRegion 0 for the heap.
+ */
+HeapMemMP_Handle HeapMemMP_create(const HeapMemMP_Params *params)
+{
+	HeapMemMP_Object *heap;
+	void *base;
+
+	if (params->sharedBufSize == 0
+			|| (base = sr0Alloc(params->sharedBufSize)) == NULL) {
+		return NULL;
+	}
+	heap = calloc(1, sizeof(*heap));
+	if (heap == NULL) {
+		return NULL;
+	}
+	heap->gate = (params->gate != NULL) ? params->gate : &emuDefaultGate;
+	heap->base = base;
+	heap->size = params->sharedBufSize;
+	publish(EMU_IPC_HEAP, params->name, heap);
+	return heap;
+}
+
+/*
+ *  ======== HeapMemMP_open ========
+ */
+Int HeapMemMP_open(String name, HeapMemMP_Handle *handlePtr)
+{
+	*handlePtr = lookup(EMU_IPC_HEAP, name);
+	return (*handlePtr != NULL) ? HeapMemMP_S_SUCCESS : HeapMemMP_E_NOTFOUND;
+}
+
+/*
+ *  ======== HeapMemMP_alloc ========
+ */
+Ptr HeapMemMP_alloc(HeapMemMP_Handle handle, SizeT size, SizeT align)
+{
+	uint32_t offset;
+	Ptr block = NULL;
+	IArg key;
+
+	if (align < sizeof(uint64_t)) {
+		align = sizeof(uint64_t);
+	}
+
+	key = GateMP_enter(handle->gate);
+	offset = (handle->used + align - 1) & ~(align - 1);
+	if (offset <= handle->size && size <= handle->size - offset) {
+		block = handle->base + offset;
+		handle->used = offset + size;
+	}
+	GateMP_leave(handle->gate, key);
+	return block;
+}
+
+/*
+ *  ======== HeapMemMP_free ========
+ */
+Void HeapMemMP_free(HeapMemMP_Handle handle, Ptr block, SizeT size)
+{
+	(void)handle;
+	(void)block;
+	(void)size;
+}
+
+/*
+ *  ======== ListMP_Params_init ========
+ */
+Void ListMP_Params_init(ListMP_Params *params)
+{
+	memset(params, 0, sizeof(*params));
+}
+
+/*
+ *  ======== ListMP_create ========
+ *  The list head, an element pointing at itself, is in SharedRegion 0.
+ */
+ListMP_Handle ListMP_create(const ListMP_Params *params)
+{
+	ListMP_Object *list;
+	ListMP_Elem *head = sr0Alloc(sizeof(*head));
+
+	if (head == NULL) {
+		return NULL;
+	}
+	list = calloc(1, sizeof(*list));
+	if (list == NULL) {
+		return NULL;
+	}
+	head->next = SharedRegion_getSRPtr(head, 0);
+	head->prev = SharedRegion_getSRPtr(head, 0);
+	list->gate = (params->gate != NULL) ? params->gate : &emuDefaultGate;
+	list->head = head;
+	publish(EMU_IPC_LIST, params->name, list);
+	return list;
+}
+
+/*
+ *  ======== ListMP_open ========
+ */
+Int ListMP_open(String name, ListMP_Handle *handlePtr)
+{
+	*handlePtr = lookup(EMU_IPC_LIST, name);
+	return (*handlePtr != NULL) ? ListMP_S_SUCCESS : ListMP_E_NOTFOUND;
+}
+
+/*
+ *  ======== ListMP_empty ========
+ */
+Bool ListMP_empty(ListMP_Handle handle)
+{
+	Bool empty;
+	IArg key;
+
+	key = GateMP_enter(handle->gate);
+	empty = (SharedRegion_getPtr(handle->head->next) == handle->head);
+	GateMP_leave(handle->gate, key);
+	return empty;
+}
+
+/*
+ *  ======== ListMP_getHead ========
+ */
+Ptr ListMP_getHead(ListMP_Handle handle)
+{
+	ListMP_Elem *head = handle->head, *elem, *next;
+	IArg key;
+
+	key = GateMP_enter(handle->gate);
+	elem = SharedRegion_getPtr(head->next);
+	if (elem == head) {
+		elem = NULL;
+	} else {
+		next = SharedRegion_getPtr(elem->next);
+		head->next = elem->next;
+		next->prev = SharedRegion_getSRPtr(head, 0);
+	}
+	GateMP_leave(handle->gate, key);
+	return elem;
+}
+
+/*
+ *  ======== ListMP_putTail ========
+ */
+Int ListMP_putTail(ListMP_Handle handle, ListMP_Elem *elem)
+{
+	ListMP_Elem *head = handle->head, *prev;
+	IArg key;
+
+	key = GateMP_enter(handle->gate);
+	prev = SharedRegion_getPtr(head->prev);
+	elem->next = SharedRegion_getSRPtr(head, 0);
+	elem->prev = head->prev;
+	prev->next = SharedRegion_getSRPtr(elem, 0);
+	head->prev = SharedRegion_getSRPtr(elem, 0);
+	GateMP_leave(handle->gate, key);
+	return ListMP_S_SUCCESS;
+}
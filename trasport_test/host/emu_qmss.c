@@ -0,0 +1,489 @@
+/*
+ *  ======== emu_qmss.c ========
+ *  Host emulation of the QMSS queue manager: memory regions and queues.
+ *
+ *  Every queue is a bounded multi-producer/multi-consumer lock-free FIFO
+ *  (a ring of cells tagged with sequence numbers), so the emulated cores
+ *  push and pop concurrently without a lock, like on the hardware queue
+ *  manager. A queue is created on first use with room for every
+ *  descriptor declared in Qmss_init; a descriptor can only sit in one
+ *  queue at a time, so it never fills up.
+ */
+
+#include <stdlib.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include <ti/drv/qmss/qmss_drv.h>
+
+#include "emu.h"
+
+#define EMU_CACHE_LINE  64
+
+typedef struct EmuCell {
+	size_t seq;
+	void *desc;
+} EmuCell;
+
+typedef struct EmuQueue {
+	size_t mask;
+	EmuCell *cells;
+	char pad0[EMU_CACHE_LINE];
+	size_t enq;                     /* next push position */
+	char pad1[EMU_CACHE_LINE];
+	size_t deq;                     /* next pop position */
+	char pad2[EMU_CACHE_LINE];
+	uint32_t count;                 /* entries, for Qmss_getQueueEntryCount */
+	uint32_t opened;
+	uint64_t pushes;
+	uint64_t pops;
+} EmuQueue;
+
+typedef struct EmuRegion {
+	uint8_t *base;
+	uint32_t descSize;
+	uint32_t descNum;
+} EmuRegion;
+
+static EmuQueue *emuQueues[QMSS_MAX_QUEUES];
+static EmuRegion emuRegions[QMSS_MAX_MEM_REGIONS];
+static pthread_mutex_t emuRegionLock = PTHREAD_MUTEX_INITIALIZER;
+
+Qmss_GlobalConfigParams qmssGblCfgParams;
+
+static uint32_t emuInitialized;
+static uint32_t emuMaxDesc;
+static uint32_t emuTotalDesc;
+static uint32_t emuNextQueue = EMU_GP_QUEUE_BASE;
+
+/*
+ *  ======== emu_hostAddr ========
+ */
+void *emu_hostAddr(uintptr_t addr)
+{
+	if ((addr >> 28) == 0x1) {
+		addr &= 0x00ffffff;
+	}
+	return (void *)addr;
+}
+
+/*
+ *  ======== emu_descSize ========
+ */
+uint32_t emu_descSize(void *desc)
+{
+	uint8_t *p = (uint8_t *)desc;
+	EmuRegion *r;
+	int i;
+
+	for (i = 0; i < QMSS_MAX_MEM_REGIONS; i++) {
+		r = &emuRegions[i];
+		if (r->base != NULL && p >= r->base
+				&& p < r->base + r->descSize * r->descNum) {
+			return r->descSize;
+		}
+	}
+	return 0;
+}
+
+/*
+ *  ======== queueGet ========
+ *  Returns queue q, creating it on first use. Concurrent creators race
+ *  with a compare-and-swap, the loser frees its copy.
+ */
+static EmuQueue *queueGet(Qmss_QueueHnd q)
+{
+	EmuQueue *eq;
+	EmuQueue *expected = NULL;
+	size_t depth = 16;
+	size_t i;
+
+	if (q < 0 || q >= QMSS_MAX_QUEUES) {
+		fprintf(stderr, "emu: invalid queue handle %d\n", (int)q);
+		abort();
+	}
+
+	eq = __atomic_load_n(&emuQueues[q], __ATOMIC_ACQUIRE);
+	if (eq != NULL) {
+		return eq;
+	}
+
+	while (depth < emuMaxDesc) {
+		depth <<= 1;
+	}
+
+	eq = calloc(1, sizeof(EmuQueue));
+	if (eq != NULL) {
+		eq->cells = calloc(depth, sizeof(EmuCell));
+	}
+	if (eq == NULL || eq->cells == NULL) {
+		fprintf(stderr, "emu: out of memory for queue %d\n", (int)q);
+		abort();
+	}
+	eq->mask = depth - 1;
+	for (i = 0; i < depth; i++) {
+		eq->cells[i].seq = i;
+	}
+
+	if (!__atomic_compare_exchange_n(&emuQueues[q], &expected, eq, 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		free(eq->cells);
+		free(eq);
+		eq = expected;
+	}
+	return eq;
+}
+
+/*
+ *  ======== queuePush ========
+ */
+static void queuePush(Qmss_QueueHnd q, void *desc)
+{
+	EmuQueue *eq = queueGet(q);
+	EmuCell *cell;
+	size_t pos;
+	intptr_t diff;
+
+	desc = emu_hostAddr((uintptr_t)desc);
+
+	pos = __atomic_load_n(&eq->enq, __ATOMIC_RELAXED);
+	for (;;) {
+		cell = &eq->cells[pos & eq->mask];
+		diff = (intptr_t)__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE)
+				- (intptr_t)pos;
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&eq->enq, &pos, pos + 1, 1,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		} else if (diff < 0) {
+			fprintf(stderr, "emu: queue %d overflow, descriptor %p pushed "
+					"twice?\n", (int)q, desc);
+			abort();
+		} else {
+			pos = __atomic_load_n(&eq->enq, __ATOMIC_RELAXED);
+		}
+	}
+
+	cell->desc = desc;
+	__atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+	__atomic_add_fetch(&eq->count, 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&eq->pushes, 1, __ATOMIC_RELAXED);
+}
+
+/*
+ *  ======== queuePop ========
+ */
+static void *queuePop(Qmss_QueueHnd q)
+{
+	EmuQueue *eq = queueGet(q);
+	EmuCell *cell;
+	size_t pos;
+	intptr_t diff;
+	void *desc;
+
+	pos = __atomic_load_n(&eq->deq, __ATOMIC_RELAXED);
+	for (;;) {
+		cell = &eq->cells[pos & eq->mask];
+		diff = (intptr_t)__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE)
+				- (intptr_t)(pos + 1);
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&eq->deq, &pos, pos + 1, 1,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return NULL;
+		} else {
+			pos = __atomic_load_n(&eq->deq, __ATOMIC_RELAXED);
+		}
+	}
+
+	desc = cell->desc;
+	__atomic_store_n(&cell->seq, pos + eq->mask + 1, __ATOMIC_RELEASE);
+	__atomic_sub_fetch(&eq->count, 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&eq->pops, 1, __ATOMIC_RELAXED);
+	return desc;
+}
+
+/*
+ *  ======== Qmss_init ========
+ */
+Qmss_Result Qmss_init(Qmss_InitCfg *initCfg,
+		Qmss_GlobalConfigParams *qmssGblCfgParams)
+{
+	(void)qmssGblCfgParams;
+
+	if (initCfg == NULL || initCfg->maxDescNum == 0) {
+		return QMSS_INVALID_PARAM;
+	}
+
+	emuMaxDesc = initCfg->maxDescNum;
+	__atomic_store_n(&emuInitialized, 1, __ATOMIC_RELEASE);
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== Qmss_start ========
+ *  The other cores may call this before core 0 is done with Qmss_init,
+ *  wait for it instead of failing.
+ */
+Qmss_Result Qmss_start(void)
+{
+	while (!__atomic_load_n(&emuInitialized, __ATOMIC_ACQUIRE)) {
+		sched_yield();
+	}
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== Qmss_exit ========
+ */
+Qmss_Result Qmss_exit(void)
+{
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== Qmss_insertMemoryRegion ========
+ *  Like the hardware, takes regions of a power of two descriptors, at
+ *  least 32, of a multiple of 16 bytes.
+ */
+Qmss_Result Qmss_insertMemoryRegion(Qmss_MemRegInfo *memRegCfg)
+{
+	uint8_t *base;
+	int i, region;
+	Qmss_Result ret;
+
+	if (!emuInitialized) {
+		return QMSS_NOT_INITIALIZED;
+	}
+	if (memRegCfg == NULL || memRegCfg->descNum < 32
+			|| (memRegCfg->descNum & (memRegCfg->descNum - 1))
+			|| memRegCfg->descSize < 16 || (memRegCfg->descSize & 0xf)) {
+		return QMSS_MEMREGION_INVALID_PARAM;
+	}
+
+	base = emu_hostAddr((uintptr_t)memRegCfg->descBase);
+	if ((uintptr_t)base & 0xf) {
+		return QMSS_MEMREGION_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&emuRegionLock);
+
+	region = memRegCfg->memRegion;
+	if (region == Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED) {
+		for (region = 0; region < QMSS_MAX_MEM_REGIONS; region++) {
+			if (emuRegions[region].base == NULL) {
+				break;
+			}
+		}
+	}
+
+	if (region < 0 || region >= QMSS_MAX_MEM_REGIONS
+			|| emuRegions[region].base != NULL) {
+		ret = QMSS_MEMREGION_INVALID_PARAM;
+	} else if (emuTotalDesc + memRegCfg->descNum > emuMaxDesc) {
+		ret = QMSS_MEMREGION_INVALID_PARAM;
+	} else {
+		ret = region;
+		for (i = 0; i < QMSS_MAX_MEM_REGIONS; i++) {
+			EmuRegion *r = &emuRegions[i];
+
+			if (r->base != NULL
+					&& base < r->base + r->descSize * r->descNum
+					&& r->base < base
+							+ memRegCfg->descSize * memRegCfg->descNum) {
+				ret = QMSS_MEMREGION_OVERLAP;
+			}
+		}
+		if (ret >= 0) {
+			emuRegions[region].base = base;
+			emuRegions[region].descSize = memRegCfg->descSize;
+			emuRegions[region].descNum = memRegCfg->descNum;
+			emuTotalDesc += memRegCfg->descNum;
+		}
+	}
+
+	pthread_mutex_unlock(&emuRegionLock);
+	return ret;
+}
+
+/*
+ *  ======== emu_regionDesc ========
+ */
+void *emu_regionDesc(int region, uint32_t index, uint32_t *descSize)
+{
+	EmuRegion *r;
+
+	if (region < 0 || region >= QMSS_MAX_MEM_REGIONS) {
+		return NULL;
+	}
+	r = &emuRegions[region];
+	if (r->base == NULL || index >= r->descNum) {
+		return NULL;
+	}
+	*descSize = r->descSize;
+	return r->base + index * r->descSize;
+}
+
+/*
+ *  ======== emu_queueAlloc ========
+ */
+int emu_queueAlloc(void)
+{
+	uint32_t q;
+
+	do {
+		q = __atomic_fetch_add(&emuNextQueue, 1, __ATOMIC_RELAXED);
+		if (q >= QMSS_MAX_QUEUES) {
+			return QMSS_RESOURCE_ALLOCATE_USE_DENIED;
+		}
+	} while (emuQueues[q] != NULL && emuQueues[q]->opened);
+
+	return (int)q;
+}
+
+/*
+ *  ======== Qmss_queueOpen ========
+ *  Opening a queue again returns the same handle and bumps isAllocated,
+ *  like the LLD does across cores.
+ */
+Qmss_QueueHnd Qmss_queueOpen(Qmss_QueueType queType, int queNum,
+		uint8_t *isAllocated)
+{
+	EmuQueue *eq;
+	uint32_t opened;
+
+	(void)queType;
+
+	if (!emuInitialized) {
+		return QMSS_NOT_INITIALIZED;
+	}
+	if (queNum == QMSS_PARAM_NOT_SPECIFIED) {
+		queNum = emu_queueAlloc();
+	}
+	if (queNum < 0 || queNum >= QMSS_MAX_QUEUES) {
+		return QMSS_INVALID_PARAM;
+	}
+
+	eq = queueGet(queNum);
+	opened = __atomic_add_fetch(&eq->opened, 1, __ATOMIC_RELAXED);
+	if (isAllocated != NULL) {
+		*isAllocated = (uint8_t)opened;
+	}
+	return queNum;
+}
+
+/*
+ *  ======== Qmss_queueClose ========
+ */
+Qmss_Result Qmss_queueClose(Qmss_QueueHnd hnd)
+{
+	EmuQueue *eq = queueGet(hnd);
+
+	if (eq->opened > 0) {
+		__atomic_sub_fetch(&eq->opened, 1, __ATOMIC_RELAXED);
+	}
+	return QMSS_SOK;
+}
+
+/*
+ *  ======== Qmss_getQueueNumber ========
+ */
+Qmss_Queue Qmss_getQueueNumber(Qmss_QueueHnd hnd)
+{
+	Qmss_Queue queue;
+
+	queue.qMgr = (uint16_t)(hnd >> 12);
+	queue.qNum = (uint16_t)(hnd & 0xfff);
+	return queue;
+}
+
+/*
+ *  ======== Qmss_getQueueHandle ========
+ */
+Qmss_QueueHnd Qmss_getQueueHandle(Qmss_Queue queue)
+{
+	return ((Qmss_QueueHnd)queue.qMgr << 12) | queue.qNum;
+}
+
+/*
+ *  ======== Qmss_getQueueEntryCount ========
+ */
+uint32_t Qmss_getQueueEntryCount(Qmss_QueueHnd hnd)
+{
+	return __atomic_load_n(&queueGet(hnd)->count, __ATOMIC_RELAXED);
+}
+
+/*
+ *  ======== sizeCheck ========
+ *  The LLD ORs (descSize >> 4) - 1 into the pushed address, so only 16 to
+ *  256 bytes in steps of 16 keep it off the address bits.
+ */
+static void sizeCheck(Qmss_QueueHnd q, void *desc, uint32_t descSize)
+{
+	if (descSize < 16 || descSize > 256 || (descSize & 0xf) != 0) {
+		fprintf(stderr, "emu: queue %d: descriptor %p pushed with size "
+				"hint %u, not a multiple of 16 in 16..256\n", (int)q, desc,
+				descSize);
+		abort();
+	}
+}
+
+/*
+ *  ======== Qmss_queuePush ========
+ */
+void Qmss_queuePush(Qmss_QueueHnd hnd, void *descAddr, uint32_t packetSize,
+		uint32_t descSize, Qmss_Location location)
+{
+	(void)packetSize;
+	(void)location;
+	sizeCheck(hnd, descAddr, descSize);
+	queuePush(hnd, descAddr);
+}
+
+/*
+ *  ======== Qmss_queuePushDesc ========
+ */
+void Qmss_queuePushDesc(Qmss_QueueHnd hnd, void *descAddr)
+{
+	queuePush(hnd, descAddr);
+}
+
+/*
+ *  ======== Qmss_queuePushDescSize ========
+ */
+void Qmss_queuePushDescSize(Qmss_QueueHnd hnd, void *descAddr,
+		uint32_t descSize)
+{
+	sizeCheck(hnd, descAddr, descSize);
+	queuePush(hnd, descAddr);
+}
+
+/*
+ *  ======== Qmss_queuePop ========
+ */
+void *Qmss_queuePop(Qmss_QueueHnd hnd)
+{
+	return queuePop(hnd);
+}
+
+/*
+ *  ======== emu_qmssReport ========
+ */
+void emu_qmssReport(FILE *fp)
+{
+	int q;
+	EmuQueue *eq;
+
+	for (q = 0; q < QMSS_MAX_QUEUES; q++) {
+		eq = emuQueues[q];
+		if (eq == NULL || (eq->pushes == 0 && eq->pops == 0)) {
+			continue;
+		}
+		fprintf(fp, "emu: queue %4d: %10llu pushes %10llu pops %6u left\n",
+				q, (unsigned long long)eq->pushes,
+				(unsigned long long)eq->pops, eq->count);
+	}
+}
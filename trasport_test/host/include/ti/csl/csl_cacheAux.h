@@ -0,0 +1,30 @@
+/*
+ *  ======== ti/csl/csl_cacheAux.h ========
+ *  Host emulation: the host caches are coherent, so cache maintenance
+ *  only has to order the memory accesses around it.
+ */
+
+#ifndef TI_CSL_CSL_CACHEAUX_H_
+#define TI_CSL_CSL_CACHEAUX_H_
+
+#include <xdc/std.h>
+
+typedef enum {
+    CACHE_NOWAIT = 0,
+    CACHE_WAIT,
+    CACHE_FENCE_WAIT
+} CACHE_Wait;
+
+static inline void emu_cacheFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#define CACHE_wbL1d(addr, size, wait)       emu_cacheFence()
+#define CACHE_invL1d(addr, size, wait)      emu_cacheFence()
+#define CACHE_wbInvL1d(addr, size, wait)    emu_cacheFence()
+#define CACHE_wbL2(addr, size, wait)        emu_cacheFence()
+#define CACHE_invL2(addr, size, wait)       emu_cacheFence()
+#define CACHE_wbInvL2(addr, size, wait)     emu_cacheFence()
+
+#endif /* TI_CSL_CSL_CACHEAUX_H_ */
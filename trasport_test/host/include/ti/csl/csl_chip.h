@@ -0,0 +1,20 @@
+/*
+ *  ======== ti/csl/csl_chip.h ========
+ *  Host emulation: DNUM is the number of the emulated core running the
+ *  calling thread.
+ */
+
+#ifndef TI_CSL_CSL_CHIP_H_
+#define TI_CSL_CSL_CHIP_H_
+
+#include <xdc/std.h>
+
+typedef enum {
+    CSL_CHIP_DNUM = 11
+} CSL_ChipReg;
+
+Uint32 emu_coreNum(void);
+
+#define CSL_chipReadReg(reg)    ((reg) == CSL_CHIP_DNUM ? emu_coreNum() : 0)
+
+#endif /* TI_CSL_CSL_CHIP_H_ */
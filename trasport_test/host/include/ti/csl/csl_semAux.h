@@ -0,0 +1,18 @@
+/*
+ *  ======== ti/csl/csl_semAux.h ========
+ *  Host emulation: the Semaphore2 hardware semaphores are flags shared by
+ *  the emulated cores, see host/emu_bios.c. Direct acquisition only.
+ */
+
+#ifndef TI_CSL_CSL_SEMAUX_H_
+#define TI_CSL_CSL_SEMAUX_H_
+
+#include <xdc/std.h>
+
+#define EMU_NUM_HW_SEM      64
+
+/* 1 if semNum was free and is now the caller's, 0 if another core has it */
+Uint8 CSL_semAcquireDirect(Uint8 semNum);
+void CSL_semReleaseSemaphore(Uint8 semNum);
+
+#endif /* TI_CSL_CSL_SEMAUX_H_ */
@@ -0,0 +1,236 @@
+/*
+ *  ======== ti/drv/cppi/cppi_desc.h ========
+ *  Host emulation of the CPPI LLD descriptor layouts and accessors used by
+ *  trasport_test. The descriptors are laid out word for word like the
+ *  hardware ones; buffer pointers are stored as 32-bit addresses, see
+ *  qmss_drv.h.
+ */
+
+#ifndef TI_DRV_CPPI_CPPI_DESC_H_
+#define TI_DRV_CPPI_CPPI_DESC_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+
+typedef enum {
+    Cppi_DescType_HOST = 0,
+    Cppi_DescType_MONOLITHIC = 2
+} Cppi_DescType;
+
+typedef struct Cppi_Desc Cppi_Desc;
+
+typedef struct {
+    uint8_t     destTagLo;
+    uint8_t     destTagHi;
+    uint8_t     srcTagLo;
+    uint8_t     srcTagHi;
+} Cppi_DescTag;
+
+typedef struct {
+    uint32_t    descInfo;       /* type 31:30, data offset 24:16, length 15:0 */
+    uint32_t    tagInfo;        /* src hi, src lo, dest hi, dest lo */
+    uint32_t    packetInfo;     /* EPIB 31, return qmgr 13:12, qnum 11:0 */
+} Cppi_MonolithicDesc;
+
+typedef struct {
+    uint32_t    descInfo;       /* type 31:30, packet length 21:0 */
+    uint32_t    tagInfo;
+    uint32_t    packetInfo;     /* EPIB 31, return policy 15, queue 13:0 */
+    uint32_t    buffLen;        /* 21:0 */
+    uint32_t    buffPtr;
+    uint32_t    nextBDPtr;
+    uint32_t    origBufferLen;  /* 21:0 */
+    uint32_t    origBuffPtr;
+} Cppi_HostDesc;
+
+#define CPPI_DESC_TYPE_SHIFT        30
+#define CPPI_MONO_OFFSET_SHIFT      16
+#define CPPI_MONO_OFFSET_MASK       0x1ff
+#define CPPI_MONO_LEN_MASK          0xffff
+#define CPPI_HOST_LEN_MASK          0x3fffff
+#define CPPI_RETURN_QUEUE_MASK      0x3fff
+#define CPPI_RETURN_POLICY_SHIFT    15
+
+#define CPPI_ADDR(p)    ((uint32_t)(uintptr_t)(p))
+#define CPPI_PTR(a)     ((uint8_t *)(uintptr_t)(a))
+
+static inline Cppi_DescType Cppi_getDescType(Cppi_Desc *descAddr)
+{
+    return (Cppi_DescType)(((uint32_t *)descAddr)[0] >> CPPI_DESC_TYPE_SHIFT);
+}
+
+static inline uint32_t Cppi_getDataOffset(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    Cppi_MonolithicDesc *m = (Cppi_MonolithicDesc *)descAddr;
+
+    (void)descType;
+    return (m->descInfo >> CPPI_MONO_OFFSET_SHIFT) & CPPI_MONO_OFFSET_MASK;
+}
+
+static inline void Cppi_setDataOffset(Cppi_DescType descType,
+        Cppi_Desc *descAddr, uint32_t dataOffset)
+{
+    Cppi_MonolithicDesc *m = (Cppi_MonolithicDesc *)descAddr;
+
+    (void)descType;
+    m->descInfo = (m->descInfo
+            & ~(CPPI_MONO_OFFSET_MASK << CPPI_MONO_OFFSET_SHIFT))
+            | ((dataOffset & CPPI_MONO_OFFSET_MASK) << CPPI_MONO_OFFSET_SHIFT);
+}
+
+static inline void Cppi_setPacketLen(Cppi_DescType descType,
+        Cppi_Desc *descAddr, uint32_t packetLen)
+{
+    uint32_t *w = (uint32_t *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC)
+        w[0] = (w[0] & ~CPPI_MONO_LEN_MASK) | (packetLen & CPPI_MONO_LEN_MASK);
+    else
+        w[0] = (w[0] & ~CPPI_HOST_LEN_MASK) | (packetLen & CPPI_HOST_LEN_MASK);
+}
+
+static inline uint32_t Cppi_getPacketLen(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    uint32_t *w = (uint32_t *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC)
+        return w[0] & CPPI_MONO_LEN_MASK;
+    return w[0] & CPPI_HOST_LEN_MASK;
+}
+
+/* Monolithic: copies the buffer in at the data offset, the length is set
+ * separately with Cppi_setPacketLen. Host: attaches the buffer. */
+static inline void Cppi_setData(Cppi_DescType descType, Cppi_Desc *descAddr,
+        uint8_t *buffAddr, uint32_t buffLen)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC) {
+        memcpy((uint8_t *)descAddr + Cppi_getDataOffset(descType, descAddr),
+                buffAddr, buffLen);
+    } else {
+        h->buffPtr = CPPI_ADDR(buffAddr);
+        h->buffLen = (h->buffLen & ~CPPI_HOST_LEN_MASK)
+                | (buffLen & CPPI_HOST_LEN_MASK);
+    }
+}
+
+static inline void Cppi_getData(Cppi_DescType descType, Cppi_Desc *descAddr,
+        uint8_t **buffAddr, uint32_t *buffLen)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC) {
+        *buffAddr = (uint8_t *)descAddr
+                + Cppi_getDataOffset(descType, descAddr);
+        *buffLen = Cppi_getPacketLen(descType, descAddr);
+    } else {
+        *buffAddr = CPPI_PTR(h->buffPtr);
+        *buffLen = h->buffLen & CPPI_HOST_LEN_MASK;
+    }
+}
+
+static inline void Cppi_setDataLen(Cppi_DescType descType,
+        Cppi_Desc *descAddr, uint32_t dataLen)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC)
+        Cppi_setPacketLen(descType, descAddr, dataLen);
+    else
+        h->buffLen = (h->buffLen & ~CPPI_HOST_LEN_MASK)
+                | (dataLen & CPPI_HOST_LEN_MASK);
+}
+
+static inline uint32_t Cppi_getDataLen(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    if (descType == Cppi_DescType_MONOLITHIC)
+        return Cppi_getPacketLen(descType, descAddr);
+    return h->buffLen & CPPI_HOST_LEN_MASK;
+}
+
+static inline void Cppi_setOriginalBufInfo(Cppi_DescType descType,
+        Cppi_Desc *descAddr, uint8_t *buffAddr, uint32_t buffLen)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    (void)descType;
+    h->origBuffPtr = CPPI_ADDR(buffAddr);
+    h->origBufferLen = buffLen & CPPI_HOST_LEN_MASK;
+}
+
+static inline void Cppi_getOriginalBufInfo(Cppi_DescType descType,
+        Cppi_Desc *descAddr, uint8_t **buffAddr, uint32_t *buffLen)
+{
+    Cppi_HostDesc *h = (Cppi_HostDesc *)descAddr;
+
+    (void)descType;
+    *buffAddr = CPPI_PTR(h->origBuffPtr);
+    *buffLen = h->origBufferLen & CPPI_HOST_LEN_MASK;
+}
+
+static inline void Cppi_linkNextBD(Cppi_DescType descType,
+        Cppi_Desc *descAddr, Cppi_Desc *nextBD)
+{
+    (void)descType;
+    ((Cppi_HostDesc *)descAddr)->nextBDPtr = CPPI_ADDR(nextBD);
+}
+
+static inline Cppi_Desc *Cppi_getNextBD(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    (void)descType;
+    return (Cppi_Desc *)CPPI_PTR(((Cppi_HostDesc *)descAddr)->nextBDPtr);
+}
+
+static inline void Cppi_setTag(Cppi_DescType descType, Cppi_Desc *descAddr,
+        Cppi_DescTag *tag)
+{
+    (void)descType;
+    ((uint32_t *)descAddr)[1] = ((uint32_t)tag->srcTagHi << 24)
+            | ((uint32_t)tag->srcTagLo << 16)
+            | ((uint32_t)tag->destTagHi << 8) | tag->destTagLo;
+}
+
+static inline Cppi_DescTag Cppi_getTag(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    uint32_t w = ((uint32_t *)descAddr)[1];
+    Cppi_DescTag tag;
+
+    (void)descType;
+    tag.srcTagHi = (uint8_t)(w >> 24);
+    tag.srcTagLo = (uint8_t)(w >> 16);
+    tag.destTagHi = (uint8_t)(w >> 8);
+    tag.destTagLo = (uint8_t)w;
+    return tag;
+}
+
+static inline void Cppi_setReturnQueue(Cppi_DescType descType,
+        Cppi_Desc *descAddr, Qmss_Queue queue)
+{
+    uint32_t *w = (uint32_t *)descAddr;
+
+    (void)descType;
+    w[2] = (w[2] & ~CPPI_RETURN_QUEUE_MASK)
+            | (((uint32_t)queue.qMgr & 0x3) << 12) | (queue.qNum & 0xfff);
+}
+
+static inline Qmss_Queue Cppi_getReturnQueue(Cppi_DescType descType,
+        Cppi_Desc *descAddr)
+{
+    uint32_t w = ((uint32_t *)descAddr)[2];
+    Qmss_Queue queue;
+
+    (void)descType;
+    queue.qMgr = (uint16_t)((w >> 12) & 0x3);
+    queue.qNum = (uint16_t)(w & 0xfff);
+    return queue;
+}
+
+#endif /* TI_DRV_CPPI_CPPI_DESC_H_ */
@@ -0,0 +1,189 @@
+/*
+ *  ======== ti/drv/cppi/cppi_drv.h ========
+ *  Host emulation of the subset of the CPPI LLD used by trasport_test,
+ *  implemented in host/emu_cppi.c.
+ *
+ *  Only the QMSS infrastructure PKTDMA is emulated. A descriptor pushed
+ *  to Tx queue QMSS_INFRASTRUCTURE_QUEUE_BASE + channel of an enabled Tx
+ *  channel is moved by a DMA thread: the Rx flow named by its source tag
+ *  low byte takes a free descriptor, receives a copy of the payload and
+ *  is pushed to the flow's destination queue, then the Tx descriptor goes
+ *  back to its return queue.
+ */
+
+#ifndef TI_DRV_CPPI_CPPI_DRV_H_
+#define TI_DRV_CPPI_CPPI_DRV_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_desc.h>
+
+typedef int32_t Cppi_Result;
+typedef void *Cppi_Handle;
+typedef void *Cppi_ChHnd;
+typedef void *Cppi_FlowHnd;
+
+#define CPPI_SOK                    0
+#define CPPI_INVALID_PARAM          -4
+#define CPPI_CPDMA_NOT_INITIALIZED  -5
+#define CPPI_PARAM_NOT_SPECIFIED    -1
+
+#define CPPI_MAX_TX_CH              32
+#define CPPI_MAX_RX_CH              32
+#define CPPI_MAX_RX_FLOW            64
+
+typedef enum {
+    Cppi_CpDma_SRIO_CPDMA = 0,
+    Cppi_CpDma_AIF_CPDMA,
+    Cppi_CpDma_FFTC_A_CPDMA,
+    Cppi_CpDma_FFTC_B_CPDMA,
+    Cppi_CpDma_PASS_CPDMA,
+    Cppi_CpDma_QMSS_CPDMA,
+    Cppi_CpDma_FFTC_C_CPDMA,
+    Cppi_CpDma_BCP_CPDMA
+} Cppi_CpDma;
+
+typedef enum {
+    Cppi_ChState_CHANNEL_DISABLE = 0,
+    Cppi_ChState_CHANNEL_ENABLE
+} Cppi_ChState;
+
+typedef enum {
+    Cppi_InitDesc_INIT_DESCRIPTOR = 0,
+    Cppi_InitDesc_BYPASS_INIT
+} Cppi_InitDesc;
+
+typedef enum {
+    Cppi_ReturnPolicy_RETURN_ENTIRE_PACKET = 0,
+    Cppi_ReturnPolicy_RETURN_BUFFER
+} Cppi_ReturnPolicy;
+
+typedef enum {
+    Cppi_PSLoc_PS_IN_DESC = 0,
+    Cppi_PSLoc_PS_IN_SOP
+} Cppi_PSLoc;
+
+typedef enum {
+    Cppi_EPIB_NO_EPIB_PRESENT = 0,
+    Cppi_EPIB_EPIB_PRESENT
+} Cppi_EPIB;
+
+/* device configuration, opaque to the emulation */
+typedef struct {
+    uint32_t    numCpDma;
+} Cppi_GlobalConfigParams;
+
+typedef struct {
+    Cppi_CpDma  dmaNum;
+    uint32_t    writeFifoDepth;
+    uint32_t    timeoutCount;
+} Cppi_CpDmaInitCfg;
+
+typedef struct {
+    int32_t     channelNum;
+    uint8_t     priority;
+    uint8_t     filterEPIB;
+    uint8_t     filterPS;
+    uint8_t     aifMonoMode;
+    Cppi_ChState txEnable;
+} Cppi_TxChInitCfg;
+
+typedef struct {
+    int32_t     channelNum;
+    Cppi_ChState rxEnable;
+} Cppi_RxChInitCfg;
+
+/*
+ *  Rx flow. When rx_size_thresh<n>_en is set, packets up to
+ *  rx_size_thresh<n> << 5 bytes take their first descriptor from
+ *  rx_fdq0_sz<n>; larger ones fall through to the next enabled size and
+ *  finally to rx_fdq0_sz0 when no threshold is enabled.
+ */
+typedef struct {
+    int16_t     flowIdNum;
+    uint16_t    rx_dest_qnum;
+    uint16_t    rx_dest_qmgr;
+    uint16_t    rx_sop_offset;
+    uint8_t     rx_ps_location;
+    uint8_t     rx_desc_type;
+    uint8_t     rx_error_handling;  /* 0 drop, 1 retry on starvation */
+    uint8_t     rx_psinfo_present;
+    uint8_t     rx_einfo_present;
+    uint8_t     rx_dest_tag_lo;
+    uint8_t     rx_dest_tag_hi;
+    uint8_t     rx_src_tag_lo;
+    uint8_t     rx_src_tag_hi;
+    uint8_t     rx_size_thresh0_en;
+    uint8_t     rx_size_thresh1_en;
+    uint8_t     rx_size_thresh2_en;
+    uint8_t     rx_dest_tag_lo_sel;
+    uint8_t     rx_dest_tag_hi_sel;
+    uint8_t     rx_src_tag_lo_sel;
+    uint8_t     rx_src_tag_hi_sel;
+    uint16_t    rx_fdq1_qnum;
+    uint16_t    rx_fdq1_qmgr;
+    uint16_t    rx_fdq0_sz0_qnum;
+    uint16_t    rx_fdq0_sz0_qmgr;
+    uint16_t    rx_fdq3_qnum;
+    uint16_t    rx_fdq3_qmgr;
+    uint16_t    rx_fdq2_qnum;
+    uint16_t    rx_fdq2_qmgr;
+    uint16_t    rx_size_thresh1;
+    uint16_t    rx_size_thresh0;
+    uint16_t    rx_fdq0_sz1_qnum;
+    uint16_t    rx_fdq0_sz1_qmgr;
+    uint16_t    rx_size_thresh2;
+    uint16_t    rx_fdq0_sz3_qnum;
+    uint16_t    rx_fdq0_sz3_qmgr;
+    uint16_t    rx_fdq0_sz2_qnum;
+    uint16_t    rx_fdq0_sz2_qmgr;
+} Cppi_RxFlowCfg;
+
+typedef struct {
+    Cppi_ReturnPolicy returnPolicy;
+    Cppi_PSLoc  psLocation;
+} Cppi_HostDescCfg;
+
+typedef struct {
+    uint32_t    dataOffset;
+} Cppi_MonoDescCfg;
+
+typedef struct {
+    Qmss_MemRegion memRegion;
+    uint32_t    descNum;
+    int32_t     destQueueNum;
+    Qmss_QueueType queueType;
+    Cppi_InitDesc initDesc;
+    Cppi_DescType descType;
+    Qmss_Queue  returnQueue;        /* qNum 0xffff: destQueueNum */
+    Qmss_Location returnPushPolicy;
+    Cppi_EPIB   epibPresent;
+    union {
+        Cppi_HostDescCfg host;
+        Cppi_MonoDescCfg mono;
+    } cfg;
+} Cppi_DescCfg;
+
+Cppi_Result Cppi_init(Cppi_GlobalConfigParams *cppiGblCfgParams);
+Cppi_Result Cppi_exit(void);
+Cppi_Handle Cppi_open(Cppi_CpDmaInitCfg *initCfg);
+Cppi_Result Cppi_close(Cppi_Handle hnd);
+
+Cppi_ChHnd Cppi_txChannelOpen(Cppi_Handle hnd, Cppi_TxChInitCfg *txChCfg,
+        uint8_t *isAllocated);
+Cppi_ChHnd Cppi_rxChannelOpen(Cppi_Handle hnd, Cppi_RxChInitCfg *rxChCfg,
+        uint8_t *isAllocated);
+Cppi_Result Cppi_channelEnable(Cppi_ChHnd hnd);
+Cppi_Result Cppi_channelDisable(Cppi_ChHnd hnd);
+Cppi_Result Cppi_channelClose(Cppi_ChHnd hnd);
+uint32_t Cppi_getChID(Cppi_ChHnd hnd);
+
+Cppi_FlowHnd Cppi_configureRxFlow(Cppi_Handle hnd, Cppi_RxFlowCfg *cfg,
+        uint8_t *isAllocated);
+Cppi_Result Cppi_closeRxFlow(Cppi_FlowHnd hnd);
+uint32_t Cppi_getFlowId(Cppi_FlowHnd hnd);
+
+Qmss_QueueHnd Cppi_initDescriptor(Cppi_DescCfg *descCfg,
+        uint32_t *numAllocated);
+
+#endif /* TI_DRV_CPPI_CPPI_DRV_H_ */
@@ -0,0 +1,223 @@
+/*
+ *  ======== ti/drv/qmss/qmss_drv.h ========
+ *  Host emulation of the subset of the QMSS LLD used by trasport_test.
+ *  Names, types and prototypes follow the LLD so the target sources build
+ *  unchanged; the implementation is host/emu_qmss.c.
+ *
+ *  Queues are lock-free bounded FIFOs shared by all the emulated cores.
+ *  A queue handle is the queue number, as in the LLD. Descriptors keep
+ *  their address: addresses handed to the LLD must fit in 32 bits, which
+ *  the host build guarantees by linking with -no-pie.
+ */
+
+#ifndef TI_DRV_QMSS_QMSS_DRV_H_
+#define TI_DRV_QMSS_QMSS_DRV_H_
+
+#include <xdc/std.h>
+
+typedef int32_t Qmss_Result;
+typedef int32_t Qmss_QueueHnd;
+
+#define QMSS_SOK                    0
+#define QMSS_INVALID_PARAM          -3
+#define QMSS_NOT_INITIALIZED        -4
+#define QMSS_MEMREGION_INVALID_PARAM    -12
+#define QMSS_MEMREGION_OVERLAP      -15
+#define QMSS_RESOURCE_ALLOCATE_USE_DENIED   -21
+
+#define QMSS_PARAM_NOT_SPECIFIED    -1
+#define QMSS_MAX_MEM_REGIONS        20
+#define QMSS_MAX_QUEUES             8192
+
+/* high priority queues, queue n is watched by accumulator channel n */
+#define QMSS_HIGH_PRIORITY_QUEUE_BASE   704
+
+/* first queue of the QMSS infrastructure PKTDMA Tx channels */
+#define QMSS_INFRASTRUCTURE_QUEUE_BASE  800
+#define QMSS_MAX_INFRASTRUCTURE_QUEUE   32
+
+typedef enum {
+    Qmss_QueueType_LOW_PRIORITY_QUEUE = 0,
+    Qmss_QueueType_AIF_QUEUE,
+    Qmss_QueueType_PASS_QUEUE,
+    Qmss_QueueType_INTC_QUEUE,
+    Qmss_QueueType_SRIO_QUEUE,
+    Qmss_QueueType_FFTC_A_QUEUE,
+    Qmss_QueueType_FFTC_B_QUEUE,
+    Qmss_QueueType_BCP_QUEUE,
+    Qmss_QueueType_HIGH_PRIORITY_QUEUE,
+    Qmss_QueueType_STARVATION_COUNTER_QUEUE,
+    Qmss_QueueType_INFRASTRUCTURE_QUEUE,
+    Qmss_QueueType_TRAFFIC_SHAPING_QUEUE,
+    Qmss_QueueType_GENERAL_PURPOSE_QUEUE
+} Qmss_QueueType;
+
+typedef enum {
+    Qmss_Location_HEAD = 0,
+    Qmss_Location_TAIL
+} Qmss_Location;
+
+typedef enum {
+    Qmss_ManageDesc_UNMANAGED_DESCRIPTOR = 0,
+    Qmss_ManageDesc_MANAGE_DESCRIPTOR
+} Qmss_ManageDesc;
+
+typedef enum {
+    Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED = -1,
+    Qmss_MemRegion_MEMORY_REGION0 = 0,
+    Qmss_MemRegion_MEMORY_REGION1,
+    Qmss_MemRegion_MEMORY_REGION2,
+    Qmss_MemRegion_MEMORY_REGION3,
+    Qmss_MemRegion_MEMORY_REGION4,
+    Qmss_MemRegion_MEMORY_REGION5,
+    Qmss_MemRegion_MEMORY_REGION6,
+    Qmss_MemRegion_MEMORY_REGION7,
+    Qmss_MemRegion_MEMORY_REGION8,
+    Qmss_MemRegion_MEMORY_REGION9,
+    Qmss_MemRegion_MEMORY_REGION10,
+    Qmss_MemRegion_MEMORY_REGION11,
+    Qmss_MemRegion_MEMORY_REGION12,
+    Qmss_MemRegion_MEMORY_REGION13,
+    Qmss_MemRegion_MEMORY_REGION14,
+    Qmss_MemRegion_MEMORY_REGION15,
+    Qmss_MemRegion_MEMORY_REGION16,
+    Qmss_MemRegion_MEMORY_REGION17,
+    Qmss_MemRegion_MEMORY_REGION18,
+    Qmss_MemRegion_MEMORY_REGION19
+} Qmss_MemRegion;
+
+typedef struct {
+    uint16_t    qMgr;
+    uint16_t    qNum;
+} Qmss_Queue;
+
+/* device configuration, opaque to the emulation */
+typedef struct {
+    uint32_t    maxQueMgr;
+} Qmss_GlobalConfigParams;
+
+typedef enum {
+    Qmss_PdspId_PDSP1 = 0,
+    Qmss_PdspId_PDSP2
+} Qmss_PdspId;
+
+#define QMSS_MAX_PDSP               2
+
+typedef struct {
+    Qmss_PdspId pdspId;
+    void       *firmware;
+    uint32_t    size;
+} Qmss_PdspCfg;
+
+typedef struct {
+    void       *linkingRAM0Base;
+    uint32_t    linkingRAM0Size;
+    void       *linkingRAM1Base;
+    uint32_t    maxDescNum;
+    uint32_t    qmssHwStatus;
+    Qmss_PdspCfg pdspFirmware[QMSS_MAX_PDSP];
+} Qmss_InitCfg;
+
+typedef struct {
+    uint32_t   *descBase;
+    uint32_t    descSize;
+    uint32_t    descNum;
+    Qmss_ManageDesc manageDescFlag;
+    Qmss_MemRegion memRegion;
+    uint32_t    startIndex;
+} Qmss_MemRegInfo;
+
+Qmss_Result Qmss_init(Qmss_InitCfg *initCfg,
+        Qmss_GlobalConfigParams *qmssGblCfgParams);
+Qmss_Result Qmss_start(void);
+Qmss_Result Qmss_exit(void);
+Qmss_Result Qmss_insertMemoryRegion(Qmss_MemRegInfo *memRegCfg);
+
+Qmss_QueueHnd Qmss_queueOpen(Qmss_QueueType queType, int queNum,
+        uint8_t *isAllocated);
+Qmss_Result Qmss_queueClose(Qmss_QueueHnd hnd);
+Qmss_Queue Qmss_getQueueNumber(Qmss_QueueHnd hnd);
+Qmss_QueueHnd Qmss_getQueueHandle(Qmss_Queue queue);
+uint32_t Qmss_getQueueEntryCount(Qmss_QueueHnd hnd);
+
+/* the emulated queues are FIFOs only, location is ignored */
+void Qmss_queuePush(Qmss_QueueHnd hnd, void *descAddr, uint32_t packetSize,
+        uint32_t descSize, Qmss_Location location);
+void Qmss_queuePushDesc(Qmss_QueueHnd hnd, void *descAddr);
+void Qmss_queuePushDescSize(Qmss_QueueHnd hnd, void *descAddr,
+        uint32_t descSize);
+void *Qmss_queuePop(Qmss_QueueHnd hnd);
+
+/*
+ *  Accumulator, emulated in host/emu_acc.c. A channel watches one queue
+ *  (single queue mode) and writes the descriptors it pops to a ping/pong
+ *  list of two pages of maxPageEntries words, the first word of a page
+ *  holding the entry count (Qmss_AccCountMode_ENTRY_COUNT). High priority
+ *  channel n interrupts core n % 4 on event 48 + n / 4. Pacing delays are
+ *  in 25 us accumulator timer ticks.
+ */
+#define QMSS_ACC_SOK                1
+#define QMSS_ACC_INVALID_CHANNEL    101
+#define QMSS_ACC_INVALID_COMMAND    102
+#define QMSS_ACC_CHANNEL_NOT_ACTIVE 103
+#define QMSS_ACC_CHANNEL_ALREADY_ACTIVE 104
+
+#define QMSS_MAX_ACC_CHANNEL        48
+
+typedef enum {
+    Qmss_AccCmd_DISABLE_CHANNEL = 0x80,
+    Qmss_AccCmd_ENABLE_CHANNEL,
+    Qmss_AccCmd_CONFIG_TIMER_CONSTANT,
+    Qmss_AccCmd_CONFIG_RECLAIM_QUEUE
+} Qmss_AccCmd;
+
+typedef enum {
+    Qmss_AccPacingMode_NONE = 0,
+    Qmss_AccPacingMode_LAST_INTERRUPT,
+    Qmss_AccPacingMode_FIRST_NEW_PACKET,
+    Qmss_AccPacingMode_LAST_NEW_PACKET
+} Qmss_AccPacingMode;
+
+typedef enum {
+    Qmss_AccEntrySize_REG_D = 0,
+    Qmss_AccEntrySize_REG_CD,
+    Qmss_AccEntrySize_REG_ABCD
+} Qmss_AccEntrySize;
+
+typedef enum {
+    Qmss_AccCountMode_NULL_TERMINATE = 0,
+    Qmss_AccCountMode_ENTRY_COUNT
+} Qmss_AccCountMode;
+
+typedef enum {
+    Qmss_AccQueueMode_SINGLE_QUEUE = 0,
+    Qmss_AccQueueMode_MULTI_QUEUE
+} Qmss_AccQueueMode;
+
+typedef enum {
+    Qmss_IntdInterruptType_HIGH = 0,
+    Qmss_IntdInterruptType_LOW,
+    Qmss_IntdInterruptType_CDMA
+} Qmss_IntdInterruptType;
+
+typedef struct {
+    uint8_t     channel;
+    Qmss_AccCmd command;
+    uint32_t    queueEnMask;
+    uint32_t    listAddress;
+    uint16_t    queMgrIndex;
+    uint16_t    maxPageEntries;
+    uint16_t    timerLoadCount;
+    Qmss_AccPacingMode interruptPacingMode;
+    Qmss_AccEntrySize listEntrySize;
+    Qmss_AccCountMode listCountMode;
+    Qmss_AccQueueMode multiQueueMode;
+} Qmss_AccCmdCfg;
+
+Qmss_Result Qmss_programAccumulator(Qmss_PdspId pdspId, Qmss_AccCmdCfg *cfg);
+Qmss_Result Qmss_disableAccumulator(Qmss_PdspId pdspId, uint8_t channel);
+Qmss_Result Qmss_ackInterrupt(uint8_t interruptNum, uint8_t value);
+Qmss_Result Qmss_setEoiVector(Qmss_IntdInterruptType type,
+        uint8_t accumCh);
+
+#endif /* TI_DRV_QMSS_QMSS_DRV_H_ */
@@ -0,0 +1,15 @@
+/*
+ *  ======== ti/drv/qmss/qmss_firmware.h ========
+ *  Host emulation: the accumulator is emulated in host/emu_acc.c, the
+ *  firmware images only exist so that Qmss_InitCfg can name them.
+ */
+
+#ifndef TI_DRV_QMSS_QMSS_FIRMWARE_H_
+#define TI_DRV_QMSS_QMSS_FIRMWARE_H_
+
+#include <ti/drv/qmss/qmss_drv.h>
+
+extern const unsigned int acc48_le[1];
+extern const unsigned int acc48_be[1];
+
+#endif /* TI_DRV_QMSS_QMSS_FIRMWARE_H_ */
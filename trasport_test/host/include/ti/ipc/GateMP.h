@@ -0,0 +1,47 @@
+/*
+ *  ======== ti/ipc/GateMP.h ========
+ *  Host emulation: a GateMP is a named mutex shared by the emulated cores,
+ *  whatever protection its parameters ask for.
+ */
+
+#ifndef TI_IPC_GATEMP_H_
+#define TI_IPC_GATEMP_H_
+
+#include <xdc/std.h>
+
+#define GateMP_S_SUCCESS        0
+#define GateMP_E_FAIL           (-1)
+#define GateMP_E_NOTFOUND       (-5)
+
+typedef struct GateMP_Object *GateMP_Handle;
+
+typedef enum GateMP_LocalProtect {
+    GateMP_LocalProtect_NONE = 0,
+    GateMP_LocalProtect_INTERRUPT = 1,
+    GateMP_LocalProtect_TASKLET = 2,
+    GateMP_LocalProtect_THREAD = 3,
+    GateMP_LocalProtect_PROCESS = 4
+} GateMP_LocalProtect;
+
+typedef enum GateMP_RemoteProtect {
+    GateMP_RemoteProtect_NONE = 0,
+    GateMP_RemoteProtect_SYSTEM = 1,
+    GateMP_RemoteProtect_CUSTOM1 = 2,
+    GateMP_RemoteProtect_CUSTOM2 = 3
+} GateMP_RemoteProtect;
+
+typedef struct GateMP_Params {
+    String                  name;
+    UInt16                  regionId;
+    Ptr                     sharedAddr;
+    GateMP_LocalProtect     localProtect;
+    GateMP_RemoteProtect    remoteProtect;
+} GateMP_Params;
+
+Void GateMP_Params_init(GateMP_Params *params);
+GateMP_Handle GateMP_create(const GateMP_Params *params);
+Int GateMP_open(String name, GateMP_Handle *handlePtr);
+IArg GateMP_enter(GateMP_Handle handle);
+Void GateMP_leave(GateMP_Handle handle, IArg key);
+
+#endif /* TI_IPC_GATEMP_H_ */
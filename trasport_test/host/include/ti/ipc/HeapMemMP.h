@@ -0,0 +1,34 @@
+/*
+ *  ======== ti/ipc/HeapMemMP.h ========
+ *  Host emulation: a HeapMemMP is a named piece of the emulated
+ *  SharedRegion 0 handed out from the bottom up. Freed blocks are not
+ *  reused; the programs allocate their shared buffers once.
+ */
+
+#ifndef TI_IPC_HEAPMEMMP_H_
+#define TI_IPC_HEAPMEMMP_H_
+
+#include <xdc/std.h>
+#include <ti/ipc/GateMP.h>
+
+#define HeapMemMP_S_SUCCESS     0
+#define HeapMemMP_E_FAIL        (-1)
+#define HeapMemMP_E_NOTFOUND    (-5)
+
+typedef struct HeapMemMP_Object *HeapMemMP_Handle;
+
+typedef struct HeapMemMP_Params {
+    GateMP_Handle   gate;
+    String          name;
+    UInt16          regionId;
+    Ptr             sharedAddr;
+    SizeT           sharedBufSize;
+} HeapMemMP_Params;
+
+Void HeapMemMP_Params_init(HeapMemMP_Params *params);
+HeapMemMP_Handle HeapMemMP_create(const HeapMemMP_Params *params);
+Int HeapMemMP_open(String name, HeapMemMP_Handle *handlePtr);
+Ptr HeapMemMP_alloc(HeapMemMP_Handle handle, SizeT size, SizeT align);
+Void HeapMemMP_free(HeapMemMP_Handle handle, Ptr block, SizeT size);
+
+#endif /* TI_IPC_HEAPMEMMP_H_ */
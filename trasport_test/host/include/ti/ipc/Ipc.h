@@ -0,0 +1,23 @@
+/*
+ *  ======== ti/ipc/Ipc.h ========
+ *  Host emulation: Ipc_start, nothing to attach to.
+ */
+
+#ifndef TI_IPC_IPC_H_
+#define TI_IPC_IPC_H_
+
+#include <xdc/std.h>
+
+#define Ipc_S_SUCCESS           0
+#define Ipc_E_FAIL              (-1)
+
+/*
+ *  ======== Ipc_start ========
+ *  The emulated SharedRegion 0 is there from the start.
+ */
+static inline Int Ipc_start(Void)
+{
+    return Ipc_S_SUCCESS;
+}
+
+#endif /* TI_IPC_IPC_H_ */
@@ -0,0 +1,39 @@
+/*
+ *  ======== ti/ipc/ListMP.h ========
+ *  Host emulation: a ListMP is a named, doubly linked list of elements in
+ *  shared memory, guarded by its GateMP (or a default one).
+ */
+
+#ifndef TI_IPC_LISTMP_H_
+#define TI_IPC_LISTMP_H_
+
+#include <xdc/std.h>
+#include <ti/ipc/GateMP.h>
+#include <ti/ipc/SharedRegion.h>
+
+#define ListMP_S_SUCCESS        0
+#define ListMP_E_FAIL           (-1)
+#define ListMP_E_NOTFOUND       (-5)
+
+typedef struct ListMP_Elem {
+    volatile SharedRegion_SRPtr next;
+    volatile SharedRegion_SRPtr prev;
+} ListMP_Elem;
+
+typedef struct ListMP_Object *ListMP_Handle;
+
+typedef struct ListMP_Params {
+    GateMP_Handle   gate;
+    String          name;
+    Ptr             sharedAddr;
+    UInt16          regionId;
+} ListMP_Params;
+
+Void ListMP_Params_init(ListMP_Params *params);
+ListMP_Handle ListMP_create(const ListMP_Params *params);
+Int ListMP_open(String name, ListMP_Handle *handlePtr);
+Bool ListMP_empty(ListMP_Handle handle);
+Ptr ListMP_getHead(ListMP_Handle handle);
+Int ListMP_putTail(ListMP_Handle handle, ListMP_Elem *elem);
+
+#endif /* TI_IPC_LISTMP_H_ */
@@ -0,0 +1,25 @@
+/*
+ *  ======== ti/ipc/MultiProc.h ========
+ *  Host emulation: processor ids are the emulated core numbers.
+ */
+
+#ifndef TI_IPC_MULTIPROC_H_
+#define TI_IPC_MULTIPROC_H_
+
+#include <xdc/std.h>
+#include <ti/csl/csl_chip.h>
+
+#define MultiProc_S_SUCCESS     0
+
+static inline Int MultiProc_setLocalId(UInt16 id)
+{
+    (void)id;
+    return MultiProc_S_SUCCESS;
+}
+
+static inline UInt16 MultiProc_self(Void)
+{
+    return (UInt16)emu_coreNum();
+}
+
+#endif /* TI_IPC_MULTIPROC_H_ */
@@ -0,0 +1,28 @@
+/*
+ *  ======== ti/ipc/SharedRegion.h ========
+ *  Host emulation: shared region pointers are plain 32-bit addresses, as
+ *  with SharedRegion.translate = false in transport_t.cfg. SharedRegion 0
+ *  is a static block of host memory, see host/emu_ipc.c.
+ */
+
+#ifndef TI_IPC_SHAREDREGION_H_
+#define TI_IPC_SHAREDREGION_H_
+
+#include <xdc/std.h>
+
+typedef UInt32 SharedRegion_SRPtr;
+
+#define SharedRegion_INVALIDSRPTR   ((SharedRegion_SRPtr) 0)
+
+static inline SharedRegion_SRPtr SharedRegion_getSRPtr(Ptr addr, UInt16 id)
+{
+    (void)id;
+    return (SharedRegion_SRPtr)(uintptr_t)addr;
+}
+
+static inline Ptr SharedRegion_getPtr(SharedRegion_SRPtr srptr)
+{
+    return (Ptr)(uintptr_t)srptr;
+}
+
+#endif /* TI_IPC_SHAREDREGION_H_ */
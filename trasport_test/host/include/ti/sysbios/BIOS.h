@@ -0,0 +1,18 @@
+/*
+ *  ======== ti/sysbios/BIOS.h ========
+ *  Host emulation: BIOS_start runs the tasks created so far on the calling
+ *  emulated core and never returns, see host/emu_bios.c.
+ */
+
+#ifndef TI_SYSBIOS_BIOS_H_
+#define TI_SYSBIOS_BIOS_H_
+
+#include <xdc/std.h>
+
+#define BIOS_WAIT_FOREVER   (~(UInt32)0)
+#define BIOS_NO_WAIT        ((UInt32)0)
+
+Void BIOS_start(Void);
+Void BIOS_exit(Int stat);
+
+#endif /* TI_SYSBIOS_BIOS_H_ */
@@ -0,0 +1,31 @@
+/*
+ *  ======== ti/sysbios/hal/Hwi.h ========
+ *  Host emulation: an interrupt is an event raised by an emulated
+ *  peripheral (see emu_raiseEvent in host/emu.h); the handler created for
+ *  that event on the target core runs in the raising thread, serialized
+ *  with the core's other handlers. The interrupt number is ignored.
+ */
+
+#ifndef TI_SYSBIOS_HAL_HWI_H_
+#define TI_SYSBIOS_HAL_HWI_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef Void (*Hwi_FuncPtr)(UArg arg);
+
+typedef struct Hwi_Object *Hwi_Handle;
+
+typedef struct Hwi_Params {
+    UArg    arg;
+    Int     eventId;
+    Int     priority;
+    Bool    enableInt;
+    UInt    maskSetting;
+} Hwi_Params;
+
+Void Hwi_Params_init(Hwi_Params *params);
+Hwi_Handle Hwi_create(Int intNum, Hwi_FuncPtr hwiFxn,
+        const Hwi_Params *params, Error_Block *eb);
+
+#endif /* TI_SYSBIOS_HAL_HWI_H_ */
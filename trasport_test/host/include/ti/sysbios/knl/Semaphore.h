@@ -0,0 +1,31 @@
+/*
+ *  ======== ti/sysbios/knl/Semaphore.h ========
+ *  Host emulation: counting semaphores shared by the emulated cores'
+ *  threads. Timeouts are in 1 ms ticks, like Task_sleep.
+ */
+
+#ifndef TI_SYSBIOS_KNL_SEMAPHORE_H_
+#define TI_SYSBIOS_KNL_SEMAPHORE_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef struct Semaphore_Object *Semaphore_Handle;
+
+typedef enum {
+    Semaphore_Mode_COUNTING = 0,
+    Semaphore_Mode_BINARY
+} Semaphore_Mode;
+
+typedef struct Semaphore_Params {
+    Semaphore_Mode mode;
+} Semaphore_Params;
+
+Void Semaphore_Params_init(Semaphore_Params *params);
+Semaphore_Handle Semaphore_create(Int count, const Semaphore_Params *params,
+        Error_Block *eb);
+Bool Semaphore_pend(Semaphore_Handle sem, UInt32 timeout);
+Void Semaphore_post(Semaphore_Handle sem);
+Int Semaphore_getCount(Semaphore_Handle sem);
+
+#endif /* TI_SYSBIOS_KNL_SEMAPHORE_H_ */
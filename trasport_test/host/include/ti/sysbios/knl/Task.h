@@ -0,0 +1,35 @@
+/*
+ *  ======== ti/sysbios/knl/Task.h ========
+ *  Host emulation: every task is a thread of the emulated core that
+ *  created it. Priorities are ignored; Task_sleep counts in 1 ms ticks,
+ *  the SYS/BIOS default Clock period.
+ */
+
+#ifndef TI_SYSBIOS_KNL_TASK_H_
+#define TI_SYSBIOS_KNL_TASK_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef Void (*Task_FuncPtr)(UArg arg0, UArg arg1);
+
+typedef struct Task_Object *Task_Handle;
+
+typedef struct Task_Params {
+    UArg    arg0;
+    UArg    arg1;
+    Int     priority;
+    Ptr     stack;
+    SizeT   stackSize;
+    Ptr     env;
+    Bool    vitalTaskFlag;
+} Task_Params;
+
+Void Task_Params_init(Task_Params *params);
+Task_Handle Task_create(Task_FuncPtr fxn, const Task_Params *params,
+        Error_Block *eb);
+Void Task_sleep(UInt32 nticks);
+Void Task_yield(Void);
+Void Task_exit(Void);
+
+#endif /* TI_SYSBIOS_KNL_TASK_H_ */
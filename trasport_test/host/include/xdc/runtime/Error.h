@@ -0,0 +1,18 @@
+/*
+ *  ======== xdc/runtime/Error.h ========
+ *  Host emulation: errors are never raised, the block is only a marker.
+ */
+
+#ifndef XDC_RUNTIME_ERROR_H_
+#define XDC_RUNTIME_ERROR_H_
+
+#include <xdc/std.h>
+
+typedef struct Error_Block {
+    Int     code;
+} Error_Block;
+
+#define Error_init(eb)  ((eb)->code = 0)
+#define Error_check(eb) ((eb) != NULL && (eb)->code != 0)
+
+#endif /* XDC_RUNTIME_ERROR_H_ */
@@ -0,0 +1,19 @@
+/*
+ *  ======== xdc/runtime/System.h ========
+ *  Host emulation: System_printf goes straight to stdout.
+ */
+
+#ifndef XDC_RUNTIME_SYSTEM_H_
+#define XDC_RUNTIME_SYSTEM_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <xdc/std.h>
+
+#define System_printf   printf
+#define System_flush()  fflush(stdout)
+#define System_abort(s) (fputs((s), stderr), abort())
+#define System_exit(s)  exit(s)
+
+#endif /* XDC_RUNTIME_SYSTEM_H_ */
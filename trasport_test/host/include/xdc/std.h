@@ -0,0 +1,43 @@
+/*
+ *  ======== xdc/std.h ========
+ *  Host emulation: the XDC/CSL base types used by trasport_test.
+ */
+
+#ifndef XDC_STD_H_
+#define XDC_STD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef void            Void;
+typedef char            Char;
+typedef int             Int;
+typedef unsigned int    UInt;
+typedef int8_t          Int8;
+typedef uint8_t         UInt8;
+typedef int16_t         Int16;
+typedef uint16_t        UInt16;
+typedef int32_t         Int32;
+typedef uint32_t        UInt32;
+typedef int64_t         Int64;
+typedef uint64_t        UInt64;
+typedef unsigned short  Bool;
+typedef char           *String;
+typedef void           *Ptr;
+typedef intptr_t        IArg;
+typedef uintptr_t       UArg;
+typedef size_t          SizeT;
+
+/* CSL spelling */
+typedef uint8_t         Uint8;
+typedef uint16_t        Uint16;
+typedef uint32_t        Uint32;
+typedef uint64_t        Uint64;
+
+#ifndef TRUE
+#define TRUE    1
+#define FALSE   0
+#endif
+
+#endif /* XDC_STD_H_ */
@@ -19,6 +19,11 @@
 #include <ti/csl/csl_chip.h>
 #include <ti/csl/csl_cacheAux.h>
 
+#include "transport_ipc.h"
+#include "transport_latency.h"
+#include "transport_stats.h"
+#include "transport_timer.h"
+
 //#include "cp_utils.h"
 
 /* QMSS device specific configuration */
@@ -30,6 +35,32 @@ extern Cppi_GlobalConfigParams cppiGblCfgParams;
 #define MONOLITHIC_DESC_DATA_OFFSET 16
 
 #define MULTICORE
+#define MAIN_NUM_CORES 4
+#define MAIN_PRODUCER 0
+
+/*
+ * Transport backend. MAIN_BACKEND_QMSS moves the payloads in monolithic
+ * descriptors through the infrastructure PKTDMA; MAIN_BACKEND_IPC moves
+ * them in ListMP messages in SharedRegion 0, see transport_ipc.h. taskA
+ * and taskB do the same work on both, so their latency and throughput
+ * reports compare.
+ */
+#define MAIN_BACKEND_QMSS 0
+#define MAIN_BACKEND_IPC 1
+#ifndef MAIN_BACKEND
+#define MAIN_BACKEND MAIN_BACKEND_QMSS
+#endif
+
+/* Ticks taskA sleeps after each packet, 0 to send as fast as it can */
+#ifndef MAIN_TX_SLEEP
+#define MAIN_TX_SLEEP 1000
+#endif
+
+/* taskB prints every sample it receives, besides the reports */
+#ifndef MAIN_RX_PRINT
+#define MAIN_RX_PRINT 0
+#endif
+
 #define QUEUE_TX_OP_NUM 800
 #define QUEUE_TX_FREE_NUM 852
 #define QUEUE_RX_OP_NUM 858
@@ -44,8 +75,11 @@ unsigned char mono_region[NUM_DESC * SIZE_DESC];
 #pragma DATA_SECTION(cppiHnd, ".cppi")
 #pragma DATA_ALIGN(cppiHnd, 128)
 Cppi_Handle cppiHnd = NULL;
-Task_Params tp;
 
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+/* IPC backend handles, one per core */
+static TIpc ipcHnd[MAIN_NUM_CORES];
+#else
 static UInt32 l2_global_address(UInt32 addr)
 {
 	/* Get the core number. */
@@ -53,6 +87,7 @@ static UInt32 l2_global_address(UInt32 addr)
 	/* Compute the global address. */
 	return (addr + (0x10000000 + (coreNum * 0x1000000)));
 }
+#endif
 
 Void myStartupFxn (Void)
 {
@@ -66,7 +101,59 @@ void generateData(Uint32 * vect, int lenght){
 	}
 }
 
+/*
+ *  ======== mainReport ========
+ *  Publishes the counters of the link from the producer to the calling
+ *  consumer and prints them, with its latencies, about once a second
+ *  while packets come.
+ */
+static void mainReport(TStats *stats, TLatHist *hist, UInt64 *nextReport,
+		UInt32 *reported)
+{
+	UInt64 now = transport_timerRead();
+	double span;
+	char name[16];
+
+	tstats_publish(stats);
+	if (*nextReport == 0)
+		*nextReport = now + (UInt64) TRANSPORT_TIMER_HZ;
+	if (now < *nextReport || stats->packets == *reported)
+		return;
+	*nextReport = now + (UInt64) TRANSPORT_TIMER_HZ;
+	*reported = stats->packets;
+
+	span = (stats->last > stats->first) ? (double) (stats->last - stats->first)
+			: 0.0;
+	printf("Link %d->%d (%s): %u packets, %u errors, %.0f packets/s, "
+			"%.2f MB/s\n", stats->producer, stats->core,
+			(MAIN_BACKEND == MAIN_BACKEND_IPC) ? "ipc" : "qmss", stats->packets,
+			stats->errors,
+			(span > 0) ? (stats->packets - 1) * TRANSPORT_TIMER_HZ / span : 0.0,
+			(span > 0) ? stats->bytes * TRANSPORT_TIMER_HZ / span / 1e6 : 0.0);
+	snprintf(name, sizeof(name), "Latency %d->%d", stats->producer,
+			stats->core);
+	tlat_print(name, hist);
+}
+
 void taskA(UArg a0, UArg a1) {
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+	TIpc *ipc = (TIpc *) a0;
+	UInt8 *payload;
+
+	do{
+	// Wait for a free message
+	while ((payload = tipc_txAlloc(ipc)) == NULL)
+		Task_yield();
+
+	// No copy: the payload goes straight into the shared message
+	generateData((Uint32 *) payload, SIZE_DESC/8);
+	tlat_stamp(payload);
+	tipc_txSend(ipc, payload, SIZE_DESC/2);
+#if MAIN_TX_SLEEP > 0
+	Task_sleep(MAIN_TX_SLEEP);
+#endif
+	}while(1);
+#else
 	Qmss_QueueHnd opq = (Qmss_QueueHnd) a0;
 	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
 	UInt32 symbol_buffer[SIZE_DESC/8];
@@ -80,7 +167,7 @@ void taskA(UArg a0, UArg a1) {
 	// Wait for a free descriptor
 	//breakpoint
 	while ((desc = Qmss_queuePop(freeq)) == NULL)
-		{}
+		Task_yield();
 
 	// Re-align descriptor address:
 	desc = (Cppi_Desc *) ((UInt32) desc & ~0xf);
@@ -90,6 +177,8 @@ void taskA(UArg a0, UArg a1) {
 
 	// Cppi_setData - Copy data buffer to descriptor:
 	Cppi_setData(Cppi_DescType_MONOLITHIC, desc, (UInt8 *) symbol_buffer, SIZE_DESC/2);
+	// The copy does not set the length the PKTDMA moves
+	Cppi_setPacketLen(Cppi_DescType_MONOLITHIC, desc, SIZE_DESC/2);
 
 	// Set tag in descriptor:
 	tag.destTagLo = 0;
@@ -102,28 +191,63 @@ void taskA(UArg a0, UArg a1) {
 	// Define where to recycle descriptor:
 	Cppi_setReturnQueue(Cppi_DescType_MONOLITHIC, desc, queInfo);
 
+	// Stamp the payload, as late as possible:
+	tlat_stamp((UInt8 *) desc + MONOLITHIC_DESC_DATA_OFFSET);
+
 	// Push descriptor to Tx operational queue:
 	Qmss_queuePushDescSize(opq, desc, SIZE_DESC);
-	Task_sleep(1000);
+#if MAIN_TX_SLEEP > 0
+	Task_sleep(MAIN_TX_SLEEP);
+#endif
 	}while(1);
+#endif
 	return;
 }
 
 void taskB(UArg a0, UArg a1) {
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	TStats *stats = &tstats[MAIN_PRODUCER][core_num];
+	TLatHist *hist = &tlat[MAIN_PRODUCER][core_num];
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+	TIpc *ipc = (TIpc *) a0;
+#else
 	Qmss_QueueHnd opq = (Qmss_QueueHnd) a0;
 	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
 	Cppi_Desc *desc = NULL;
+#endif
 	UInt8 * descBuffer;
 	UInt32 destLen;
+	UInt64 nextReport = 0;
+	UInt32 reported = 0;
+#if MAIN_RX_PRINT
 	UInt8 i;
 	UInt32 sample;
+#endif
 
-	while ((desc = Qmss_queuePop(opq)) == NULL) { }
+	do{
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+	while ((descBuffer = tipc_rxRecv(ipc, &destLen)) == NULL)
+		Task_yield();
+#else
+	while ((desc = Qmss_queuePop(opq)) == NULL)
+		Task_yield();
+
+	// Re-align descriptor address, and drop stale lines of it from L1D:
+	desc = (Cppi_Desc *) ((UInt32) desc & ~0xf);
+	CACHE_invL1d((void *) desc, SIZE_DESC, CACHE_WAIT);
 
 	// Retrieve payload from monolithic descriptors:
 	//breakpoint
 	Cppi_getData (Cppi_DescType_MONOLITHIC, desc, &descBuffer, &destLen);
+#endif
 
+	// The stamp takes the first words of the generateData pattern
+	tlat_add(hist, tlat_now() - tlat_read(descBuffer));
+	tstats_count(stats, destLen,
+			tstats_checkPayloadAt(descBuffer + TLAT_STAMP_SIZE,
+					destLen - TLAT_STAMP_SIZE, TLAT_STAMP_SIZE / 4));
+
+#if MAIN_RX_PRINT
 	for (i=0; i < destLen; i = i + 4)
 		{
 		sample = descBuffer[i];
@@ -136,15 +260,26 @@ void taskB(UArg a0, UArg a1) {
 	}
 
 	printf("Got descriptor\n");
+#endif
 
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+	// Recycle message:
+	tipc_rxRelease(ipc, descBuffer);
+#else
 	// Recycle descriptor:
 	Qmss_queuePushDesc(freeq, desc);
+#endif
+
+	mainReport(stats, hist, &nextReport, &reported);
+	}while(1);
 
 	return;
 }
 
 void master_task() {
 	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	Task_Params tp;
+#if MAIN_BACKEND == MAIN_BACKEND_QMSS
 	/* ---------------------------- Initialization of QMSS ------------------------- */
 	int ret;
 	Qmss_InitCfg qmssInitConfig;
@@ -155,8 +290,24 @@ void master_task() {
 	unsigned char is_allocated;
 
 	Qmss_QueueHnd q_tx_op, q_rx_op, q_tx_free, q_rx_free;
+#endif
 
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+	/* ---------------------------- Initialization of IPC ------------------------- */
 
+	/* Attach to the other cores and SharedRegion 0 */
+	if (Ipc_start() < 0) {
+		printf("Error starting IPC.\n");
+		return;
+	}
+
+	/* Core 0 makes the messages and lists, the others wait for them */
+	if (core_num == 0 ? tipc_create(&ipcHnd[core_num], NUM_DESC, SIZE_DESC/2) < 0
+			: tipc_open(&ipcHnd[core_num]) < 0) {
+		printf("Error setting up the IPC transport.\n");
+		return;
+	}
+#else
 if(core_num==0){
 
 	memset(&qmssInitConfig, 0, sizeof(Qmss_InitCfg));
@@ -330,6 +481,23 @@ if(core_num==0){
 }else{
 #endif
 
+	/* Wait for core 0 to open the QMSS CPDMA */
+	while (cppiHnd == NULL) {
+		CACHE_invL1d((void *)&cppiHnd, 128, CACHE_WAIT);
+	}
+
+	/* Open the operation queue for the receive side */
+	q_rx_op = Qmss_queueOpen(
+		Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+		QUEUE_RX_OP_NUM,
+		&is_allocated);
+
+	/* Open the free queue for the receive side */
+	q_rx_free = Qmss_queueOpen(
+		Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+		QUEUE_RX_FREE_NUM,
+		&is_allocated);
+
  	/* ------ Rx channel configuration --------- */                         
         Cppi_RxChInitCfg rxChCfg;                                               
         rxChCfg.channelNum = CPPI_PARAM_NOT_SPECIFIED;                          
@@ -371,6 +539,18 @@ if(core_num==0){
 	ret = Cppi_channelEnable(rxChHnd);
 
 }
+#endif
+	/* ---------------------------- Measurements ------------------------- */
+
+	/* Clean counters for this core's link, and a common time base */
+	memset((Void *) &tstats[MAIN_PRODUCER][core_num], 0, sizeof(TStats));
+	tstats[MAIN_PRODUCER][core_num].producer = MAIN_PRODUCER;
+	tstats[MAIN_PRODUCER][core_num].core = core_num;
+	tstats_publish(&tstats[MAIN_PRODUCER][core_num]);
+	tlat_clear(&tlat[MAIN_PRODUCER][core_num]);
+	transport_timerInit();
+	tlat_sync((1 << MAIN_NUM_CORES) - 1);
+
 	/* ---------------------------- Create Tasks ------------------------- */
 
 	/* Create the operational tasks: one producer, one consumer.
@@ -379,15 +559,23 @@ if(core_num==0){
 
 	Task_Params_init(&tp);
 	if (core_num == 0) {
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+		tp.arg0 = (UArg) &ipcHnd[core_num];
+#else
 		tp.arg0 = q_tx_op;
 		tp.arg1 = q_tx_free;
+#endif
 		Task_create(taskA, &tp, NULL);
 
 #ifdef MULTICORE
 	}else{
 #endif
+#if MAIN_BACKEND == MAIN_BACKEND_IPC
+		tp.arg0 = (UArg) &ipcHnd[core_num];
+#else
 		tp.arg0 = q_rx_op;
 		tp.arg1 = q_rx_free;
+#endif
 		Task_create(taskB, &tp, NULL);
 	}
 }
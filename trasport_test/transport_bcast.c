@@ -0,0 +1,133 @@
+/*
+ *  ======== transport_bcast.c ========
+ *  Broadcast of one descriptor payload to several cores, see
+ *  transport_bcast.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+#include <ti/csl/csl_semAux.h>
+
+#include "transport_bcast.h"
+#include "transport_hdesc.h"
+
+#define TBCAST_MASK (TBCAST_DEPTH - 1)
+
+/*
+ *  ======== tbcast_init ========
+ */
+Void tbcast_init(TBcast *b, Qmss_QueueHnd freeq)
+{
+	memset((Void *) b, 0, sizeof(*b));
+	b->freeq = freeq;
+	CACHE_wbL1d((void *) b, sizeof(*b), CACHE_WAIT);
+}
+
+/*
+ *  ======== tbcast_publish ========
+ *  The buffers and headers go out first; the fenced write back of the
+ *  slot waits for them, and only then the new head.
+ */
+Int tbcast_publish(TBcast *b, Cppi_Desc *sop, UInt32 readers)
+{
+	TBcastSlot *slot = &b->slots[b->head & TBCAST_MASK];
+	Cppi_Desc *d;
+	UInt8 *buf;
+	UInt32 len, refs = 0;
+
+	if (readers == 0) {
+		thdesc_txCancel(b->freeq, sop);
+		return 0;
+	}
+
+	CACHE_invL1d((void *) slot, sizeof(*slot), CACHE_WAIT);
+	if (slot->refs != 0)
+		return -1;
+
+	for (d = sop; d != NULL; d = Cppi_getNextBD(Cppi_DescType_HOST, d)) {
+		Cppi_getData(Cppi_DescType_HOST, d, &buf, &len);
+		CACHE_wbL1d((void *) buf, len, CACHE_NOWAIT);
+		CACHE_wbL1d((void *) d, THDESC_HEADER_SIZE, CACHE_NOWAIT);
+	}
+
+	for (len = readers; len != 0; len &= len - 1) {
+		refs++;
+	}
+	slot->seq = b->head + 1;
+	slot->readers = readers;
+	slot->refs = refs;
+	slot->sop = (UInt32) sop;
+	CACHE_wbL1d((void *) slot, sizeof(*slot), CACHE_FENCE_WAIT);
+
+	b->head++;
+	CACHE_wbL1d((void *) &b->head, TSTATS_LINE, CACHE_WAIT);
+	return 0;
+}
+
+/*
+ *  ======== tbcast_attach ========
+ */
+Void tbcast_attach(TBcastReader *r, TBcast *b, UInt32 core)
+{
+	CACHE_invL1d((void *) b, TSTATS_LINE, CACHE_WAIT);
+	r->bcast = b;
+	r->core = core;
+	r->next = b->head;
+	r->held = NULL;
+}
+
+/*
+ *  ======== tbcast_recv ========
+ *  A slot that no longer holds broadcast next was recycled without this
+ *  core, so it was not addressed to it either.
+ */
+Cppi_Desc *tbcast_recv(TBcastReader *r)
+{
+	TBcast *b = r->bcast;
+	TBcastSlot *slot;
+	Cppi_Desc *sop;
+
+	for (;;) {
+		CACHE_invL1d((void *) b, TSTATS_LINE, CACHE_WAIT);
+		if (r->next == b->head)
+			return NULL;
+
+		slot = &b->slots[r->next & TBCAST_MASK];
+		CACHE_invL1d((void *) slot, sizeof(*slot), CACHE_WAIT);
+		if (slot->seq == r->next + 1 && ((slot->readers >> r->core) & 1))
+			break;
+		r->next++;
+	}
+
+	r->next++;
+	r->held = slot;
+	sop = (Cppi_Desc *) slot->sop;
+	CACHE_invL1d((void *) sop, THDESC_HEADER_SIZE, CACHE_WAIT);
+	return sop;
+}
+
+/*
+ *  ======== tbcast_release ========
+ *  The count is read from memory and written back under the hardware
+ *  semaphore; the reader that takes it to 0 recycles the chain, which
+ *  frees the slot for the publisher.
+ */
+Void tbcast_release(TBcastReader *r)
+{
+	TBcastSlot *slot = r->held;
+	Cppi_Desc *sop = (Cppi_Desc *) slot->sop;
+	UInt32 refs;
+
+	r->held = NULL;
+
+	while (CSL_semAcquireDirect(TBCAST_HW_SEM) == 0)
+		;
+	CACHE_invL1d((void *) slot, sizeof(*slot), CACHE_WAIT);
+	refs = slot->refs - 1;
+	if (refs == 0) {
+		// Back in the free queue before the publisher may reuse the slot
+		thdesc_recycle(r->bcast->freeq, sop);
+	}
+	slot->refs = refs;
+	CACHE_wbL1d((void *) slot, sizeof(*slot), CACHE_WAIT);
+	CSL_semReleaseSemaphore(TBCAST_HW_SEM);
+}
@@ -0,0 +1,102 @@
+/*
+ *  ======== transport_bcast.h ========
+ *  Broadcast of one descriptor payload to several cores, without a copy
+ *  per core.
+ *
+ *  The publisher writes the payload into a host descriptor chain
+ *  (transport_hdesc.h) once and publishes it to a mask of reader cores.
+ *  A TBcast channel in memory all cores share (MSMCSRAM) has
+ *  TBCAST_DEPTH slots, each holding one published chain and a reference
+ *  count of the readers that have not released it yet. Every reader reads
+ *  the same buffers, straight from where the publisher wrote them, and
+ *  releases the chain when done; the last one to release it recycles it
+ *  to the channel's free queue. The count is decremented under hardware
+ *  semaphore TBCAST_HW_SEM, the only read-modify-write the cores share.
+ *
+ *  The publisher owns the head line (broadcasts published) and a slot
+ *  while its count is 0; it takes a slot again only once the chain in it
+ *  has been recycled, so a slow reader holds the publisher back instead
+ *  of missing broadcasts. Readers poll the head line, see every broadcast
+ *  in order and skip those not addressed to them. A reader has one
+ *  broadcast at a time: it releases one before receiving the next.
+ */
+
+#ifndef TRANSPORT_BCAST_H_
+#define TRANSPORT_BCAST_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_desc.h>
+
+#include "transport_stats.h"
+
+/* slots of a channel, a power of two */
+#define TBCAST_DEPTH        16
+
+/* hardware semaphore guarding the reference counts; the OSAL uses 2 to 4 */
+#ifndef TBCAST_HW_SEM
+#define TBCAST_HW_SEM       5
+#endif
+
+typedef struct TBcastSlot {
+    volatile UInt32 seq;            /* broadcast number + 1, 0 if never used */
+    volatile UInt32 readers;        /* mask of the cores it is for */
+    volatile UInt32 refs;           /* readers that have not released it */
+    UInt32          sop;            /* the chain, global address */
+    UInt8           pad[TSTATS_LINE - 16];
+} TBcastSlot;
+
+typedef struct TBcast {
+    volatile UInt32 head;           /* broadcasts published, publisher's */
+    Qmss_QueueHnd   freeq;          /* where the last reader recycles to */
+    UInt8           pad[TSTATS_LINE - 8];
+    TBcastSlot      slots[TBCAST_DEPTH];
+} TBcast;
+
+typedef struct TBcastReader {
+    TBcast         *bcast;
+    UInt32          core;
+    UInt32          next;           /* broadcast number to look at next */
+    TBcastSlot     *held;           /* slot received and not released */
+} TBcastReader;
+
+/*
+ *  ======== tbcast_init ========
+ *  Sets up an empty channel recycling to freeq and writes it back.
+ *  Called by one core, before anyone else uses the channel.
+ */
+Void tbcast_init(TBcast *b, Qmss_QueueHnd freeq);
+
+/*
+ *  ======== tbcast_publish ========
+ *  Writes the chain at sop back from L1D and publishes it to the cores of
+ *  the readers mask. Returns 0, or -1 if the next slot is still held by
+ *  readers, nothing published; the caller tries again later. With an
+ *  empty mask the chain is recycled right away.
+ */
+Int tbcast_publish(TBcast *b, Cppi_Desc *sop, UInt32 readers);
+
+/*
+ *  ======== tbcast_attach ========
+ *  Reader: starts following the channel, from the next broadcast on. A
+ *  core must attach before the first broadcast addressed to it.
+ */
+Void tbcast_attach(TBcastReader *r, TBcast *b, UInt32 core);
+
+/*
+ *  ======== tbcast_recv ========
+ *  Reader: the SOP of the next broadcast for this core, its header
+ *  invalidated in L1D, or NULL if there is none yet. The chain is walked
+ *  with thdesc_getData and thdesc_next and stays valid until
+ *  tbcast_release.
+ */
+Cppi_Desc *tbcast_recv(TBcastReader *r);
+
+/*
+ *  ======== tbcast_release ========
+ *  Reader: done with the broadcast of the last tbcast_recv. The last of
+ *  its readers recycles the chain.
+ */
+Void tbcast_release(TBcastReader *r);
+
+#endif /* TRANSPORT_BCAST_H_ */
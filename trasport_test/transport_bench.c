@@ -0,0 +1,110 @@
+/*
+ *  ======== transport_bench.c ========
+ *  Descriptor handling measurements, see transport_bench.h.
+ */
+
+#include <stdio.h>
+
+#include <ti/drv/cppi/cppi_desc.h>
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_bench.h"
+#include "transport_desc.h"
+#include "transport_timer.h"
+
+static const UInt32 batchSizes[] = { 1, 4, 16, 32 };
+
+/*
+ *  ======== moveSingle ========
+ *  The per-descriptor loop the tasks used: one pop, one blocking
+ *  invalidate and one push per descriptor. Returns descriptors moved.
+ */
+static UInt32 moveSingle(Qmss_QueueHnd from, Qmss_QueueHnd to, UInt32 invSize)
+{
+	Cppi_Desc *desc;
+	UInt32 n = 0;
+
+	while ((desc = (Cppi_Desc *) Qmss_queuePop(from)) != NULL) {
+		desc = (Cppi_Desc *) ((UInt32) desc & ~0xf);
+		CACHE_invL1d((void *) desc, invSize, CACHE_WAIT);
+		Qmss_queuePushDesc(to, desc);
+		n++;
+	}
+
+	return n;
+}
+
+/*
+ *  ======== moveBatch ========
+ *  Returns descriptors moved.
+ */
+static UInt32 moveBatch(Qmss_QueueHnd from, Qmss_QueueHnd to, UInt32 batch,
+		UInt32 invSize)
+{
+	Cppi_Desc *descs[TDESC_MAX_BATCH];
+	UInt32 n, total = 0;
+
+	while ((n = tdesc_popBatch(from, descs, batch, invSize)) > 0) {
+		tdesc_pushBatch(to, descs, n, 0, 0);
+		total += n;
+	}
+
+	return total;
+}
+
+/*
+ *  ======== report ========
+ */
+static Void report(const char *name, UInt32 batch, UInt32 moved,
+		unsigned long long time)
+{
+	double rate = (time > 0) ? moved * TRANSPORT_TIMER_HZ / time : 0.0;
+
+	printf("tbench: %-6s %2u  %10.0f desc/s  %7.1f %s/desc\n", name,
+			(unsigned) batch, rate, (double) time / (moved ? moved : 1),
+			TRANSPORT_TIMER_UNIT);
+}
+
+/*
+ *  ======== tbench_batch ========
+ */
+Void tbench_batch(Qmss_QueueHnd q, UInt32 invSize)
+{
+	Qmss_QueueHnd scratch;
+	unsigned long long t0, time;
+	UInt32 moved;
+	UInt8 isAllocated;
+	int i, b;
+
+	scratch = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QMSS_PARAM_NOT_SPECIFIED, &isAllocated);
+	if (scratch < 0) {
+		printf("tbench: no scratch queue\n");
+		return;
+	}
+
+	printf("tbench: %u descriptors, %u B invalidated each\n",
+			(unsigned) Qmss_getQueueEntryCount(q), (unsigned) invSize);
+
+	moved = 0;
+	t0 = transport_timerRead();
+	for (i = 0; i < TBENCH_PASSES; i++) {
+		moved += moveSingle(q, scratch, invSize);
+		moved += moveSingle(scratch, q, invSize);
+	}
+	time = transport_timerRead() - t0;
+	report("single", 1, moved, time);
+
+	for (b = 0; b < sizeof(batchSizes) / sizeof(batchSizes[0]); b++) {
+		moved = 0;
+		t0 = transport_timerRead();
+		for (i = 0; i < TBENCH_PASSES; i++) {
+			moved += moveBatch(q, scratch, batchSizes[b], invSize);
+			moved += moveBatch(scratch, q, batchSizes[b], invSize);
+		}
+		time = transport_timerRead() - t0;
+		report("batch", batchSizes[b], moved, time);
+	}
+
+	Qmss_queueClose(scratch);
+}
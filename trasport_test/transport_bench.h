@@ -0,0 +1,27 @@
+/*
+ *  ======== transport_bench.h ========
+ *  Measurements of the descriptor handling used by the transport tasks.
+ *  They run on the calling core before it starts streaming and print one
+ *  line per case; results are in TRANSPORT_TIMER_UNIT (transport_timer.h).
+ */
+
+#ifndef TRANSPORT_BENCH_H_
+#define TRANSPORT_BENCH_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+
+/* times every descriptor of the queue is moved per case */
+#define TBENCH_PASSES       64
+
+/*
+ *  ======== tbench_batch ========
+ *  Moves all descriptors of q to a scratch queue and back TBENCH_PASSES
+ *  times, one Qmss_queuePop/Qmss_queuePushDesc at a time and then with
+ *  tdesc_popBatch/tdesc_pushBatch bursts of 1, 4, 16 and 32, and prints
+ *  descriptors per second for each. invSize bytes of every popped
+ *  descriptor are invalidated in L1D, as a consumer would.
+ */
+Void tbench_batch(Qmss_QueueHnd q, UInt32 invSize);
+
+#endif /* TRANSPORT_BENCH_H_ */
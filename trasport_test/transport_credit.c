@@ -0,0 +1,42 @@
+/*
+ *  ======== transport_credit.c ========
+ *  Transport flow control acknowledgements, see transport_credit.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_credit.h"
+
+#pragma DATA_SECTION(tcredit, ".tstats")
+#pragma DATA_ALIGN(tcredit, TSTATS_LINE)
+TCredit tcredit[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== tcredit_ack ========
+ */
+Void tcredit_ack(UInt32 producer, UInt32 consumer, UInt32 n)
+{
+	TCredit *c = &tcredit[producer][consumer];
+
+	c->acked += n;
+	CACHE_wbL1d((void *) c, TSTATS_LINE, CACHE_WAIT);
+}
+
+/*
+ *  ======== tcredit_acked ========
+ *  The sum wraps with the counts, the difference to the sent count
+ *  stays right.
+ */
+UInt32 tcredit_acked(UInt32 producer, UInt32 consumers)
+{
+	UInt32 c, acked = 0;
+
+	for (c = 0; c < TSTATS_MAX_CORES; c++) {
+		if ((consumers >> c) & 1) {
+			CACHE_invL1d((void *) &tcredit[producer][c], TSTATS_LINE,
+					CACHE_WAIT);
+			acked += tcredit[producer][c].acked;
+		}
+	}
+	return acked;
+}
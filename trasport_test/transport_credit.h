@@ -0,0 +1,42 @@
+/*
+ *  ======== transport_credit.h ========
+ *  Credit based flow control of the transport links.
+ *
+ *  A producer may have a limited number of packets in flight on a link:
+ *  sent, but not yet given back to the Rx free queues by the consumer.
+ *  The producer counts what it sends; the consumer counts what it
+ *  recycles in its acknowledgement line of the link, tcredit[producer]
+ *  [consumer], and writes it back with tcredit_ack. The lines are in
+ *  .tstats (MSMCSRAM) and each has a single writer. The difference of the
+ *  two counts is what the link holds of the Rx pools, so a producer that
+ *  keeps it under its credits cannot overrun them, however fast it runs.
+ */
+
+#ifndef TRANSPORT_CREDIT_H_
+#define TRANSPORT_CREDIT_H_
+
+#include <xdc/std.h>
+
+#include "transport_stats.h"
+
+typedef struct TCredit {
+    volatile UInt32 acked;          /* packets of the link recycled */
+    UInt8           pad[TSTATS_LINE - 4];
+} TCredit;
+
+extern TCredit tcredit[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== tcredit_ack ========
+ *  Consumer side: n more packets of producer recycled by consumer.
+ */
+Void tcredit_ack(UInt32 producer, UInt32 consumer, UInt32 n);
+
+/*
+ *  ======== tcredit_acked ========
+ *  Producer side: packets of producer recycled so far by the cores of
+ *  the consumers mask, read from memory.
+ */
+UInt32 tcredit_acked(UInt32 producer, UInt32 consumers);
+
+#endif /* TRANSPORT_CREDIT_H_ */
@@ -0,0 +1,135 @@
+/*
+ *  ======== transport_desc.c ========
+ *  Zero-copy and batched monolithic descriptor access, see
+ *  transport_desc.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_desc.h"
+
+/* Re-align a popped descriptor address (drop the size hint bits) */
+#define DESC_ADDR(d)    ((Cppi_Desc *) ((UInt32) (d) & ~0xf))
+
+/*
+ *  ======== tdesc_txAlloc ========
+ */
+UInt8 *tdesc_txAlloc(Qmss_QueueHnd freeq, Cppi_Desc **desc)
+{
+	Cppi_Desc *d = (Cppi_Desc *) Qmss_queuePop(freeq);
+
+	if (d == NULL) {
+		return NULL;
+	}
+
+	d = DESC_ADDR(d);
+	*desc = d;
+
+	return tdesc_payload(d);
+}
+
+/*
+ *  ======== tdesc_txSetup ========
+ */
+UInt32 tdesc_txSetup(Cppi_Desc *desc, UInt32 len, UInt8 flowId,
+		Qmss_Queue retq)
+{
+	Cppi_DescTag tag;
+	UInt32 size;
+
+	Cppi_setPacketLen(Cppi_DescType_MONOLITHIC, desc, len);
+
+	tag.destTagLo = 0;
+	tag.destTagHi = 0;
+	tag.srcTagLo = flowId;
+	tag.srcTagHi = 0;
+	Cppi_setTag(Cppi_DescType_MONOLITHIC, desc, &tag);
+
+	Cppi_setReturnQueue(Cppi_DescType_MONOLITHIC, desc, retq);
+
+	// Header and payload, in whole 16-byte units:
+	size = Cppi_getDataOffset(Cppi_DescType_MONOLITHIC, desc) + len;
+	return (size + 15) & ~15;
+}
+
+/*
+ *  ======== tdesc_txSend ========
+ */
+Void tdesc_txSend(Qmss_QueueHnd opq, Cppi_Desc *desc, UInt32 len,
+		UInt8 flowId, Qmss_Queue retq)
+{
+	Qmss_queuePushDescSize(opq, desc,
+			tdesc_sizeHint(tdesc_txSetup(desc, len, flowId, retq)));
+}
+
+/*
+ *  ======== tdesc_popBatch ========
+ */
+UInt32 tdesc_popBatch(Qmss_QueueHnd q, Cppi_Desc **descs, UInt32 max,
+		UInt32 invSize)
+{
+	Cppi_Desc *d;
+	UInt32 n, i;
+
+	n = Qmss_getQueueEntryCount(q);
+	if (n > max) {
+		n = max;
+	}
+
+	for (i = 0; i < n; i++) {
+		if ((d = (Cppi_Desc *) Qmss_queuePop(q)) == NULL) {
+			break;
+		}
+		descs[i] = DESC_ADDR(d);
+	}
+	n = i;
+
+	if (invSize > 0) {
+		tdesc_invBatch(descs, n, invSize);
+	}
+
+	return n;
+}
+
+/*
+ *  ======== tdesc_invBatch ========
+ *  The cache invalidations are queued with CACHE_NOWAIT; the last one
+ *  waits with a fence, which also covers the ones before it.
+ */
+Void tdesc_invBatch(Cppi_Desc **descs, UInt32 n, UInt32 invSize)
+{
+	UInt32 i;
+
+	for (i = 0; i < n; i++) {
+		CACHE_invL1d((void *) descs[i], invSize,
+				(i + 1 == n) ? CACHE_FENCE_WAIT : CACHE_NOWAIT);
+	}
+}
+
+/*
+ *  ======== tdesc_pushBatch ========
+ */
+Void tdesc_pushBatch(Qmss_QueueHnd q, Cppi_Desc **descs, UInt32 n,
+		UInt32 size, UInt32 wbSize)
+{
+	UInt32 i;
+
+	if (wbSize > 0) {
+		for (i = 0; i < n; i++) {
+			CACHE_wbL1d((void *) descs[i], wbSize,
+					(i + 1 == n) ? CACHE_FENCE_WAIT : CACHE_NOWAIT);
+		}
+	}
+
+	if (size == 0) {
+		for (i = 0; i < n; i++) {
+			Qmss_queuePushDesc(q, descs[i]);
+		}
+		return;
+	}
+
+	size = tdesc_sizeHint(size);
+	for (i = 0; i < n; i++) {
+		Qmss_queuePushDescSize(q, descs[i], size);
+	}
+}
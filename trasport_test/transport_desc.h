@@ -0,0 +1,101 @@
+/*
+ *  ======== transport_desc.h ========
+ *  Zero-copy access to monolithic descriptors for the transport tasks.
+ *
+ *  A producer takes a free descriptor with tdesc_txAlloc, writes its
+ *  payload straight into the descriptor (the area after the data offset
+ *  given to Cppi_initDescriptor) and hands it to the PKTDMA with
+ *  tdesc_txSend. This replaces filling a separate buffer and copying it
+ *  in with Cppi_setData, which moves every payload byte twice.
+ */
+
+#ifndef TRANSPORT_DESC_H_
+#define TRANSPORT_DESC_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_drv.h>
+#include <ti/drv/cppi/cppi_desc.h>
+
+/* largest burst of tdesc_popBatch / tdesc_pushBatch worth asking for */
+#define TDESC_MAX_BATCH     32
+
+/* range of the push size hint, a 4-bit field in 16-byte units */
+#define TDESC_HINT_MIN      16
+#define TDESC_HINT_MAX      256
+
+/*
+ *  ======== tdesc_txAlloc ========
+ *  Pops a free monolithic descriptor from freeq into *desc and returns its
+ *  payload area, or NULL if freeq is empty.
+ */
+UInt8 *tdesc_txAlloc(Qmss_QueueHnd freeq, Cppi_Desc **desc);
+
+/*
+ *  ======== tdesc_payload ========
+ *  Payload area of a monolithic descriptor.
+ */
+static inline UInt8 *tdesc_payload(Cppi_Desc *desc)
+{
+    return (UInt8 *) desc + Cppi_getDataOffset(Cppi_DescType_MONOLITHIC, desc);
+}
+
+/*
+ *  ======== tdesc_sizeHint ========
+ *  Push size hint for a descriptor of size bytes: rounded up to 16 and
+ *  clamped to the TDESC_HINT_MIN..TDESC_HINT_MAX the queue manager takes.
+ *  The PKTDMA only prefetches that much; it still reads the whole packet.
+ */
+static inline UInt32 tdesc_sizeHint(UInt32 size)
+{
+    size = (size + 15) & ~15;
+    if (size < TDESC_HINT_MIN)
+        return TDESC_HINT_MIN;
+    return (size > TDESC_HINT_MAX) ? TDESC_HINT_MAX : size;
+}
+
+/*
+ *  ======== tdesc_txSetup ========
+ *  Sets the packet length of a monolithic descriptor, routes it to Rx flow
+ *  flowId and sets its return queue. Returns the bytes of the descriptor
+ *  in use, the header and the len payload bytes rounded up to 16: what to
+ *  write back from L1D. tdesc_sizeHint makes a push size hint of it.
+ */
+UInt32 tdesc_txSetup(Cppi_Desc *desc, UInt32 len, UInt8 flowId,
+        Qmss_Queue retq);
+
+/*
+ *  ======== tdesc_txSend ========
+ *  tdesc_txSetup, then pushes the descriptor to the Tx queue opq.
+ */
+Void tdesc_txSend(Qmss_QueueHnd opq, Cppi_Desc *desc, UInt32 len,
+        UInt8 flowId, Qmss_Queue retq);
+
+/*
+ *  ======== tdesc_popBatch ========
+ *  Pops up to max descriptors from q into descs and returns how many. The
+ *  queue's entry count is read once; fewer may come back when another core
+ *  pops from q at the same time. With invSize > 0 the first invSize bytes
+ *  of every descriptor are invalidated in L1D before returning.
+ */
+UInt32 tdesc_popBatch(Qmss_QueueHnd q, Cppi_Desc **descs, UInt32 max,
+        UInt32 invSize);
+
+/*
+ *  ======== tdesc_invBatch ========
+ *  Invalidates the first invSize bytes of n descriptors in L1D, waiting
+ *  once for the whole burst.
+ */
+Void tdesc_invBatch(Cppi_Desc **descs, UInt32 n, UInt32 invSize);
+
+/*
+ *  ======== tdesc_pushBatch ========
+ *  Pushes n descriptors of size bytes to q, with the push size hint
+ *  tdesc_sizeHint(size), or none if size is 0. With wbSize > 0 the first
+ *  wbSize bytes of every descriptor are written back from L1D before the
+ *  first push.
+ */
+Void tdesc_pushBatch(Qmss_QueueHnd q, Cppi_Desc **descs, UInt32 n,
+        UInt32 size, UInt32 wbSize);
+
+#endif /* TRANSPORT_DESC_H_ */
@@ -0,0 +1,168 @@
+/*
+ *  ======== transport_hdesc.c ========
+ *  Host descriptor chains, see transport_hdesc.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_hdesc.h"
+
+/* Re-align a popped descriptor address (drop the size hint bits) */
+#define DESC_ADDR(d)    ((Cppi_Desc *) ((UInt32) (d) & ~0xf))
+
+/*
+ *  ======== thdesc_attach ========
+ */
+UInt32 thdesc_attach(Qmss_QueueHnd q, UInt8 *bufs, UInt32 bufSize, UInt32 n)
+{
+	Cppi_Desc *d;
+	UInt32 i;
+
+	for (i = 0; i < n; i++) {
+		if ((d = (Cppi_Desc *) Qmss_queuePop(q)) == NULL) {
+			break;
+		}
+		d = DESC_ADDR(d);
+
+		Cppi_setOriginalBufInfo(Cppi_DescType_HOST, d, bufs + i * bufSize,
+				bufSize);
+		Cppi_setData(Cppi_DescType_HOST, d, bufs + i * bufSize, bufSize);
+		Cppi_linkNextBD(Cppi_DescType_HOST, d, NULL);
+
+		Qmss_queuePushDesc(q, d);
+	}
+
+	return i;
+}
+
+/*
+ *  ======== thdesc_txAlloc ========
+ *  The headers are invalidated in L1D first: the last core to send with
+ *  a descriptor need not be this one.
+ */
+Cppi_Desc *thdesc_txAlloc(Qmss_QueueHnd freeq, UInt32 len)
+{
+	Cppi_Desc *sop = NULL, *tail = NULL, *d;
+	UInt8 *buf;
+	UInt32 bufLen, left = len;
+
+	do {
+		if ((d = (Cppi_Desc *) Qmss_queuePop(freeq)) == NULL) {
+			// Not enough buffers for the packet, give the chain back
+			if (sop != NULL) {
+				thdesc_txCancel(freeq, sop);
+			}
+			return NULL;
+		}
+		d = DESC_ADDR(d);
+		CACHE_invL1d((void *) d, THDESC_HEADER_SIZE, CACHE_WAIT);
+
+		Cppi_getOriginalBufInfo(Cppi_DescType_HOST, d, &buf, &bufLen);
+		if (bufLen > left) {
+			bufLen = left;
+		}
+		Cppi_setData(Cppi_DescType_HOST, d, buf, bufLen);
+		Cppi_linkNextBD(Cppi_DescType_HOST, d, NULL);
+		left -= bufLen;
+
+		if (sop == NULL) {
+			sop = d;
+		} else {
+			Cppi_linkNextBD(Cppi_DescType_HOST, tail, d);
+		}
+		tail = d;
+	} while (left > 0);
+
+	Cppi_setPacketLen(Cppi_DescType_HOST, sop, len);
+	return sop;
+}
+
+/*
+ *  ======== thdesc_txSend ========
+ *  The write backs are queued with CACHE_NOWAIT and fenced once before
+ *  the push, the PKTDMA reads the buffers and the headers of the whole
+ *  chain straight from memory.
+ */
+Void thdesc_txSend(Qmss_QueueHnd opq, Cppi_Desc *sop, UInt8 flowId)
+{
+	Cppi_DescTag tag;
+	Cppi_Desc *d;
+	UInt8 *buf;
+	UInt32 len;
+
+	tag.destTagLo = 0;
+	tag.destTagHi = 0;
+	tag.srcTagLo = flowId;
+	tag.srcTagHi = 0;
+	Cppi_setTag(Cppi_DescType_HOST, sop, &tag);
+
+	for (d = sop; d != NULL; d = Cppi_getNextBD(Cppi_DescType_HOST, d)) {
+		Cppi_getData(Cppi_DescType_HOST, d, &buf, &len);
+		CACHE_wbL1d((void *) buf, len, CACHE_NOWAIT);
+		if (d != sop) {
+			CACHE_wbL1d((void *) d, THDESC_HEADER_SIZE, CACHE_NOWAIT);
+		}
+	}
+	CACHE_wbL1d((void *) sop, THDESC_HEADER_SIZE, CACHE_FENCE_WAIT);
+
+	Qmss_queuePushDescSize(opq, sop, THDESC_HEADER_SIZE);
+}
+
+/*
+ *  ======== thdesc_getData ========
+ */
+Void thdesc_getData(Cppi_Desc *desc, UInt8 **buf, UInt32 *len)
+{
+	Cppi_getData(Cppi_DescType_HOST, desc, buf, len);
+	CACHE_invL1d((void *) *buf, *len, CACHE_WAIT);
+}
+
+/*
+ *  ======== thdesc_next ========
+ */
+Cppi_Desc *thdesc_next(Cppi_Desc *desc)
+{
+	Cppi_Desc *next = Cppi_getNextBD(Cppi_DescType_HOST, desc);
+
+	if (next != NULL) {
+		CACHE_invL1d((void *) next, THDESC_HEADER_SIZE, CACHE_WAIT);
+	}
+	return next;
+}
+
+/*
+ *  ======== thdesc_recycle ========
+ *  The link is read before the push: once pushed, a descriptor may be
+ *  reused at once.
+ */
+Void thdesc_recycle(Qmss_QueueHnd freeq, Cppi_Desc *sop)
+{
+	Cppi_Desc *d, *next;
+
+	for (d = sop; d != NULL; d = next) {
+		next = Cppi_getNextBD(Cppi_DescType_HOST, d);
+		Qmss_queuePushDesc(freeq, d);
+	}
+}
+
+/*
+ *  ======== thdesc_txCancel ========
+ *  A link is read before its header leaves L1D. thdesc_recycle reads the
+ *  links again from memory, into clean lines that are never written back.
+ */
+Void thdesc_txCancel(Qmss_QueueHnd freeq, Cppi_Desc *sop)
+{
+	Cppi_Desc *d, *next;
+	UInt8 *buf;
+	UInt32 len;
+
+	for (d = sop; d != NULL; d = next) {
+		next = Cppi_getNextBD(Cppi_DescType_HOST, d);
+		Cppi_getData(Cppi_DescType_HOST, d, &buf, &len);
+		CACHE_wbInvL1d((void *) buf, len, CACHE_NOWAIT);
+		CACHE_wbInvL1d((void *) d, THDESC_HEADER_SIZE,
+				(next == NULL) ? CACHE_FENCE_WAIT : CACHE_NOWAIT);
+	}
+
+	thdesc_recycle(freeq, sop);
+}
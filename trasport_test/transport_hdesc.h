@@ -0,0 +1,83 @@
+/*
+ *  ======== transport_hdesc.h ========
+ *  Host descriptors with linked buffers for the transport tasks.
+ *
+ *  A host descriptor is a small header that points at a buffer instead of
+ *  holding the payload, so the descriptors and the buffers can live in
+ *  separate pools. Every descriptor of a pool gets one buffer of the pool
+ *  attached for good with thdesc_attach (the "original buffer" words);
+ *  a packet larger than one buffer is a chain of descriptors linked with
+ *  Cppi_linkNextBD, the SOP descriptor holding the packet length.
+ *
+ *  A producer takes a chain with thdesc_txAlloc, writes the payload
+ *  straight into its buffers and hands it to the PKTDMA with
+ *  thdesc_txSend. On the receive side the Rx flow builds the chain from
+ *  its free descriptor queues; the consumer walks it with thdesc_getData
+ *  and thdesc_next and gives it back with thdesc_recycle. A producer
+ *  gives back a chain it will not send with thdesc_txCancel.
+ */
+
+#ifndef TRANSPORT_HDESC_H_
+#define TRANSPORT_HDESC_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_drv.h>
+#include <ti/drv/cppi/cppi_desc.h>
+
+/* the host descriptor words the transport uses, without EPIB or PS data */
+#define THDESC_HEADER_SIZE  32
+
+/*
+ *  ======== thdesc_attach ========
+ *  Takes n descriptors from q, attaches buffer i of bufs (n buffers of
+ *  bufSize bytes, global addresses) to the i-th one and puts them back.
+ *  Returns the number of buffers attached, less than n if q ran short.
+ */
+UInt32 thdesc_attach(Qmss_QueueHnd q, UInt8 *bufs, UInt32 bufSize, UInt32 n);
+
+/*
+ *  ======== thdesc_txAlloc ========
+ *  Pops free descriptors from freeq until their buffers hold len bytes,
+ *  links them and sets the buffer lengths and the packet length. Returns
+ *  the SOP descriptor, or NULL, with nothing taken, if freeq runs out.
+ */
+Cppi_Desc *thdesc_txAlloc(Qmss_QueueHnd freeq, UInt32 len);
+
+/*
+ *  ======== thdesc_txSend ========
+ *  Routes the chain at sop to Rx flow flowId, writes its buffers back
+ *  from L1D and pushes it to the Tx queue opq. Every descriptor goes back
+ *  to its own return queue once sent (Cppi_ReturnPolicy_RETURN_BUFFER).
+ */
+Void thdesc_txSend(Qmss_QueueHnd opq, Cppi_Desc *sop, UInt8 flowId);
+
+/*
+ *  ======== thdesc_getData ========
+ *  Buffer and length of one received descriptor, invalidated in L1D.
+ */
+Void thdesc_getData(Cppi_Desc *desc, UInt8 **buf, UInt32 *len);
+
+/*
+ *  ======== thdesc_next ========
+ *  Next descriptor of a received chain with its header invalidated in
+ *  L1D, or NULL after the last one.
+ */
+Cppi_Desc *thdesc_next(Cppi_Desc *desc);
+
+/*
+ *  ======== thdesc_recycle ========
+ *  Pushes every descriptor of the chain at sop to freeq.
+ */
+Void thdesc_recycle(Qmss_QueueHnd freeq, Cppi_Desc *sop);
+
+/*
+ *  ======== thdesc_txCancel ========
+ *  Producer: thdesc_recycle for a chain from thdesc_txAlloc that is not
+ *  sent. Its headers and buffers are written back and invalidated in L1D
+ *  first, so no dirty line of this core lands on them after another core
+ *  has taken them.
+ */
+Void thdesc_txCancel(Qmss_QueueHnd freeq, Cppi_Desc *sop);
+
+#endif /* TRANSPORT_HDESC_H_ */
@@ -0,0 +1,137 @@
+/*
+ *  ======== transport_ipc.c ========
+ *  Transport over IPC ListMP lists, see transport_ipc.h.
+ */
+
+#include <ti/sysbios/knl/Task.h>
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_ipc.h"
+
+#define TIPC_GATE_NAME      "tipc_gate"
+#define TIPC_HEAP_NAME      "tipc_heap"
+#define TIPC_FREE_NAME      "tipc_free"
+#define TIPC_DATA_NAME      "tipc_data"
+
+/* message size, whole cache lines */
+#define TIPC_MSG_SIZE(maxLen) \
+	(((maxLen) + TIPC_HDR_SIZE + TSTATS_LINE - 1) & ~(TSTATS_LINE - 1))
+
+/*
+ *  ======== tipc_create ========
+ */
+Int tipc_create(TIpc *t, UInt32 numMsgs, UInt32 maxLen)
+{
+	GateMP_Params gateParams;
+	HeapMemMP_Params heapParams;
+	ListMP_Params listParams;
+	UInt32 size = TIPC_MSG_SIZE(maxLen);
+	TIpcMsg *msg;
+	UInt32 i;
+
+	GateMP_Params_init(&gateParams);
+	gateParams.name = TIPC_GATE_NAME;
+	gateParams.regionId = TIPC_REGION_ID;
+	gateParams.remoteProtect = GateMP_RemoteProtect_SYSTEM;
+	if ((t->gate = GateMP_create(&gateParams)) == NULL)
+		return -1;
+
+	// Room for the messages and the allocator's alignment slack
+	HeapMemMP_Params_init(&heapParams);
+	heapParams.name = TIPC_HEAP_NAME;
+	heapParams.regionId = TIPC_REGION_ID;
+	heapParams.gate = t->gate;
+	heapParams.sharedBufSize = (numMsgs + 1) * size;
+	if ((t->heap = HeapMemMP_create(&heapParams)) == NULL)
+		return -1;
+
+	ListMP_Params_init(&listParams);
+	listParams.regionId = TIPC_REGION_ID;
+	listParams.gate = t->gate;
+	listParams.name = TIPC_DATA_NAME;
+	if ((t->dataList = ListMP_create(&listParams)) == NULL)
+		return -1;
+
+	// Created last: once it can be opened, everything is there
+	listParams.name = TIPC_FREE_NAME;
+	if ((t->freeList = ListMP_create(&listParams)) == NULL)
+		return -1;
+
+	for (i = 0; i < numMsgs; i++) {
+		msg = (TIpcMsg *) HeapMemMP_alloc(t->heap, size, TSTATS_LINE);
+		if (msg == NULL)
+			return -1;
+		msg->len = 0;
+		CACHE_wbL1d((void *) msg, size, CACHE_WAIT);
+		ListMP_putTail(t->freeList, &msg->elem);
+	}
+	return 0;
+}
+
+/*
+ *  ======== tipc_open ========
+ *  The free list is the last object tipc_create makes.
+ */
+Int tipc_open(TIpc *t)
+{
+	while (ListMP_open(TIPC_FREE_NAME, &t->freeList) != ListMP_S_SUCCESS) {
+		Task_sleep(1);
+	}
+
+	if (GateMP_open(TIPC_GATE_NAME, &t->gate) != GateMP_S_SUCCESS
+			|| HeapMemMP_open(TIPC_HEAP_NAME, &t->heap) != HeapMemMP_S_SUCCESS
+			|| ListMP_open(TIPC_DATA_NAME, &t->dataList) != ListMP_S_SUCCESS)
+		return -1;
+	return 0;
+}
+
+/*
+ *  ======== tipc_txAlloc ========
+ */
+UInt8 *tipc_txAlloc(TIpc *t)
+{
+	TIpcMsg *msg = (TIpcMsg *) ListMP_getHead(t->freeList);
+
+	return (msg != NULL) ? (UInt8 *) msg + TIPC_HDR_SIZE : NULL;
+}
+
+/*
+ *  ======== tipc_txSend ========
+ *  The message is the producer's until ListMP_putTail, so its header
+ *  line can be written back with the payload.
+ */
+Void tipc_txSend(TIpc *t, UInt8 *payload, UInt32 len)
+{
+	TIpcMsg *msg = (TIpcMsg *) (payload - TIPC_HDR_SIZE);
+
+	msg->len = len;
+	CACHE_wbL1d((void *) msg, TIPC_HDR_SIZE + len, CACHE_WAIT);
+	ListMP_putTail(t->dataList, &msg->elem);
+}
+
+/*
+ *  ======== tipc_rxRecv ========
+ */
+UInt8 *tipc_rxRecv(TIpc *t, UInt32 *len)
+{
+	TIpcMsg *msg = (TIpcMsg *) ListMP_getHead(t->dataList);
+
+	if (msg == NULL)
+		return NULL;
+
+	CACHE_invL1d((void *) msg, TSTATS_LINE, CACHE_WAIT);
+	*len = msg->len;
+	if (TIPC_HDR_SIZE + *len > TSTATS_LINE) {
+		CACHE_invL1d((void *) ((UInt8 *) msg + TSTATS_LINE),
+				TIPC_HDR_SIZE + *len - TSTATS_LINE, CACHE_WAIT);
+	}
+	return (UInt8 *) msg + TIPC_HDR_SIZE;
+}
+
+/*
+ *  ======== tipc_rxRelease ========
+ */
+Void tipc_rxRelease(TIpc *t, UInt8 *payload)
+{
+	ListMP_putTail(t->freeList, (ListMP_Elem *) (payload - TIPC_HDR_SIZE));
+}
@@ -0,0 +1,88 @@
+/*
+ *  ======== transport_ipc.h ========
+ *  Transport over IPC ListMP lists instead of QMSS queues, the IPC
+ *  backend of main_qmss.c.
+ *
+ *  Core 0 creates a GateMP, a HeapMemMP in SharedRegion 0 (MSMCSRAM, see
+ *  transport_t.cfg) and two ListMPs guarded by the gate: a free list,
+ *  which gets numMsgs messages allocated from the heap, and a data list.
+ *  They play the parts of the free descriptor queues and the Rx queue of
+ *  the QMSS path: the producer takes a message from the free list, writes
+ *  its payload in place and puts it on the data list; a consumer takes it
+ *  from there and puts it back on the free list when done. Nothing is
+ *  copied.
+ *
+ *  ListMP keeps its own links coherent; the message bytes are written
+ *  back by tipc_txSend and invalidated by tipc_rxRecv. Messages start on
+ *  a cache line and take whole lines, so they never share one.
+ */
+
+#ifndef TRANSPORT_IPC_H_
+#define TRANSPORT_IPC_H_
+
+#include <xdc/std.h>
+#include <ti/ipc/GateMP.h>
+#include <ti/ipc/HeapMemMP.h>
+#include <ti/ipc/ListMP.h>
+
+#include "transport_stats.h"
+
+#define TIPC_REGION_ID      0
+
+/* message bytes before the payload, which is 8-byte aligned */
+#define TIPC_HDR_SIZE       16
+
+typedef struct TIpcMsg {
+    ListMP_Elem     elem;
+    UInt32          len;            /* payload bytes */
+    UInt32          pad;
+} TIpcMsg;
+
+typedef struct TIpc {
+    GateMP_Handle   gate;
+    HeapMemMP_Handle heap;
+    ListMP_Handle   freeList;
+    ListMP_Handle   dataList;
+} TIpc;
+
+/*
+ *  ======== tipc_create ========
+ *  Core 0: creates the gate, the heap, the lists and numMsgs messages
+ *  for payloads of up to maxLen bytes. Returns 0, or -1 on failure.
+ */
+Int tipc_create(TIpc *t, UInt32 numMsgs, UInt32 maxLen);
+
+/*
+ *  ======== tipc_open ========
+ *  The other cores: opens what tipc_create made, waiting for it.
+ */
+Int tipc_open(TIpc *t);
+
+/*
+ *  ======== tipc_txAlloc ========
+ *  Producer: the payload area of a free message, or NULL if there is
+ *  none.
+ */
+UInt8 *tipc_txAlloc(TIpc *t);
+
+/*
+ *  ======== tipc_txSend ========
+ *  Producer: sets the length of the message at payload, writes it back
+ *  from L1D and puts it on the data list.
+ */
+Void tipc_txSend(TIpc *t, UInt8 *payload, UInt32 len);
+
+/*
+ *  ======== tipc_rxRecv ========
+ *  Consumer: the payload of the next message, invalidated in L1D, and
+ *  its length in *len; NULL if the data list is empty.
+ */
+UInt8 *tipc_rxRecv(TIpc *t, UInt32 *len);
+
+/*
+ *  ======== tipc_rxRelease ========
+ *  Consumer: puts the message at payload back on the free list.
+ */
+Void tipc_rxRelease(TIpc *t, UInt8 *payload);
+
+#endif /* TRANSPORT_IPC_H_ */
@@ -0,0 +1,205 @@
+/*
+ *  ======== transport_latency.c ========
+ *  Cross-core time base and latency histograms, see transport_latency.h.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <ti/sysbios/knl/Task.h>
+#include <ti/csl/csl_chip.h>
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_latency.h"
+#include "transport_timer.h"
+
+/* one cache line per core, so no core writes back another one's flag */
+typedef struct TLatCore {
+    volatile UInt32 ready;          /* in tlat_sync; core 0's releases */
+    UInt32          pad0;
+    volatile UInt64 base;           /* transport_timerRead at the release */
+    UInt8           pad[TSTATS_LINE - 16];
+} TLatCore;
+
+#pragma DATA_SECTION(tlatCore, ".tstats")
+#pragma DATA_ALIGN(tlatCore, TSTATS_LINE)
+static TLatCore tlatCore[TSTATS_MAX_CORES];
+
+#pragma DATA_SECTION(tlat, ".tstats")
+#pragma DATA_ALIGN(tlat, TSTATS_LINE)
+TLatHist tlat[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== msb ========
+ *  Bit number of the most significant 1 of a non-zero x.
+ */
+static inline UInt32 msb(UInt32 x)
+{
+#ifdef _TMS320C6X
+	return 31 - _lmbd(1, x);
+#else
+	return 31 - __builtin_clz(x);
+#endif
+}
+
+/*
+ *  ======== binOf ========
+ *  Values under TLAT_SUB_BINS have a bin each; above, every power of two
+ *  is split in TLAT_SUB_BINS bins.
+ */
+static UInt32 binOf(UInt64 ticks)
+{
+	UInt32 v, m;
+
+	if (ticks >> 32) {
+		return TLAT_BINS - 1;
+	}
+	v = (UInt32) ticks;
+	if (v < TLAT_SUB_BINS) {
+		return v;
+	}
+	m = msb(v);
+	return (m - TLAT_SUB_BITS + 1) * TLAT_SUB_BINS
+			+ ((v >> (m - TLAT_SUB_BITS)) & (TLAT_SUB_BINS - 1));
+}
+
+/*
+ *  ======== binTop ========
+ *  Largest value counted in bin b.
+ */
+static UInt64 binTop(UInt32 b)
+{
+	UInt32 e = b / TLAT_SUB_BINS;
+	UInt32 sub = b % TLAT_SUB_BINS;
+
+	if (e == 0) {
+		return b;
+	}
+	return ((UInt64) (TLAT_SUB_BINS + sub + 1) << (e - 1)) - 1;
+}
+
+/*
+ *  ======== waitReady ========
+ */
+static Void waitReady(UInt32 core)
+{
+	do {
+		Task_yield();
+		CACHE_invL1d((void *) &tlatCore[core], TSTATS_LINE, CACHE_WAIT);
+	} while (tlatCore[core].ready == 0);
+}
+
+/*
+ *  ======== tlat_sync ========
+ *  The other cores say they are ready, then spin on core 0's flag; core
+ *  0 sets it once it has seen all of them, and every core takes its
+ *  base as soon as it sees the flag.
+ */
+Void tlat_sync(UInt32 cores)
+{
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	TLatCore *self = &tlatCore[core_num];
+	UInt32 c;
+
+	transport_timerInit();
+
+	if (core_num == 0) {
+		for (c = 1; c < TSTATS_MAX_CORES; c++) {
+			if ((cores >> c) & 1) {
+				waitReady(c);
+			}
+		}
+		self->ready = 1;
+		CACHE_wbL1d((void *) self, TSTATS_LINE, CACHE_WAIT);
+	} else {
+		self->ready = 1;
+		CACHE_wbL1d((void *) self, TSTATS_LINE, CACHE_WAIT);
+		waitReady(0);
+	}
+
+#if TRANSPORT_TIMER_GLOBAL
+	self->base = 0;
+#else
+	self->base = transport_timerRead();
+#endif
+	CACHE_wbL1d((void *) self, TSTATS_LINE, CACHE_WAIT);
+}
+
+/*
+ *  ======== tlat_now ========
+ */
+UInt64 tlat_now(Void)
+{
+	return transport_timerRead()
+			- tlatCore[CSL_chipReadReg(CSL_CHIP_DNUM)].base;
+}
+
+/*
+ *  ======== tlat_add ========
+ *  A stamp from a core whose clock is slightly ahead can give a small
+ *  negative latency; it counts as 0.
+ */
+Void tlat_add(TLatHist *h, UInt64 ticks)
+{
+	if ((Int64) ticks < 0) {
+		ticks = 0;
+	}
+	if (h->count == 0 || ticks < h->min) {
+		h->min = ticks;
+	}
+	if (ticks > h->max) {
+		h->max = ticks;
+	}
+	h->count++;
+	h->bins[binOf(ticks)]++;
+}
+
+/*
+ *  ======== tlat_percentile ========
+ */
+UInt64 tlat_percentile(const TLatHist *h, UInt32 perMille)
+{
+	UInt32 rank, seen = 0, b;
+	UInt64 top;
+
+	if (h->count == 0) {
+		return 0;
+	}
+
+	// Rank of the sample, rounded up: p99.9 of 100 samples is the largest
+	rank = (UInt32) (((UInt64) h->count * perMille + 999) / 1000);
+	if (rank == 0) {
+		rank = 1;
+	}
+
+	for (b = 0; b < TLAT_BINS - 1; b++) {
+		seen += h->bins[b];
+		if (seen >= rank) {
+			break;
+		}
+	}
+
+	top = binTop(b);
+	return (top < h->max) ? top : h->max;
+}
+
+/*
+ *  ======== tlat_clear ========
+ */
+Void tlat_clear(TLatHist *h)
+{
+	memset((Void *) h, 0, sizeof(*h));
+}
+
+/*
+ *  ======== tlat_print ========
+ */
+Void tlat_print(const char *name, const TLatHist *h)
+{
+	double us = 1e6 / TRANSPORT_TIMER_HZ;
+
+	printf("%s: %u latencies, min %.2f p50 %.2f p99 %.2f p99.9 %.2f "
+			"max %.2f us\n", name, h->count, h->min * us,
+			tlat_percentile(h, 500) * us, tlat_percentile(h, 990) * us,
+			tlat_percentile(h, 999) * us, h->max * us);
+}
@@ -0,0 +1,104 @@
+/*
+ *  ======== transport_latency.h ========
+ *  End-to-end latency of the transport links.
+ *
+ *  The producer stamps every payload with tlat_now, the consumer takes
+ *  the difference to its own tlat_now on receipt and adds it to the
+ *  histogram of the link. tlat_now is comparable between cores: the TSCs
+ *  of all cores run from the same clock but start at different times,
+ *  so tlat_sync has the cores take a time base at one common moment and
+ *  tlat_now counts from it. The skew left is the time core 0's release
+ *  takes to reach the other cores, a few hundred cycles. Where the timer
+ *  is already global (TRANSPORT_TIMER_GLOBAL, the host build) the bases
+ *  are 0.
+ *
+ *  The histograms, tlat[producer][consumer] like tstats, are in .tstats
+ *  (MSMCSRAM) too. Their bins are 1/TLAT_SUB_BINS of a power of two wide,
+ *  so percentiles are within 12.5% (rounded up, never under the real
+ *  value).
+ */
+
+#ifndef TRANSPORT_LATENCY_H_
+#define TRANSPORT_LATENCY_H_
+
+#include <xdc/std.h>
+
+#include "transport_stats.h"
+
+/* payload bytes the stamp takes, at the start of the payload */
+#define TLAT_STAMP_SIZE     8
+
+#define TLAT_SUB_BITS       3
+#define TLAT_SUB_BINS       (1 << TLAT_SUB_BITS)
+/* up to 2^32 ticks, longer latencies count in the last bin */
+#define TLAT_BINS           ((32 - TLAT_SUB_BITS + 1) * TLAT_SUB_BINS)
+
+/* bytes of a histogram before the padding to a whole cache line */
+#define TLAT_HIST_USED      (24 + 4 * TLAT_BINS)
+
+/* whole cache lines, so no core writes back another one's histogram */
+typedef struct TLatHist {
+    UInt32          count;
+    UInt32          pad0;
+    UInt64          min;
+    UInt64          max;
+    UInt32          bins[TLAT_BINS];
+    UInt8           pad[TSTATS_LINE - TLAT_HIST_USED % TSTATS_LINE];
+} TLatHist;
+
+extern TLatHist tlat[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== tlat_sync ========
+ *  Called once by every core of the cores mask, which must include core
+ *  0: returns on all of them together, with their time bases taken.
+ */
+Void tlat_sync(UInt32 cores);
+
+/*
+ *  ======== tlat_now ========
+ *  TSC ticks since the time base of tlat_sync, the same on all cores.
+ */
+UInt64 tlat_now(Void);
+
+/*
+ *  ======== tlat_stamp / tlat_read ========
+ *  Write tlat_now into, and read it back from, the first TLAT_STAMP_SIZE
+ *  bytes of an 8-byte aligned payload.
+ */
+static inline Void tlat_stamp(UInt8 *payload)
+{
+    *(UInt64 *) payload = tlat_now();
+}
+
+static inline UInt64 tlat_read(const UInt8 *payload)
+{
+    return *(const UInt64 *) payload;
+}
+
+/*
+ *  ======== tlat_add ========
+ *  Counts one latency of ticks TSC ticks in h.
+ */
+Void tlat_add(TLatHist *h, UInt64 ticks);
+
+/*
+ *  ======== tlat_percentile ========
+ *  Latency under which perMille thousandths of the latencies in h are,
+ *  in ticks; 0 if h is empty.
+ */
+UInt64 tlat_percentile(const TLatHist *h, UInt32 perMille);
+
+/*
+ *  ======== tlat_clear ========
+ */
+Void tlat_clear(TLatHist *h);
+
+/*
+ *  ======== tlat_print ========
+ *  Prints min, p50, p99, p99.9 and max of h in microseconds, on one line
+ *  starting with name.
+ */
+Void tlat_print(const char *name, const TLatHist *h);
+
+#endif /* TRANSPORT_LATENCY_H_ */
@@ -22,6 +22,9 @@ SECTIONS
     .ppdata      >       L2SRAM
     .qmss: load >> MSMCSRAM
     .cppi: load >> MSMCSRAM
+    .tstats: load >> MSMCSRAM
+    .thost: load >> MSMCSRAM
+    .ttx: load >> MSMCSRAM
     //.fftc: load >> DDR3
     //cppiSharedHeap: load >> MSMCSRAM
 
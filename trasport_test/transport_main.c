@@ -5,6 +5,8 @@
 
 #include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/hal/Hwi.h>
 #include <ti/drv/qmss/qmss_firmware.h>
 #include <ti/drv/cppi/cppi_drv.h>
 #include <ti/drv/cppi/cppi_desc.h>
@@ -12,6 +14,14 @@
 #include <ti/csl/csl_chip.h>
 #include <ti/csl/csl_cacheAux.h>
 
+#include "transport_bench.h"
+#include "transport_credit.h"
+#include "transport_desc.h"
+#include "transport_hdesc.h"
+#include "transport_latency.h"
+#include "transport_stats.h"
+#include "transport_timer.h"
+
 /* QMSS device specific configuration */
 extern Qmss_GlobalConfigParams qmssGblCfgParams;
 extern Cppi_GlobalConfigParams cppiGblCfgParams;
@@ -19,19 +29,283 @@ extern Cppi_GlobalConfigParams cppiGblCfgParams;
 #define NUM_DESC 32
 #define SIZE_DESC 2048 /*256 bytes, esse valor ta em bits?*/
 #define MONOLITHIC_DESC_DATA_OFFSET 16
-#define DMA_PREFETCH_SIZE 32
+#define PAYLOAD_SIZE (SIZE_DESC/2)
 
-#define QUEUE_TX_OP_NUM 800
-#define QUEUE_TX_FREE_NUM 852
+/*
+ * Descriptor mode: DESC_MODE_MONO moves PAYLOAD_SIZE bytes in monolithic
+ * descriptors of SIZE_DESC bytes; DESC_MODE_HOST moves HOST_FRAME_SIZE
+ * byte frames in chains of host descriptors, each with a HOST_BUF_SIZE
+ * buffer from a pool in MSMCSRAM (.thost, see transport_linker.cmd).
+ */
+#define DESC_MODE_MONO 0
+#define DESC_MODE_HOST 1
+#ifndef DESC_MODE
+#define DESC_MODE DESC_MODE_MONO
+#endif
+
+#define HOST_FRAME_SIZE (64*1024)
+#define HOST_BUF_SIZE 4096
+#define SIZE_HOST_DESC 64
+#define NUM_HOST_TX_DESC 64
+#define NUM_HOST_RX_DESC 64
+
+/*
+ * Rx free descriptor pools of the monolithic mode, smallest first. The Rx
+ * flow takes each packet's descriptor from the smallest pool it fits in,
+ * so small messages do not tie up SIZE_DESC bytes of L2. Set the sizes
+ * and counts per deployment on the command line: sizes are multiples of
+ * 16 bytes, counts powers of two of at least 32 (QMSS memory regions) and
+ * RX_POOL2_SIZE must hold the largest packet taskA sends.
+ */
+#define RX_NUM_POOLS 3
+#ifndef RX_POOL0_SIZE
+#define RX_POOL0_SIZE 128
+#endif
+#ifndef RX_POOL0_NUM
+#define RX_POOL0_NUM 64
+#endif
+#ifndef RX_POOL1_SIZE
+#define RX_POOL1_SIZE 512
+#endif
+#ifndef RX_POOL1_NUM
+#define RX_POOL1_NUM 32
+#endif
+#ifndef RX_POOL2_SIZE
+#define RX_POOL2_SIZE SIZE_DESC
+#endif
+#ifndef RX_POOL2_NUM
+#define RX_POOL2_NUM 32
+#endif
+
+/* largest payload of a pool, in the 32-byte units of rx_size_thresh<n> */
+#define RX_POOL_THRESH(size) (((size) - MONOLITHIC_DESC_DATA_OFFSET) >> 5)
+
+#if DESC_MODE == DESC_MODE_HOST
+#define RX_DESC_TYPE Cppi_DescType_HOST
+#else
+#define RX_DESC_TYPE Cppi_DescType_MONOLITHIC
+#endif
+
+/* descriptors timed by txCompare, the fastest round of each path counts */
+#define TX_COMPARE_ROUNDS 32
+
+/* descriptors moved per queue access by taskA and taskB */
+#define TX_BATCH 8
+#define RX_BATCH 16
+
+/*
+ * taskA payload sizes: TX_MIX 0 sends PAYLOAD_SIZE bytes only, TX_MIX 1
+ * cycles through txMixSizes, which has some for every Rx pool.
+ */
+#ifndef TX_MIX
+#define TX_MIX 1
+#endif
+
+/*
+ * TX_STAMP 1 has taskA stamp the first TLAT_STAMP_SIZE bytes of every
+ * payload with its send time (transport_latency.h) and taskB report the
+ * latency percentiles of each link with its stats.
+ */
+#ifndef TX_STAMP
+#define TX_STAMP 1
+#endif
+
+/*
+ * TX_SEQ 1 has taskA number the packets of every link in the
+ * TSTATS_SEQ_SIZE bytes after the stamp and taskB count the numbers lost,
+ * duplicated and reordered (transport_stats.h).
+ */
+#ifndef TX_SEQ
+#define TX_SEQ 1
+#endif
+#define TX_SEQ_OFFSET (TX_STAMP ? TLAT_STAMP_SIZE : 0)
+#define TX_HDR_SIZE (TX_SEQ_OFFSET + (TX_SEQ ? TSTATS_SEQ_SIZE : 0))
+
+/*
+ * Task_sleep ticks between taskA bursts, on top of the flow control
+ * (TX_CREDITS); 0 sends as fast as the consumers take the packets
+ */
+#ifndef TX_PACING
+#define TX_PACING 0
+#endif
+
+/*
+ * taskB consumer: RX_CONSUME_PRINT prints every 4th payload byte,
+ * RX_CONSUME_CHECK checks the payload against the generateData pattern
+ * and only counts, in tstats (transport_stats.h), reported once a second.
+ */
+#define RX_CONSUME_PRINT 0
+#define RX_CONSUME_CHECK 1
+#ifndef RX_CONSUME
+#define RX_CONSUME RX_CONSUME_CHECK
+#endif
+
+/*
+ * taskB receive mode: RX_MODE_POLL has taskB spin on the Rx queues of its
+ * core; RX_MODE_ACC has an accumulator channel per Rx queue wake a
+ * taskBAcc through a Semaphore.
+ */
+#define RX_MODE_POLL 0
+#define RX_MODE_ACC 1
+#ifndef RX_MODE
+#define RX_MODE RX_MODE_ACC
+#endif
+
+/*
+ * Topology: TOPO_PRODUCERS and TOPO_CONSUMERS are masks of the cores that
+ * run taskA and taskB; a core may be both. With TOPO_QUEUES_DEDICATED
+ * every producer/consumer pair (a link) has its own Rx flow and Rx queue
+ * and each producer deals its bursts round robin over the consumers. With
+ * TOPO_QUEUES_SHARED every producer sends to the one Rx queue
+ * QUEUE_RX_OP_NUM and the consumers take from it as they go; in RX_MODE_ACC
+ * only the first consumer does. Producer p sends on infrastructure PKTDMA
+ * channel p; the Rx flows write p into the destination tag, which is how
+ * a consumer tells the links apart.
+ */
+#define TOPO_MAX_CORES 4
+#ifndef TOPO_PRODUCERS
+#define TOPO_PRODUCERS 0x1
+#endif
+#ifndef TOPO_CONSUMERS
+#if RX_MODE == RX_MODE_ACC
+#define TOPO_CONSUMERS 0x2
+#else
+#define TOPO_CONSUMERS 0xe
+#endif
+#endif
+
+#define TOPO_QUEUES_DEDICATED 0
+#define TOPO_QUEUES_SHARED 1
+#ifndef TOPO_QUEUES
+#define TOPO_QUEUES TOPO_QUEUES_DEDICATED
+#endif
+
+#if TOPO_PRODUCERS == 0 || TOPO_CONSUMERS == 0
+#error "the topology needs a producer and a consumer core"
+#endif
+
+#define TOPO_IS(mask, core) (((mask) >> (core)) & 1)
+#define TOPO_LINK(p, c) ((p) * TOPO_MAX_CORES + (c))
+#define TOPO_NUM_LINKS (TOPO_MAX_CORES * TOPO_MAX_CORES)
+/* Rx flow producer p uses to reach consumer c */
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+#define TOPO_FLOW(p, c) (p)
+#else
+#define TOPO_FLOW(p, c) TOPO_LINK(p, c)
+#endif
+
+/*
+ * Consumers sharing an Rx queue split each producer's sequence numbers
+ * between them, so taskB only follows them when one consumer gets all.
+ */
+/* consumers acknowledging the packets producer p sends to consumer c */
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+#define TOPO_FLOW_CONSUMERS(c) TOPO_CONSUMERS
+#define TOPO_NUM_FLOWS TOPO_COUNT(TOPO_PRODUCERS)
+#else
+#define TOPO_FLOW_CONSUMERS(c) (1 << (c))
+#define TOPO_NUM_FLOWS (TOPO_COUNT(TOPO_PRODUCERS) * TOPO_COUNT(TOPO_CONSUMERS))
+#endif
+#define TOPO_COUNT(mask) (((mask) & 1) + (((mask) >> 1) & 1) \
+		+ (((mask) >> 2) & 1) + (((mask) >> 3) & 1))
+
+/*
+ * Flow control: TX_CREDITS is how many packets a producer may have in
+ * flight on a flow, sent but not recycled by the consumer yet
+ * (transport_credit.h); 0 turns it off. The default shares the Rx
+ * descriptors between the flows so that none can run a pool dry: the
+ * smallest Rx pool in the monolithic mode, whatever sizes go into it,
+ * and the frames the Rx buffers hold in the host mode.
+ */
+#if DESC_MODE == DESC_MODE_HOST
+#define TX_CREDIT_POOL (NUM_HOST_RX_DESC \
+		/ ((HOST_FRAME_SIZE + HOST_BUF_SIZE - 1) / HOST_BUF_SIZE))
+#else
+#define TX_CREDIT_POOL (RX_POOL0_NUM < RX_POOL1_NUM \
+		? (RX_POOL0_NUM < RX_POOL2_NUM ? RX_POOL0_NUM : RX_POOL2_NUM) \
+		: (RX_POOL1_NUM < RX_POOL2_NUM ? RX_POOL1_NUM : RX_POOL2_NUM))
+#endif
+#ifndef TX_CREDITS
+#define TX_CREDITS (TX_CREDIT_POOL / TOPO_NUM_FLOWS > 0 \
+		? TX_CREDIT_POOL / TOPO_NUM_FLOWS : 1)
+#endif
+
+#if TX_SEQ && (TOPO_QUEUES == TOPO_QUEUES_DEDICATED \
+		|| RX_MODE == RX_MODE_ACC || (TOPO_CONSUMERS & (TOPO_CONSUMERS - 1)) == 0)
+#define RX_SEQ 1
+#else
+#define RX_SEQ 0
+#endif
+
+/*
+ * Accumulator pacing: taskBAcc gets a list page once it holds
+ * RX_ACC_ENTRIES descriptors or RX_ACC_PACING ticks of 25 us after the
+ * previous one, whichever comes first. Larger values mean fewer wake-ups
+ * and more latency; RX_ACC_PACING 0 wakes taskBAcc on every packet.
+ */
+#define RX_ACC_ENTRIES 16
+#define RX_ACC_PACING 40
+/*
+ * The Rx queue of link (p, c) gets high priority channel TOPO_LINK(p, c),
+ * which interrupts core c on event 48 + p (channel n: core n % 4, event
+ * 48 + n / 4), through interrupt RX_ACC_HWI + p.
+ */
+#define RX_ACC_CHANNEL(link) (link)
+#define RX_ACC_EVENT(link) (48 + (link) / TOPO_MAX_CORES)
+#define RX_ACC_HWI 11
+
+#define QUEUE_TX_OP_NUM 800 /* + producer core, the Tx queue of its channel */
+#define QUEUE_TX_FREE_NUM 852 /* + producer core in DESC_MODE_MONO */
 #define QUEUE_RX_OP_NUM 858
-#define QUEUE_RX_FREE_NUM 859
+#define QUEUE_RX_FREE_NUM 859 /* to 859 + RX_NUM_POOLS - 1 */
+#define QUEUE_RX_LINK_NUM 1000 /* + TOPO_LINK(p, c) */
 
 #define IS_MULTICORE
 
+#if DESC_MODE == DESC_MODE_HOST
+/* Tx and Rx host descriptors, and the buffers attached to them */
+#pragma DATA_ALIGN(host_region, 16)
+unsigned char host_region[(NUM_HOST_TX_DESC + NUM_HOST_RX_DESC) * SIZE_HOST_DESC];
+#pragma DATA_SECTION(host_tx_bufs, ".thost")
+#pragma DATA_ALIGN(host_tx_bufs, 128)
+unsigned char host_tx_bufs[NUM_HOST_TX_DESC * HOST_BUF_SIZE];
+#pragma DATA_SECTION(host_rx_bufs, ".thost")
+#pragma DATA_ALIGN(host_rx_bufs, 128)
+unsigned char host_rx_bufs[NUM_HOST_RX_DESC * HOST_BUF_SIZE];
+#else
+/* A Tx pool per producer core, in MSMCSRAM (.ttx) so any core can own it */
+#pragma DATA_SECTION(mono_region, ".ttx")
 #pragma DATA_ALIGN(mono_region, 16)
-unsigned char mono_region[NUM_DESC * SIZE_DESC];
+unsigned char mono_region[TOPO_MAX_CORES][NUM_DESC * SIZE_DESC];
+
+/* The Rx pools, in one block so their regions are inserted in address order */
+typedef struct RxPoolMem {
+    unsigned char pool0[RX_POOL0_NUM * RX_POOL0_SIZE];
+    unsigned char pool1[RX_POOL1_NUM * RX_POOL1_SIZE];
+    unsigned char pool2[RX_POOL2_NUM * RX_POOL2_SIZE];
+} RxPoolMem;
+
 #pragma DATA_ALIGN(mono_region2, 16)
-unsigned char mono_region2[NUM_DESC * SIZE_DESC];
+RxPoolMem mono_region2;
+
+static unsigned char * const rxPoolBase[RX_NUM_POOLS] = {
+	mono_region2.pool0, mono_region2.pool1, mono_region2.pool2
+};
+static const UInt32 rxPoolSize[RX_NUM_POOLS] = {
+	RX_POOL0_SIZE, RX_POOL1_SIZE, RX_POOL2_SIZE
+};
+static const UInt32 rxPoolNum[RX_NUM_POOLS] = {
+	RX_POOL0_NUM, RX_POOL1_NUM, RX_POOL2_NUM
+};
+Qmss_QueueHnd rxPoolQ[RX_NUM_POOLS];
+
+#if TX_MIX
+static const UInt32 txMixSizes[] = {
+	64, 96, 256, 480, PAYLOAD_SIZE, SIZE_DESC - MONOLITHIC_DESC_DATA_OFFSET
+};
+#define TX_MIX_NUM (sizeof(txMixSizes) / sizeof(txMixSizes[0]))
+#endif
+#endif
 
 
 #pragma DATA_SECTION(cppiHnd, ".cppi")
@@ -44,6 +318,75 @@ static UInt32 l2_global_address(UInt32 addr, Uint8 corenum) {
 	return (addr + (0x10000000 + (corenum * 0x1000000)));
 }
 
+/*
+ * Accumulator ping/pong lists, two pages of a count and RX_ACC_ENTRIES, and
+ * the Semaphore of the taskBAcc reading them, per link
+ */
+#pragma DATA_ALIGN(rxAccList, 16)
+Uint32 rxAccList[TOPO_NUM_LINKS][2 * (RX_ACC_ENTRIES + 1)];
+Semaphore_Handle rxAccSem[TOPO_NUM_LINKS];
+
+/* producers a taskBAcc of link hears from */
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+#define RX_ACC_PRODUCERS(link) TOPO_PRODUCERS
+#else
+#define RX_ACC_PRODUCERS(link) (1 << ((link) / TOPO_MAX_CORES))
+#endif
+
+/*
+ *  ======== topoNext ========
+ *  Next core of a topology mask after core, wrapping around.
+ */
+static UInt32 topoNext(UInt32 mask, UInt32 core)
+{
+	do {
+		core = (core + 1) % TOPO_MAX_CORES;
+	} while (!TOPO_IS(mask, core));
+	return core;
+}
+
+/*
+ *  ======== topoFirst ========
+ */
+static UInt32 topoFirst(UInt32 mask)
+{
+	return topoNext(mask, TOPO_MAX_CORES - 1);
+}
+
+#if TX_CREDITS
+/*
+ *  ======== txCredits ========
+ *  Packets producer core_num may still send on its flow to consumer,
+ *  txSent counting what it sent on each flow.
+ */
+static UInt32 txCredits(const UInt32 *txSent, UInt32 core_num,
+		UInt32 consumer)
+{
+	UInt32 inFlight = txSent[TOPO_FLOW(core_num, consumer)]
+			- tcredit_acked(core_num, TOPO_FLOW_CONSUMERS(consumer));
+
+	return (inFlight < TX_CREDITS) ? TX_CREDITS - inFlight : 0;
+}
+
+/*
+ *  ======== txWaitCredits ========
+ *  Moves *consumer on to the next consumer while the link to it has no
+ *  credits left, yielding between tries, and returns the credits of the
+ *  first link that has some.
+ */
+static UInt32 txWaitCredits(const UInt32 *txSent, UInt32 core_num,
+		UInt32 *consumer)
+{
+	UInt32 credits;
+
+	while ((credits = txCredits(txSent, core_num, *consumer)) == 0) {
+		*consumer = topoNext(TOPO_CONSUMERS, *consumer);
+		Task_yield();
+	}
+	return credits;
+}
+#endif
+
 /*Data allignment for symbol buffer*/
 #pragma DATA_ALIGN(symbol_buffer, 16)
 Uint32 symbol_buffer[SIZE_DESC/8];
@@ -57,6 +400,57 @@ void generateData(Uint32 * vect, int lenght){
 		vect[i]=(Uint32)i;
 	}
 }
+
+/* generateData for the part of a frame starting at word first */
+void generateDataAt(Uint32 * vect, int lenght, Uint32 first){
+	int i;
+	for(i=0; i<lenght; i++){
+		vect[i]=first+(Uint32)i;
+	}
+}
+
+#if DESC_MODE == DESC_MODE_MONO
+/*
+ *  ======== txCompare ========
+ *  Measures the payload bandwidth of filling a descriptor through
+ *  symbol_buffer and Cppi_setData against generating straight into the
+ *  descriptor, and prints both from the fastest of TX_COMPARE_ROUNDS
+ *  descriptors. The descriptors go back to freeq unsent.
+ */
+static void txCompare(Qmss_QueueHnd freeq)
+{
+	Cppi_Desc *desc;
+	UInt8 *payload;
+	unsigned long long t0, t, copyTime = ~0ULL, zcTime = ~0ULL;
+	double copyRate, zcRate;
+	int i;
+
+	for (i = 0; i < TX_COMPARE_ROUNDS; i++) {
+		while ((payload = tdesc_txAlloc(freeq, &desc)) == NULL) {
+		}
+
+		t0 = transport_timerRead();
+		generateData(symbol_buffer, PAYLOAD_SIZE/4);
+		Cppi_setData(Cppi_DescType_MONOLITHIC, desc, (UInt8 *) symbol_buffer,
+				PAYLOAD_SIZE);
+		t = transport_timerRead() - t0;
+		copyTime = (t < copyTime) ? t : copyTime;
+
+		t0 = transport_timerRead();
+		generateData((Uint32 *) payload, PAYLOAD_SIZE/4);
+		t = transport_timerRead() - t0;
+		zcTime = (t < zcTime) ? t : zcTime;
+
+		Qmss_queuePushDesc(freeq, desc);
+	}
+
+	copyRate = (double) PAYLOAD_SIZE / copyTime;
+	zcRate = (double) PAYLOAD_SIZE / zcTime;
+	printf("taskA: %d B payload, copy %.3f B/%s, zero-copy %.3f B/%s (x%.2f)\n",
+			PAYLOAD_SIZE, copyRate, TRANSPORT_TIMER_UNIT, zcRate,
+			TRANSPORT_TIMER_UNIT, zcRate / copyRate);
+}
+
 /*
  *
  * TaskA Tx task sends data
@@ -65,85 +459,640 @@ void generateData(Uint32 * vect, int lenght){
 void taskA(UArg a0, UArg a1) {
 	Qmss_QueueHnd opq = (Qmss_QueueHnd) a0;
 	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
-	Cppi_Desc *desc;
-	Cppi_DescTag tag;
+	Cppi_Desc *descs[TX_BATCH];
+	UInt32 n, i, len, size, maxSize, flow, max, mix = 0;
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	UInt32 consumer = topoFirst(TOPO_CONSUMERS);
+#if TX_SEQ || TX_CREDITS
+	UInt32 txSent[TOPO_NUM_LINKS] = { 0 };
+#endif
 	Qmss_Queue queInfo;
 
-
+	// Descriptors are recycled to the queue they came from:
 	queInfo = Qmss_getQueueNumber(freeq);
 
-
-
-	do {
-	// Wait for a free descriptor
-	while ((desc = Qmss_queuePop(freeq)) == NULL) {
+	transport_timerInit();
+	if (core_num == topoFirst(TOPO_PRODUCERS)) {
+		txCompare(freeq);
+		tbench_batch(freeq, SIZE_DESC);
 	}
 
-	// Re-align descriptor address:
-	desc = (Cppi_Desc *) ((UInt32) desc & ~0xf);
-	// Generate time domain random symbol:
-	//randomRealSymbol(symbol_buffer, SIZE_DESC / 8);
-	generateData(symbol_buffer, SIZE_DESC/8);
+	do {
+	max = TX_BATCH;
+#if TX_CREDITS
+	// A consumer with credits left on its link, no more than them
+	max = txWaitCredits(txSent, core_num, &consumer);
+	max = (max < TX_BATCH) ? max : TX_BATCH;
+#endif
 
-	// Cppi_setData - Copy data buffer to descriptor:
-	Cppi_setData(Cppi_DescType_MONOLITHIC, desc, (UInt8 *) symbol_buffer,
-			SIZE_DESC/2);
+	// Wait for free descriptors, up to max at a time
+	while ((n = tdesc_popBatch(freeq, descs, max, 0)) == 0) {
+		Task_yield();
+	}
 
-	// Set tag in descriptor:
-	tag.destTagLo = 0;
-	tag.destTagHi = 0;
-	tag.srcTagLo = 0; /* Flow 0, the only one we created */
-	tag.srcTagHi = 0;
+	// The flow of the link to this burst's consumer:
+	flow = TOPO_FLOW(core_num, consumer);
+	maxSize = 0;
+	for (i = 0; i < n; i++) {
+#if TX_MIX
+		len = txMixSizes[mix];
+		mix = (mix + 1 == TX_MIX_NUM) ? 0 : mix + 1;
+#else
+		len = PAYLOAD_SIZE;
+#endif
+		// Generate the symbol in place, no intermediate buffer:
+		//randomRealSymbol((Uint32 *) tdesc_payload(descs[i]), len / 4);
+		generateData((Uint32 *) tdesc_payload(descs[i]), len/4);
+#if TX_SEQ
+		tstats_seqStamp(tdesc_payload(descs[i]) + TX_SEQ_OFFSET,
+				txSent[flow] + i);
+#endif
 
-	Cppi_setTag(Cppi_DescType_MONOLITHIC, desc, &tag);
+		size = tdesc_txSetup(descs[i], len, flow, queInfo);
+		maxSize = (size > maxSize) ? size : maxSize;
+	}
 
-	// Define where to recycle descriptor:
-	Cppi_setReturnQueue(Cppi_DescType_MONOLITHIC, desc, queInfo);
+#if TX_STAMP
+	// Stamp the burst last, right before it goes:
+	for (i = 0; i < n; i++) {
+		tlat_stamp(tdesc_payload(descs[i]));
+	}
+#endif
 
-	// Push descriptor to Tx operational queue:
-	Qmss_queuePushDescSize(opq, desc, DMA_PREFETCH_SIZE);
+	// Push the burst to the Tx operational queue, written back from
+	// L1D first: unlike L2, MSMCSRAM is not kept coherent with the PKTDMA
+	tdesc_pushBatch(opq, descs, n, maxSize, maxSize);
+#if TX_SEQ || TX_CREDITS
+	txSent[flow] += n;
+#endif
+	consumer = topoNext(TOPO_CONSUMERS, consumer);
 
-	Task_sleep(100);
+	if (TX_PACING > 0)
+		Task_sleep(TX_PACING);
 
 	} while (1);
 
 	//return;
 }
+#else
 /*
  *
- * TaskB RX task receives data and print
+ * TaskAHost Tx task sends HOST_FRAME_SIZE frames in host descriptor chains
  *
  */
-void taskB(UArg a0, UArg a1) {
+void taskAHost(UArg a0, UArg a1) {
 	Qmss_QueueHnd opq = (Qmss_QueueHnd) a0;
 	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
-	Cppi_Desc *desc = NULL;
+	Cppi_Desc *sop, *d;
+	UInt8 *buf;
+	UInt32 n, len, word, flow, max;
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	UInt32 consumer = topoFirst(TOPO_CONSUMERS);
+#if TX_SEQ || TX_CREDITS
+	UInt32 txSent[TOPO_NUM_LINKS] = { 0 };
+#endif
+
+	transport_timerInit();
+	if (core_num == topoFirst(TOPO_PRODUCERS))
+		tbench_batch(freeq, THDESC_HEADER_SIZE);
+
+	do {
+	max = TX_BATCH;
+#if TX_CREDITS
+	// A consumer with credits left on its link, no more frames than them
+	max = txWaitCredits(txSent, core_num, &consumer);
+	max = (max < TX_BATCH) ? max : TX_BATCH;
+#endif
+
+	// Wait for buffers for one frame, then send up to max
+	while ((sop = thdesc_txAlloc(freeq, HOST_FRAME_SIZE)) == NULL) {
+		Task_yield();
+	}
+
+	// The flow of the link to this burst's consumer:
+	flow = TOPO_FLOW(core_num, consumer);
+	n = 0;
+	do {
+		// Generate the frame in place, buffer after buffer:
+		word = 0;
+		for (d = sop; d != NULL; d = Cppi_getNextBD(Cppi_DescType_HOST, d)) {
+			Cppi_getData(Cppi_DescType_HOST, d, &buf, &len);
+			generateDataAt((Uint32 *) buf, len/4, word);
+			word += len/4;
+		}
+		// and its header, in the first buffer:
+		Cppi_getData(Cppi_DescType_HOST, sop, &buf, &len);
+#if TX_SEQ
+		tstats_seqStamp(buf + TX_SEQ_OFFSET, txSent[flow] + n);
+#endif
+#if TX_STAMP
+		tlat_stamp(buf);
+#endif
+
+		thdesc_txSend(opq, sop, flow);
+	} while (++n < max
+			&& (sop = thdesc_txAlloc(freeq, HOST_FRAME_SIZE)) != NULL);
+#if TX_SEQ || TX_CREDITS
+	txSent[flow] += n;
+#endif
+	consumer = topoNext(TOPO_CONSUMERS, consumer);
+
+	if (TX_PACING > 0)
+		Task_sleep(TX_PACING);
+
+	} while (1);
+}
+#endif
+
+/*
+ *  ======== rxConsume ========
+ *  Checks or prints the payload of a received descriptor, or of every
+ *  buffer of a received host descriptor chain. With TX_STAMP its latency
+ *  goes to the histogram of the link and with RX_SEQ its sequence number
+ *  to the link stats; the header is not checked against the pattern.
+ */
+static void rxConsume(Cppi_Desc *desc, TStats *stats)
+{
 	UInt8 * descBuffer;
-	UInt32 destLen;
+	UInt32 destLen, total = 0, bad = 0, skip = 0;
+#if RX_CONSUME == RX_CONSUME_PRINT
 	int i;
 	UInt32 sample;
+#endif
 
 	do {
-	while ((desc = Qmss_queuePop(opq)) == NULL) {
-	}
-
+#if DESC_MODE == DESC_MODE_HOST
+	// Retrieve payload from the buffers of host descriptors:
+	thdesc_getData(desc, &descBuffer, &destLen);
+#else
 	// Retrieve payload from monolithic descriptors:
 	Cppi_getData(Cppi_DescType_MONOLITHIC, desc, &descBuffer, &destLen);
-	
+#endif
+
+#if TX_HDR_SIZE > 0
+	if (total == 0) {
+#if TX_STAMP
+		tlat_add(&tlat[stats->producer][stats->core],
+				tlat_now() - tlat_read(descBuffer));
+#endif
+#if RX_SEQ
+		bad += tstats_seq(stats, descBuffer + TX_SEQ_OFFSET);
+#endif
+		skip = TX_HDR_SIZE;
+	} else {
+		skip = 0;
+	}
+#endif
+
+#if RX_CONSUME == RX_CONSUME_CHECK
+	bad += tstats_checkPayloadAt(descBuffer + skip, destLen - skip,
+			(total + skip)/4);
+#else
 	for (i = 0; i < destLen; i = i + 4) {
 		sample =(Uint32) descBuffer[i];
 				//(descBuffer[i]) | (descBuffer[i + 1] << 8)
 				//| (descBuffer[i + 2] << 16) | (descBuffer[i + 3] << 24);
 		printf("%x\n", sample);
 	}
+#endif
+	total += destLen;
+
+#if DESC_MODE == DESC_MODE_HOST
+	desc = thdesc_next(desc);
+#else
+	desc = NULL;
+#endif
+	} while (desc != NULL);
+
+#if RX_CONSUME == RX_CONSUME_CHECK
+	tstats_count(stats, total, bad);
+#else
 	printf("%d", sample);
-	// Recycle descriptor:
-	Qmss_queuePushDesc(freeq, desc);
+#endif
+}
+
+#if DESC_MODE == DESC_MODE_MONO
+/*
+ *  ======== rxPoolOf ========
+ *  Rx pool of a received descriptor. Compares L2 offsets, which are the
+ *  same for the local and the global address of the descriptor.
+ */
+static UInt32 rxPoolOf(Cppi_Desc *desc)
+{
+	UInt32 off = (UInt32) desc & 0x00ffffff;
+	UInt32 p;
+
+	for (p = RX_NUM_POOLS - 1; p > 0; p--) {
+		if (off >= ((UInt32) rxPoolBase[p] & 0x00ffffff))
+			break;
+	}
+	return p;
+}
+#endif
+
+/*
+ *  ======== rxInvBatch ========
+ *  Drops stale lines of n received descriptors from L1D before taskB
+ *  reads them: the header of a host descriptor, a whole monolithic
+ *  descriptor of its pool's size.
+ */
+static void rxInvBatch(Cppi_Desc **descs, UInt32 n)
+{
+#if DESC_MODE == DESC_MODE_HOST
+	tdesc_invBatch(descs, n, THDESC_HEADER_SIZE);
+#else
+	UInt32 d;
+
+	for (d = 0; d < n; d++) {
+		CACHE_invL1d((void *) descs[d], rxPoolSize[rxPoolOf(descs[d])],
+				(d + 1 == n) ? CACHE_FENCE_WAIT : CACHE_NOWAIT);
+	}
+#endif
+}
+
+/*
+ *  ======== rxProducer ========
+ *  Producer of a received descriptor, which its Rx flow wrote into the
+ *  destination tag.
+ */
+static UInt32 rxProducer(Cppi_Desc *desc)
+{
+	Cppi_DescTag tag = Cppi_getTag(RX_DESC_TYPE, desc);
+
+	return tag.destTagLo % TOPO_MAX_CORES;
+}
+
+/*
+ *  ======== rxRecycle ========
+ *  Gives n received packets back to the Rx free queue, in the monolithic
+ *  mode to the queue of the pool each descriptor came from, then
+ *  acknowledges them to their producers.
+ */
+static void rxRecycle(Qmss_QueueHnd freeq, Cppi_Desc **descs, UInt32 n,
+		UInt32 core_num)
+{
+	UInt32 d;
+#if TX_CREDITS
+	UInt32 acks[TOPO_MAX_CORES] = { 0 };
+	UInt32 p;
+#endif
+
+	for (d = 0; d < n; d++) {
+#if TX_CREDITS
+		acks[rxProducer(descs[d])]++;
+#endif
+#if DESC_MODE == DESC_MODE_HOST
+		thdesc_recycle(freeq, descs[d]);
+#else
+		Qmss_queuePushDesc(rxPoolQ[rxPoolOf(descs[d])], descs[d]);
+#endif
+	}
+
+#if TX_CREDITS
+	for (p = 0; p < TOPO_MAX_CORES; p++) {
+		if (acks[p] != 0)
+			tcredit_ack(p, core_num, acks[p]);
+	}
+#endif
+}
+
+/*
+ *  ======== rxLinkStats ========
+ *  Stats block of the link a received descriptor came over.
+ */
+static TStats *rxLinkStats(Cppi_Desc *desc, UInt32 core_num)
+{
+	return &tstats[rxProducer(desc)][core_num];
+}
+
+/*
+ *  ======== rxPublish ========
+ *  Publishes the counters of the links from producers to the calling
+ *  consumer after a burst and prints them about once a second.
+ */
+static void rxPublish(UInt32 producers, UInt32 core_num, UInt64 *nextReport)
+{
+	UInt64 now = transport_timerRead();
+	TStats *stats;
+	double rate;
+	UInt32 p;
+#if TX_STAMP
+	char name[16];
+#endif
+
+	for (p = 0; p < TOPO_MAX_CORES; p++) {
+		if (!TOPO_IS(producers, p))
+			continue;
+		tstats_publish(&tstats[p][core_num]);
+#if TX_STAMP
+		CACHE_wbL1d((void *) &tlat[p][core_num], sizeof(TLatHist),
+				CACHE_WAIT);
+#endif
+	}
+
+#if RX_CONSUME == RX_CONSUME_CHECK
+	// First burst: start the one second report period
+	if (*nextReport == 0)
+		*nextReport = now + (UInt64) TRANSPORT_TIMER_HZ;
+	if (now < *nextReport)
+		return;
+	*nextReport = now + (UInt64) TRANSPORT_TIMER_HZ;
+
+	for (p = 0; p < TOPO_MAX_CORES; p++) {
+		stats = &tstats[p][core_num];
+		if (!TOPO_IS(producers, p) || stats->packets == 0)
+			continue;
+
+		rate = (stats->last > stats->first) ? stats->bytes * TRANSPORT_TIMER_HZ
+				/ (stats->last - stats->first) / 1e6 : 0.0;
+		printf("Link %d->%d: %u packets, %llu bytes, %u errors (%u words), "
+				"%.2f MB/s\n", stats->producer, stats->core, stats->packets,
+				(unsigned long long) stats->bytes, stats->errors,
+				stats->badWords, rate);
+#if RX_SEQ
+		printf("Seq %d->%d: %u lost, %u duplicated, %u reordered\n",
+				stats->producer, stats->core, stats->lost, stats->dups,
+				stats->reorders);
+#endif
+#if TX_STAMP
+		snprintf(name, sizeof(name), "Latency %d->%d", p, core_num);
+		tlat_print(name, &tlat[p][core_num]);
+#endif
+	}
+#endif
+}
+
+/*
+ *  ======== rxStats ========
+ *  Clears the stats blocks of the links from producers to the calling
+ *  core.
+ */
+static void rxStats(UInt32 producers)
+{
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	TStats *stats;
+	UInt32 p;
+
+	for (p = 0; p < TOPO_MAX_CORES; p++) {
+		if (!TOPO_IS(producers, p))
+			continue;
+		stats = &tstats[p][core_num];
+		memset((Void *) stats, 0, sizeof(*stats));
+		stats->core = core_num;
+		stats->producer = p;
+		tstats_publish(stats);
+		tlat_clear(&tlat[p][core_num]);
+	}
+	transport_timerInit();
+}
+
+/*
+ *  ======== rxQueue ========
+ *  Opens the Rx queue of link (p, c): its own one, or QUEUE_RX_OP_NUM
+ *  when the links share it.
+ */
+static Qmss_QueueHnd rxQueue(UInt32 p, UInt32 c)
+{
+	UInt8 is_allocated;
+
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+	return Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QUEUE_RX_OP_NUM, &is_allocated);
+#else
+	return Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QUEUE_RX_LINK_NUM + TOPO_LINK(p, c), &is_allocated);
+#endif
+}
+
+/*
+ *
+ * TaskB RX task receives data and print, polling the Rx queues of
+ * the calling core's links in turn
+ *
+ */
+void taskB(UArg a0, UArg a1) {
+	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
+	Qmss_QueueHnd rxq[TOPO_MAX_CORES];
+	Cppi_Desc *descs[RX_BATCH];
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	UInt32 n, d, q = 0, nq = 0;
+	UInt64 nextReport = 0;
+
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+	rxq[nq++] = rxQueue(0, core_num);
+#else
+	for (d = 0; d < TOPO_MAX_CORES; d++) {
+		if (TOPO_IS(TOPO_PRODUCERS, d))
+			rxq[nq++] = rxQueue(d, core_num);
+	}
+#endif
+	rxStats(TOPO_PRODUCERS);
+
+	do {
+	// Wait for received descriptors, invalidated in L1D as a burst
+	while ((n = tdesc_popBatch(rxq[q], descs, RX_BATCH, 0)) == 0) {
+		q = (q + 1 == nq) ? 0 : q + 1;
+		if (q == 0)
+			Task_yield();
+	}
+	rxInvBatch(descs, n);
+
+	for (d = 0; d < n; d++) {
+		rxConsume(descs[d], rxLinkStats(descs[d], core_num));
+	}
+
+	// Recycle descriptors:
+	rxRecycle(freeq, descs, n, core_num);
+	rxPublish(TOPO_PRODUCERS, core_num, &nextReport);
+	q = (q + 1 == nq) ? 0 : q + 1;
 
 	} while (1);
 
 	//return;
 }
+
+#if RX_MODE == RX_MODE_ACC
+/*
+ *  ======== rxAccIsr ========
+ *  Accumulator interrupt: a list page of link arg is ready, wake its
+ *  taskBAcc.
+ */
+void rxAccIsr(UArg arg) {
+	Semaphore_post(rxAccSem[arg]);
+}
+
+/*
+ *  ======== rxAccInit ========
+ *  Hooks rxAccIsr to the accumulator event of link and programs the
+ *  link's accumulator channel to watch opq.
+ */
+static int rxAccInit(UInt32 link, Qmss_QueueHnd opq, UInt32 core_num) {
+	Hwi_Params hwiParams;
+	Qmss_AccCmdCfg accCfg;
+	Qmss_Queue queInfo;
+	Qmss_Result result;
+
+	rxAccSem[link] = Semaphore_create(0, NULL, NULL);
+	if (rxAccSem[link] == NULL) {
+		printf("Error creating the Rx semaphore\n");
+		return -1;
+	}
+
+	Hwi_Params_init(&hwiParams);
+	hwiParams.eventId = RX_ACC_EVENT(link);
+	hwiParams.arg = link;
+	if (Hwi_create(RX_ACC_HWI + link / TOPO_MAX_CORES, rxAccIsr, &hwiParams,
+			NULL) == NULL) {
+		printf("Error creating the accumulator Hwi\n");
+		return -1;
+	}
+
+	memset((Void *) rxAccList[link], 0, sizeof(rxAccList[link]));
+	memset((Void *) &accCfg, 0, sizeof(accCfg));
+
+	queInfo = Qmss_getQueueNumber(opq);
+	accCfg.channel = RX_ACC_CHANNEL(link);
+	accCfg.command = Qmss_AccCmd_ENABLE_CHANNEL;
+	accCfg.queueEnMask = 0;
+	accCfg.listAddress = l2_global_address((UInt32) rxAccList[link],
+			core_num);
+	accCfg.queMgrIndex = queInfo.qNum;
+	accCfg.maxPageEntries = RX_ACC_ENTRIES + 1;
+	accCfg.timerLoadCount = RX_ACC_PACING;
+	accCfg.interruptPacingMode = RX_ACC_PACING ?
+			Qmss_AccPacingMode_LAST_INTERRUPT : Qmss_AccPacingMode_NONE;
+	accCfg.listEntrySize = Qmss_AccEntrySize_REG_D;
+	accCfg.listCountMode = Qmss_AccCountMode_ENTRY_COUNT;
+	accCfg.multiQueueMode = Qmss_AccQueueMode_SINGLE_QUEUE;
+
+	result = Qmss_programAccumulator(Qmss_PdspId_PDSP1, &accCfg);
+	if (result != QMSS_ACC_SOK) {
+		printf("Error programming accumulator channel %d: %d\n",
+				RX_ACC_CHANNEL(link), result);
+		return -1;
+	}
+
+	printf("Accumulator channel %d on queue %d, %d entries, pacing %d\n",
+			RX_ACC_CHANNEL(link), queInfo.qNum, RX_ACC_ENTRIES,
+			RX_ACC_PACING);
+	return 0;
+}
+
+/*
+ *
+ * TaskBAcc RX task of link a0, sleeps until the accumulator hands over a
+ * list page
+ *
+ */
+void taskBAcc(UArg a0, UArg a1) {
+	UInt32 link = (UInt32) a0;
+	Qmss_QueueHnd freeq = (Qmss_QueueHnd) a1;
+	Cppi_Desc *descs[RX_ACC_ENTRIES];
+	Uint32 *page;
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	UInt32 n, d, pageNum = 0;
+	UInt64 nextReport = 0;
+
+	rxStats(RX_ACC_PRODUCERS(link));
+
+	do {
+	Semaphore_pend(rxAccSem[link], BIOS_WAIT_FOREVER);
+
+	// Take the descriptors off the page, then give it back:
+	page = &rxAccList[link][pageNum * (RX_ACC_ENTRIES + 1)];
+	CACHE_invL1d((void *) page, (RX_ACC_ENTRIES + 1) * 4, CACHE_WAIT);
+	n = page[0];
+	for (d = 0; d < n; d++) {
+		descs[d] = (Cppi_Desc *) (page[d + 1] & ~0xf);
+	}
+	pageNum ^= 1;
+
+	Qmss_ackInterrupt(RX_ACC_CHANNEL(link), 1);
+	Qmss_setEoiVector(Qmss_IntdInterruptType_HIGH, RX_ACC_CHANNEL(link));
+
+	rxInvBatch(descs, n);
+	for (d = 0; d < n; d++) {
+		rxConsume(descs[d], rxLinkStats(descs[d], core_num));
+	}
+
+	// Recycle descriptors:
+	rxRecycle(freeq, descs, n, core_num);
+	rxPublish(RX_ACC_PRODUCERS(link), core_num, &nextReport);
+
+	} while (1);
+}
+#endif
+
+/*
+ *  ======== rxFlowOpen ========
+ *  Configures Rx flow flowId to deliver into destq from the Rx free
+ *  queue(s), writing producer into the destination tag of every packet.
+ */
+static Cppi_FlowHnd rxFlowOpen(Cppi_Handle hnd, Int16 flowId,
+		Qmss_QueueHnd destq, Qmss_QueueHnd freeq, UInt32 producer)
+{
+	Cppi_RxFlowCfg rxFlowCfg;
+	Qmss_Queue queInfo;
+	Cppi_FlowHnd rxFlowHnd;
+	unsigned char is_allocated;
+
+	memset((Void *) &rxFlowCfg, 0, sizeof(Cppi_RxFlowCfg));
+
+	/* The 'deliver' part (where new information goes) */
+	queInfo = Qmss_getQueueNumber(destq);
+	rxFlowCfg.flowIdNum = flowId;
+	rxFlowCfg.rx_dest_qnum = queInfo.qNum;
+	rxFlowCfg.rx_dest_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_dest_tag_lo_sel = 1;
+	rxFlowCfg.rx_dest_tag_lo = producer;
+	/* Wait for free descriptors, the consumers of all links share them */
+	rxFlowCfg.rx_error_handling = 1;
+#if DESC_MODE == DESC_MODE_HOST
+	rxFlowCfg.rx_sop_offset = 0;
+	rxFlowCfg.rx_desc_type = Cppi_DescType_HOST;
+#else
+	rxFlowCfg.rx_sop_offset = MONOLITHIC_DESC_DATA_OFFSET;
+	rxFlowCfg.rx_desc_type = Cppi_DescType_MONOLITHIC;
+#endif
+	/* The 'receive' part (where the free descriptors are) */
+	queInfo = Qmss_getQueueNumber(freeq);
+	rxFlowCfg.rx_fdq0_sz0_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq0_sz0_qmgr = queInfo.qMgr;
+#if DESC_MODE == DESC_MODE_MONO
+	/* Packets too large for a pool go on to the next one */
+	rxFlowCfg.rx_size_thresh0_en = 1;
+	rxFlowCfg.rx_size_thresh0 = RX_POOL_THRESH(RX_POOL0_SIZE);
+	queInfo = Qmss_getQueueNumber(rxPoolQ[1]);
+	rxFlowCfg.rx_fdq0_sz1_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq0_sz1_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_size_thresh1_en = 1;
+	rxFlowCfg.rx_size_thresh1 = RX_POOL_THRESH(RX_POOL1_SIZE);
+	queInfo = Qmss_getQueueNumber(rxPoolQ[2]);
+	rxFlowCfg.rx_fdq0_sz2_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq0_sz2_qmgr = queInfo.qMgr;
+#else
+	/* The second and later buffers of a frame, same pool */
+	rxFlowCfg.rx_fdq1_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq1_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_fdq2_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq2_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_fdq3_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq3_qmgr = queInfo.qMgr;
+#endif
+
+	rxFlowHnd = (Cppi_FlowHnd) Cppi_configureRxFlow(hnd, &rxFlowCfg,
+			&is_allocated);
+	if (rxFlowHnd == NULL) {
+		printf("Error: Opening Rx flow : %d\n", flowId);
+		return NULL;
+	}
+
+	queInfo = Qmss_getQueueNumber(destq);
+	printf("Opened Rx flow : %d, producer %d to queue %d\n",
+			Cppi_getFlowId(rxFlowHnd), producer, queInfo.qNum);
+	return rxFlowHnd;
+}
+
 /*
  *
  * Master Task
@@ -162,8 +1111,13 @@ void master_task() {
 	Cppi_DescCfg cppi_cfg;
 	unsigned int num_allocated;
 	unsigned char is_allocated;
+	Cppi_Handle hnd;
+	int p;
+#if TOPO_QUEUES == TOPO_QUEUES_DEDICATED || RX_MODE == RX_MODE_ACC
+	int c;
+#endif
 
-	Qmss_QueueHnd q_tx_op, q_rx_op, q_tx_free, q_rx_free;
+	Qmss_QueueHnd q_tx_op, q_tx_free, q_rx_free;
 
 
 
@@ -171,10 +1125,21 @@ void master_task() {
 		/* ---------------------------- Initialization of QMSS ------------------------- */
 		memset(&qmssInitConfig, 0, sizeof(Qmss_InitCfg));
 
-		qmssInitConfig.maxDescNum = NUM_DESC;
+#if DESC_MODE == DESC_MODE_HOST
+		qmssInitConfig.maxDescNum = NUM_HOST_TX_DESC + NUM_HOST_RX_DESC;
+#else
+		qmssInitConfig.maxDescNum = TOPO_MAX_CORES * NUM_DESC;
 #ifdef  IS_MULTICORE
 		/* add more descriptors for TRX's mmory region */
-		qmssInitConfig.maxDescNum += NUM_DESC;
+		qmssInitConfig.maxDescNum += RX_POOL0_NUM + RX_POOL1_NUM
+				+ RX_POOL2_NUM;
+#endif
+#endif
+#if RX_MODE == RX_MODE_ACC
+		/* The accumulator runs on PDSP1 */
+		qmssInitConfig.pdspFirmware[0].pdspId = Qmss_PdspId_PDSP1;
+		qmssInitConfig.pdspFirmware[0].firmware = (void *) &acc48_le;
+		qmssInitConfig.pdspFirmware[0].size = sizeof(acc48_le);
 #endif
 
 		/* Initialize Queue Manager Sub System */
@@ -191,63 +1156,129 @@ void master_task() {
 			return;
 		}
 
-		/* Populate the mem_reg struct so that QMSS becomes
-		 * aware of this 'memory region', i.e. a place in
-		 * memory that will eventually hold descriptors
+#if DESC_MODE == DESC_MODE_HOST
+		/* One region for the host descriptors of both sides, in
+		 * core 0's L2; their buffers are in MSMCSRAM.
 		 */
 		mem_reg.descBase = (unsigned int *) l2_global_address(
-				(UInt32) mono_region, 0);
-		mem_reg.descSize = SIZE_DESC;
-		mem_reg.descNum = NUM_DESC;
+				(UInt32) host_region, 0);
+		mem_reg.descSize = SIZE_HOST_DESC;
+		mem_reg.descNum = NUM_HOST_TX_DESC + NUM_HOST_RX_DESC;
 		mem_reg.manageDescFlag = Qmss_ManageDesc_MANAGE_DESCRIPTOR;
 		mem_reg.memRegion = Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED;
 		mem_reg.startIndex = 0;
 
 		ret = Qmss_insertMemoryRegion(&mem_reg);
-		/* if ret is positive (or zero), then insertMemoryRegion has worked */
+		if (ret < 0) {
+			printf("Error inserting the host descriptor memory.\n");
+			return;
+		}
 
-		/* Populate the cppi_cfg struct so that Cppi_initDescriptor
-		 * can 'format' the memory region, thus actually creating the
-		 * descriptors.
-		 * Finally, it will put all the descriptors in destQueueNum.
+		/* Tx descriptors return one by one to the Tx free queue,
+		 * whatever the length of the chain they were sent in.
 		 */
+		memset(&cppi_cfg, 0, sizeof(cppi_cfg));
 		cppi_cfg.memRegion = (Qmss_MemRegion) ret;
-		cppi_cfg.descNum = NUM_DESC;
+		cppi_cfg.descNum = NUM_HOST_TX_DESC;
 		cppi_cfg.destQueueNum = QUEUE_TX_FREE_NUM;
 		cppi_cfg.queueType = Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
 		cppi_cfg.initDesc = Cppi_InitDesc_INIT_DESCRIPTOR;
-		cppi_cfg.descType = Cppi_DescType_MONOLITHIC;
-		cppi_cfg.cfg.mono.dataOffset = MONOLITHIC_DESC_DATA_OFFSET;
+		cppi_cfg.descType = Cppi_DescType_HOST;
+		cppi_cfg.returnQueue.qMgr = QMSS_PARAM_NOT_SPECIFIED;
+		cppi_cfg.returnQueue.qNum = QMSS_PARAM_NOT_SPECIFIED;
+		cppi_cfg.epibPresent = Cppi_EPIB_NO_EPIB_PRESENT;
+		cppi_cfg.cfg.host.returnPolicy = Cppi_ReturnPolicy_RETURN_BUFFER;
+		cppi_cfg.cfg.host.psLocation = Cppi_PSLoc_PS_IN_DESC;
 		q_tx_free = Cppi_initDescriptor(&cppi_cfg,
 				&num_allocated);
 
-#ifdef  IS_MULTICORE
-		/* Do the same for the analogous array in core 1's L2 */
-		mem_reg.descBase = (unsigned int *) l2_global_address(
-			(UInt32) mono_region2, 1);
+		cppi_cfg.descNum = NUM_HOST_RX_DESC;
+		cppi_cfg.destQueueNum = QUEUE_RX_FREE_NUM;
+		q_rx_free = Cppi_initDescriptor(&cppi_cfg,
+				&num_allocated);
+
+		/* Give every descriptor its buffer */
+		if (thdesc_attach(q_tx_free, host_tx_bufs, HOST_BUF_SIZE,
+				NUM_HOST_TX_DESC) != NUM_HOST_TX_DESC
+				|| thdesc_attach(q_rx_free, host_rx_bufs, HOST_BUF_SIZE,
+				NUM_HOST_RX_DESC) != NUM_HOST_RX_DESC) {
+			printf("Error attaching the host buffers.\n");
+			return;
+		}
+#else
+		/* Populate the mem_reg struct so that QMSS becomes
+		 * aware of this 'memory region', i.e. a place in
+		 * memory that will eventually hold descriptors: the Tx
+		 * pools of all producers, in MSMCSRAM
+		 */
+		mem_reg.descBase = (unsigned int *) mono_region;
 		mem_reg.descSize = SIZE_DESC;
-		mem_reg.descNum = NUM_DESC;
+		mem_reg.descNum = TOPO_MAX_CORES * NUM_DESC;
 		mem_reg.manageDescFlag = Qmss_ManageDesc_MANAGE_DESCRIPTOR;
 		mem_reg.memRegion = Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED;
 		mem_reg.startIndex = 0;
 
 		ret = Qmss_insertMemoryRegion(&mem_reg);
 		if (ret < 0) {
-			printf("Error inserting second memory.\n");
+			printf("Error inserting the Tx descriptor memory: %d\n", ret);
 			return;
 		}
 
-		/* Now call Cppi_initDescriptor */
+		/* Populate the cppi_cfg struct so that Cppi_initDescriptor
+		 * can 'format' the memory region, thus actually creating the
+		 * descriptors.
+		 * Each call puts NUM_DESC of them in the Tx FDQ of one core.
+		 */
 		cppi_cfg.memRegion = (Qmss_MemRegion) ret;
 		cppi_cfg.descNum = NUM_DESC;
-		cppi_cfg.destQueueNum = QUEUE_RX_FREE_NUM;
 		cppi_cfg.queueType = Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
 		cppi_cfg.initDesc = Cppi_InitDesc_INIT_DESCRIPTOR;
 		cppi_cfg.descType = Cppi_DescType_MONOLITHIC;
 		cppi_cfg.cfg.mono.dataOffset = MONOLITHIC_DESC_DATA_OFFSET;
-		q_rx_free = Cppi_initDescriptor(&cppi_cfg,
-				&num_allocated);
+		for (p = 0; p < TOPO_MAX_CORES; p++) {
+			cppi_cfg.destQueueNum = QUEUE_TX_FREE_NUM + p;
+			Cppi_initDescriptor(&cppi_cfg, &num_allocated);
+		}
+
+#ifdef  IS_MULTICORE
+		/* Then the Rx pools in core 1's L2, one memory
+		 * region and one free queue per descriptor size.
+		 */
+		for (p = 0; p < RX_NUM_POOLS; p++) {
+			mem_reg.descBase = (unsigned int *) l2_global_address(
+				(UInt32) rxPoolBase[p], 1);
+			mem_reg.descSize = rxPoolSize[p];
+			mem_reg.descNum = rxPoolNum[p];
+			mem_reg.manageDescFlag = Qmss_ManageDesc_MANAGE_DESCRIPTOR;
+			mem_reg.memRegion = Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED;
+			mem_reg.startIndex = 0;
+
+			ret = Qmss_insertMemoryRegion(&mem_reg);
+			if (ret < 0) {
+				printf("Error inserting Rx pool %d memory: %d\n", p, ret);
+				return;
+			}
+
+			/* Now call Cppi_initDescriptor */
+			cppi_cfg.memRegion = (Qmss_MemRegion) ret;
+			cppi_cfg.descNum = rxPoolNum[p];
+			cppi_cfg.destQueueNum = QUEUE_RX_FREE_NUM + p;
+			cppi_cfg.queueType = Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
+			cppi_cfg.initDesc = Cppi_InitDesc_INIT_DESCRIPTOR;
+			cppi_cfg.descType = Cppi_DescType_MONOLITHIC;
+			cppi_cfg.cfg.mono.dataOffset = MONOLITHIC_DESC_DATA_OFFSET;
+			rxPoolQ[p] = Cppi_initDescriptor(&cppi_cfg,
+					&num_allocated);
+
+			printf("Rx pool %d: %d x %d B descriptors, packets up to %d B\n",
+					p, rxPoolNum[p], rxPoolSize[p],
+					(p + 1 < RX_NUM_POOLS) ? RX_POOL_THRESH(rxPoolSize[p]) << 5
+							: rxPoolSize[p] - MONOLITHIC_DESC_DATA_OFFSET);
+		}
+#endif
+#endif
 
+#ifdef  IS_MULTICORE
 		/* Initialize CPPI */
 		ret = Cppi_init(&cppiGblCfgParams);
 		if (ret != CPPI_SOK) {
@@ -260,60 +1291,79 @@ void master_task() {
 		cpdmaCfg.dmaNum = Cppi_CpDma_QMSS_CPDMA;
 
 		/* Open QMSS CPDMA */
-		Cppi_Handle hnd = (Cppi_Handle) Cppi_open(&cpdmaCfg);
+		hnd = (Cppi_Handle) Cppi_open(&cpdmaCfg);
 		if (hnd == NULL) {
 			printf("Error opening CPPI\n");
 			return;
 		}
-		cppiHnd = hnd;
-		CACHE_wbL1d ((void *) &cppiHnd, 128, CACHE_WAIT);
-
 #endif
 
-
-		/* ---------------------------- Setting up queues ------------------------- */
-		int i;
-		Cppi_Desc *c;
-
-		/* Open the operation queue for the transmit side */
-		q_tx_op = Qmss_queueOpen(
-				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
-				QUEUE_TX_OP_NUM, &is_allocated);
-
-		/* Open the operation queue for the receive side */
-		q_rx_op = Qmss_queueOpen(
-				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
-				QUEUE_RX_OP_NUM, &is_allocated);
-
-		/* Open the free queue for the receive side */
+		/* ---------------------------- Configure PKTDMA ------------------------- */
+		/* The flows of all links are set up here, before any consumer
+		 * runs: producer p's flows deliver into the Rx queue of each
+		 * consumer (or the shared one) from the Rx free queues.
+		 */
 		q_rx_free = Qmss_queueOpen(
 				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
 				QUEUE_RX_FREE_NUM, &is_allocated);
-
-#ifndef  IS_MULTICORE
-		/* Take half of the descriptors from the TX FDQ and put them in the RX FDQ */
-		for (i = 0; i < NUM_DESC / 2; i++) {
-			c = (Cppi_Desc*) Qmss_queuePop(q_tx_free);
-			Qmss_queuePushDesc(q_rx_free, c);
+#if DESC_MODE == DESC_MODE_MONO
+		for (p = 0; p < RX_NUM_POOLS; p++) {
+			rxPoolQ[p] = Qmss_queueOpen(
+					Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+					QUEUE_RX_FREE_NUM + p, &is_allocated);
 		}
 #endif
 
-		/* ---------------------------- Configure PKTDMA ------------------------- */
-		/* ------ Tx channel configuration -------- */
-		Cppi_TxChInitCfg txChCfg;
-		txChCfg.channelNum = CPPI_PARAM_NOT_SPECIFIED;
-		txChCfg.priority = 0;
-		txChCfg.filterEPIB = 0;
-		txChCfg.filterPS = 0;
-		txChCfg.aifMonoMode = 0;
-		txChCfg.txEnable = Cppi_ChState_CHANNEL_DISABLE;
-
-		Cppi_ChHnd txChHnd = (Cppi_ChHnd) Cppi_txChannelOpen(hnd, &txChCfg,
-				&is_allocated);
+		for (p = 0; p < TOPO_MAX_CORES; p++) {
+			if (!TOPO_IS(TOPO_PRODUCERS, p))
+				continue;
+
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+			if (rxFlowOpen(hnd, TOPO_FLOW(p, 0), rxQueue(p, 0), q_rx_free,
+					p) == NULL)
+				return;
+#else
+			for (c = 0; c < TOPO_MAX_CORES; c++) {
+				if (TOPO_IS(TOPO_CONSUMERS, c) && rxFlowOpen(hnd,
+						TOPO_FLOW(p, c), rxQueue(p, c), q_rx_free, p) == NULL)
+					return;
+			}
+#endif
 
-		/* Enable the channels */
-		ret = Cppi_channelEnable(txChHnd);
+			/* ------ Tx and Rx channel p, looped back by the PKTDMA ------ */
+			Cppi_TxChInitCfg txChCfg;
+			txChCfg.channelNum = p;
+			txChCfg.priority = 0;
+			txChCfg.filterEPIB = 0;
+			txChCfg.filterPS = 0;
+			txChCfg.aifMonoMode = 0;
+			txChCfg.txEnable = Cppi_ChState_CHANNEL_DISABLE;
+
+			Cppi_ChHnd txChHnd = (Cppi_ChHnd) Cppi_txChannelOpen(hnd,
+					&txChCfg, &is_allocated);
+
+			Cppi_RxChInitCfg rxChCfg;
+			rxChCfg.channelNum = p;
+			rxChCfg.rxEnable = Cppi_ChState_CHANNEL_DISABLE;
+
+			Cppi_ChHnd rxChHnd = (Cppi_ChHnd) Cppi_rxChannelOpen(hnd,
+					&rxChCfg, &is_allocated);
+
+			if (txChHnd == NULL || rxChHnd == NULL) {
+				printf("Error opening PKTDMA channel %d\n", p);
+				return;
+			}
+
+			/* Enable the channels */
+			Cppi_channelEnable(rxChHnd);
+			Cppi_channelEnable(txChHnd);
+		}
 
+#ifdef  IS_MULTICORE
+		/* Only now let the other cores in */
+		cppiHnd = hnd;
+		CACHE_wbL1d ((void *) &cppiHnd, 128, CACHE_WAIT);
+#endif
 	}
 #ifdef  IS_MULTICORE
 	else
@@ -329,7 +1379,6 @@ void master_task() {
 		cpdmaCfg.dmaNum = Cppi_CpDma_QMSS_CPDMA;
 
 		/* Open QMSS CPDMA */
-		Cppi_Handle hnd;
 		while (cppiHnd == NULL) {
 			CACHE_invL1d((void *)&cppiHnd, 128, CACHE_WAIT);
 		}
@@ -339,76 +1388,94 @@ void master_task() {
 			printf("Error opening CPPI\n");
 			return;
 		}
+	}
 
-		/* Open the operation queue for the receive side */
-		//q_rx_op = Qmss_queueOpen(
-				//Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
-				//QUEUE_RX_OP_NUM, &is_allocated);
-
-		/* Open the free queue for the receive side */
-		//q_rx_free = Qmss_queueOpen(
-				//Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
-				//QUEUE_RX_FREE_NUM, &is_allocated);
-
-		/* ------ Rx channel configuration --------- */
-		Cppi_RxChInitCfg rxChCfg;
-		rxChCfg.channelNum = CPPI_PARAM_NOT_SPECIFIED;
-		rxChCfg.rxEnable = Cppi_ChState_CHANNEL_DISABLE;
-
-		Cppi_ChHnd rxChHnd = (Cppi_ChHnd) Cppi_rxChannelOpen(hnd, &rxChCfg,
-				&is_allocated);
-
-		/* ------ Rx flow configuration ------- */
-		Cppi_RxFlowCfg rxFlowCfg;
-		Qmss_Queue queInfo;
-		memset((Void *) &rxFlowCfg, 0, sizeof(Cppi_RxFlowCfg));
-
-
-		/* The 'deliver' part (where new information goes) */
-		queInfo = Qmss_getQueueNumber(q_rx_op);
-		rxFlowCfg.flowIdNum = CPPI_PARAM_NOT_SPECIFIED;
-		rxFlowCfg.rx_dest_qnum = queInfo.qNum;
-		rxFlowCfg.rx_dest_qmgr = queInfo.qMgr;
-		rxFlowCfg.rx_sop_offset = MONOLITHIC_DESC_DATA_OFFSET;
-		rxFlowCfg.rx_desc_type = Cppi_DescType_MONOLITHIC;
-		/* The 'receive' part (where the free descriptors are) */
-		queInfo = Qmss_getQueueNumber(q_rx_free);
-		rxFlowCfg.rx_fdq0_sz0_qnum = queInfo.qNum;
-		rxFlowCfg.rx_fdq0_sz0_qmgr = queInfo.qMgr;
-
-		Cppi_FlowHnd rxFlowHnd = (Cppi_FlowHnd) Cppi_configureRxFlow(hnd,
-				&rxFlowCfg, &is_allocated);
-		/* Should check if rxFlowHnd is NULL */
-
-		if (rxFlowHnd == NULL) {
-			printf("Error: Opening Rx flow : %d\n", rxFlowCfg.flowIdNum);
-			return;
-		} else
-			printf("Opened Rx flow : %d\n", Cppi_getFlowId(rxFlowHnd));
+	/* ---------------------------- Setting up queues ------------------------- */
+
+	/* Open the free queue for the receive side */
+	q_rx_free = Qmss_queueOpen(
+			Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QUEUE_RX_FREE_NUM, &is_allocated);
+#if DESC_MODE == DESC_MODE_MONO
+	/* and the free queues of all Rx pools */
+	for (p = 0; p < RX_NUM_POOLS; p++) {
+		rxPoolQ[p] = Qmss_queueOpen(
+				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_RX_FREE_NUM + p, &is_allocated);
+	}
+#endif
 
-		/* Enable the channels */
-		ret = Cppi_channelEnable(rxChHnd);
+#if !defined(IS_MULTICORE) && DESC_MODE == DESC_MODE_MONO
+	/* Take half of the descriptors from the TX FDQ and put them in the RX FDQ */
+	q_tx_free = Qmss_queueOpen(
+			Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QUEUE_TX_FREE_NUM, &is_allocated);
+	for (p = 0; p < NUM_DESC / 2; p++) {
+		Qmss_queuePushDesc(q_rx_free, Qmss_queuePop(q_tx_free));
 	}
+	/* a single pool, whatever rxPoolOf says */
+	for (p = 0; p < RX_NUM_POOLS; p++)
+		rxPoolQ[p] = q_rx_free;
+#endif
+
+	/* Agree on the time base of the latency stamps */
+	tlat_sync(TOPO_PRODUCERS | TOPO_CONSUMERS | 1);
 
 	/* ---------------------------- Create Tasks ------------------------- */
 
-	/* Create the operational tasks: one producer, one consumer.
+	/* Create the operational tasks: a producer and/or consumers, as
+	 * the topology says for this core.
 	 * Let them know which queues we will be using.
 	 */
 	Task_Params tp;
 	Task_Params_init(&tp);
-	if (core_num == 0) {
+	if (TOPO_IS(TOPO_PRODUCERS, core_num)) {
+		/* Open the operation queue for the transmit side */
+		q_tx_op = Qmss_queueOpen(
+				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_TX_OP_NUM + core_num, &is_allocated);
+
+#if DESC_MODE == DESC_MODE_HOST
+		q_tx_free = Qmss_queueOpen(
+				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_TX_FREE_NUM, &is_allocated);
+#else
+		q_tx_free = Qmss_queueOpen(
+				Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_TX_FREE_NUM + core_num, &is_allocated);
+#endif
+
 		tp.arg0 = q_tx_op;
 		tp.arg1 = q_tx_free;
+#if DESC_MODE == DESC_MODE_HOST
+		Task_create(taskAHost, &tp, NULL);
+#else
 		Task_create(taskA, &tp, NULL);
-	}
-#ifdef  IS_MULTICORE
-	else
 #endif
-	{
-		tp.arg0 = q_rx_op;
+	}
+	if (TOPO_IS(TOPO_CONSUMERS, core_num)) {
+		tp.arg0 = 0;
 		tp.arg1 = q_rx_free;
+#if RX_MODE == RX_MODE_ACC
+		/* A channel and a taskBAcc per link into this core */
+		for (p = 0; p < TOPO_MAX_CORES; p++) {
+			if (!TOPO_IS(TOPO_PRODUCERS, p))
+				continue;
+#if TOPO_QUEUES == TOPO_QUEUES_SHARED
+			/* the shared queue has one, on the first consumer */
+			if (p != topoFirst(TOPO_PRODUCERS)
+					|| core_num != topoFirst(TOPO_CONSUMERS))
+				continue;
+#endif
+			c = TOPO_LINK(p, core_num);
+			if (rxAccInit(c, rxQueue(p, core_num), core_num) < 0)
+				return;
+			tp.arg0 = c;
+			Task_create(taskBAcc, &tp, NULL);
+		}
+#else
 		Task_create(taskB, &tp, NULL);
+#endif
 	}
 }
 
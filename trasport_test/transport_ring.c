@@ -0,0 +1,142 @@
+/*
+ *  ======== transport_ring.c ========
+ *  Single producer, single consumer message ring, see transport_ring.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_ring.h"
+
+/*
+ *  ======== slotOf ========
+ */
+static inline UInt8 *slotOf(TRingEnd *e, UInt32 index)
+{
+	return e->slots + (index & e->mask) * e->slotSize;
+}
+
+/*
+ *  ======== tring_init ========
+ */
+Void tring_init(TRing *r, UInt8 *slots, UInt32 numSlots, UInt32 slotSize)
+{
+	r->head.value = 0;
+	r->tail.value = 0;
+	r->slots = slots;
+	r->numSlots = numSlots;
+	r->slotSize = slotSize;
+	CACHE_wbL1d((void *) r, sizeof(*r), CACHE_WAIT);
+}
+
+/*
+ *  ======== attach ========
+ */
+static Void attach(TRingEnd *e, TRing *r)
+{
+	CACHE_invL1d((void *) r, sizeof(*r), CACHE_WAIT);
+	e->ring = r;
+	e->slots = r->slots;
+	e->mask = r->numSlots - 1;
+	e->slotSize = r->slotSize;
+}
+
+/*
+ *  ======== tring_attachProducer ========
+ */
+Void tring_attachProducer(TRingEnd *e, TRing *r)
+{
+	attach(e, r);
+	e->pos = r->head.value;
+	e->peer = r->tail.value;
+}
+
+/*
+ *  ======== tring_attachConsumer ========
+ */
+Void tring_attachConsumer(TRingEnd *e, TRing *r)
+{
+	attach(e, r);
+	e->pos = r->tail.value;
+	e->peer = r->head.value;
+}
+
+/*
+ *  ======== tring_alloc ========
+ *  The tail is only read again when the last value read says full.
+ */
+UInt8 *tring_alloc(TRingEnd *e)
+{
+	if (e->pos - e->peer > e->mask) {
+		CACHE_invL1d((void *) &e->ring->tail, TSTATS_LINE, CACHE_WAIT);
+		e->peer = e->ring->tail.value;
+		if (e->pos - e->peer > e->mask) {
+			return NULL;
+		}
+	}
+
+	return slotOf(e, e->pos++) + TRING_HDR_SIZE;
+}
+
+/*
+ *  ======== tring_send ========
+ */
+Void tring_send(TRingEnd *e, UInt8 *msg, UInt32 len)
+{
+	UInt8 *slot = msg - TRING_HDR_SIZE;
+
+	*(UInt32 *) slot = len;
+	CACHE_wbL1d((void *) slot, TRING_HDR_SIZE + len, CACHE_NOWAIT);
+}
+
+/*
+ *  ======== tring_publish ========
+ *  The fenced write back of the (unchanged) head line waits for the
+ *  message write backs of tring_send; only then the new head goes out.
+ */
+Void tring_publish(TRingEnd *e)
+{
+	TRingIndex *head = &e->ring->head;
+
+	CACHE_wbL1d((void *) head, TSTATS_LINE, CACHE_FENCE_WAIT);
+	head->value = e->pos;
+	CACHE_wbL1d((void *) head, TSTATS_LINE, CACHE_WAIT);
+}
+
+/*
+ *  ======== tring_recv ========
+ *  The first line of the slot holds the length; the rest is invalidated
+ *  only if the message goes on past it.
+ */
+UInt8 *tring_recv(TRingEnd *e, UInt32 *len)
+{
+	UInt8 *slot;
+
+	if (e->pos == e->peer) {
+		CACHE_invL1d((void *) &e->ring->head, TSTATS_LINE, CACHE_WAIT);
+		e->peer = e->ring->head.value;
+		if (e->pos == e->peer) {
+			return NULL;
+		}
+	}
+
+	slot = slotOf(e, e->pos++);
+	CACHE_invL1d((void *) slot, TSTATS_LINE, CACHE_WAIT);
+	*len = *(volatile UInt32 *) slot;
+	if (TRING_HDR_SIZE + *len > TSTATS_LINE) {
+		CACHE_invL1d((void *) (slot + TSTATS_LINE),
+				TRING_HDR_SIZE + *len - TSTATS_LINE, CACHE_WAIT);
+	}
+
+	return slot + TRING_HDR_SIZE;
+}
+
+/*
+ *  ======== tring_release ========
+ */
+Void tring_release(TRingEnd *e)
+{
+	TRingIndex *tail = &e->ring->tail;
+
+	tail->value = e->pos;
+	CACHE_wbL1d((void *) tail, TSTATS_LINE, CACHE_WAIT);
+}
@@ -0,0 +1,110 @@
+/*
+ *  ======== transport_ring.h ========
+ *  Single producer, single consumer message ring between two cores,
+ *  without QMSS.
+ *
+ *  The ring is a TRing control block and an array of numSlots slots of
+ *  slotSize bytes, both in memory the two cores share: MSMCSRAM, or one
+ *  core's L2 through its global address. Each slot holds one message of
+ *  up to slotSize - TRING_HDR_SIZE bytes after its length word. The
+ *  producer owns the head line (messages sent), the consumer the tail
+ *  line (messages released); each writes back only its own line and
+ *  invalidates only the other one, and only when its cached copy says the
+ *  ring is full or empty. The message bytes are written back by the
+ *  producer and invalidated by the consumer, nothing else of the ring
+ *  moves through the caches.
+ *
+ *  Each side keeps its own view of the ring, a TRingEnd, in its local
+ *  memory. The producer takes slots with tring_alloc, writes the messages
+ *  into them, closes each with tring_send and makes them visible together
+ *  with tring_publish. The consumer takes messages with tring_recv, in
+ *  order, and gives their slots back together with tring_release.
+ */
+
+#ifndef TRANSPORT_RING_H_
+#define TRANSPORT_RING_H_
+
+#include <xdc/std.h>
+
+#include "transport_stats.h"
+
+/* slot bytes before the message: its length, then a pad word */
+#define TRING_HDR_SIZE      8
+
+/* slot size, whole cache lines, for messages of up to max bytes */
+#define TRING_SLOT_SIZE(max) \
+        (((max) + TRING_HDR_SIZE + TSTATS_LINE - 1) & ~(TSTATS_LINE - 1))
+
+typedef struct TRingIndex {
+    volatile UInt32 value;
+    UInt8           pad[TSTATS_LINE - 4];
+} TRingIndex;
+
+typedef struct TRing {
+    TRingIndex      head;           /* messages published, producer's */
+    TRingIndex      tail;           /* messages released, consumer's */
+    UInt8          *slots;          /* global address */
+    UInt32          numSlots;       /* a power of two */
+    UInt32          slotSize;       /* a multiple of TSTATS_LINE */
+    UInt8           pad[TSTATS_LINE - 12];
+} TRing;
+
+typedef struct TRingEnd {
+    TRing          *ring;
+    UInt8          *slots;
+    UInt32          mask;
+    UInt32          slotSize;
+    UInt32          pos;            /* slots allocated, or messages received */
+    UInt32          peer;           /* other side's index, last read */
+} TRingEnd;
+
+/*
+ *  ======== tring_init ========
+ *  Sets up an empty ring over numSlots slots of slotSize bytes at slots,
+ *  and writes it back. Called by one core, before either side attaches.
+ */
+Void tring_init(TRing *r, UInt8 *slots, UInt32 numSlots, UInt32 slotSize);
+
+/*
+ *  ======== tring_attachProducer / tring_attachConsumer ========
+ *  Reads the ring set up by tring_init into the calling side's view.
+ */
+Void tring_attachProducer(TRingEnd *e, TRing *r);
+Void tring_attachConsumer(TRingEnd *e, TRing *r);
+
+/*
+ *  ======== tring_alloc ========
+ *  Producer: the message area of the next free slot, or NULL if the ring
+ *  is full.
+ */
+UInt8 *tring_alloc(TRingEnd *e);
+
+/*
+ *  ======== tring_send ========
+ *  Producer: sets the length of the message at msg, from tring_alloc, and
+ *  writes it back from L1D. Every slot allocated must be sent before the
+ *  next tring_publish.
+ */
+Void tring_send(TRingEnd *e, UInt8 *msg, UInt32 len);
+
+/*
+ *  ======== tring_publish ========
+ *  Producer: makes the messages sent so far visible to the consumer.
+ */
+Void tring_publish(TRingEnd *e);
+
+/*
+ *  ======== tring_recv ========
+ *  Consumer: the next message, invalidated in L1D, and its length in
+ *  *len; NULL if there is none. It stays valid until tring_release.
+ */
+UInt8 *tring_recv(TRingEnd *e, UInt32 *len);
+
+/*
+ *  ======== tring_release ========
+ *  Consumer: gives the slots of the messages received so far back to the
+ *  producer.
+ */
+Void tring_release(TRingEnd *e);
+
+#endif /* TRANSPORT_RING_H_ */
@@ -0,0 +1,137 @@
+/*
+ *  ======== transport_stats.c ========
+ *  Receive statistics and payload check, see transport_stats.h.
+ */
+
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_stats.h"
+#include "transport_timer.h"
+
+/*
+ * Two pattern words per 64-bit load: words i and i + 1 read as one little
+ * endian double word are i | (i + 1) << 32, and the next pair adds 2 to
+ * both halves.
+ */
+#define PAIR(i)     ((UInt64) (UInt32) (i) | (UInt64) (UInt32) ((i) + 1) << 32)
+#define PAIR_STEP   0x0000000200000002ULL
+
+#pragma DATA_SECTION(tstats, ".tstats")
+#pragma DATA_ALIGN(tstats, TSTATS_LINE)
+TStats tstats[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== countBad ========
+ *  Slow path, only run on a payload that failed the check.
+ */
+static UInt32 countBad(const UInt32 *w, UInt32 n, UInt32 first)
+{
+	UInt32 i, bad = 0;
+
+	for (i = 0; i < n; i++) {
+		bad += (w[i] != first + i);
+	}
+	return bad;
+}
+
+/*
+ *  ======== tstats_checkPayload ========
+ */
+UInt32 tstats_checkPayload(const UInt8 *buf, UInt32 len)
+{
+	return tstats_checkPayloadAt(buf, len, 0);
+}
+
+/*
+ *  ======== tstats_checkPayloadAt ========
+ *  The fast path ORs together the XOR of every double word with the
+ *  expected pair, a loop without branches the compiler software-pipelines
+ *  on the C66x (LDDW, two words per load) and vectorizes on a host.
+ */
+UInt32 tstats_checkPayloadAt(const UInt8 *buf, UInt32 len, UInt32 first)
+{
+	const UInt64 *d = (const UInt64 *) buf;
+	UInt32 words = len / 4;
+	UInt32 pairs = words / 2;
+	UInt64 expect = PAIR(first);
+	UInt64 diff = 0;
+	UInt32 i;
+
+#ifdef _TMS320C6X
+	_nassert(((UInt32) buf & 7) == 0);
+#endif
+	for (i = 0; i < pairs; i++) {
+		diff |= d[i] ^ expect;
+		expect += PAIR_STEP;
+	}
+	if (words & 1) {
+		diff |= ((const UInt32 *) buf)[words - 1] ^ (first + words - 1);
+	}
+
+	return (diff == 0) ? 0 : countBad((const UInt32 *) buf, words, first);
+}
+
+/*
+ *  ======== tstats_seq ========
+ *  Differences are taken modulo 2^32, so the numbers may wrap.
+ */
+UInt32 tstats_seq(TStats *s, const UInt8 *hdr)
+{
+	UInt32 seq = ((const UInt32 *) hdr)[0];
+	UInt32 check = ((const UInt32 *) hdr)[1];
+	UInt32 ahead = seq - s->nextSeq;
+	UInt32 back;
+
+	if (check != ~seq) {
+		return 1;
+	}
+
+	if ((Int32) ahead >= 0) {
+		// In order, or after a gap of ahead numbers
+		s->lost += ahead;
+		s->seen = (ahead + 1 >= TSTATS_SEQ_WINDOW) ? 1
+				: (s->seen << (ahead + 1)) | 1;
+		s->nextSeq = seq + 1;
+		return 0;
+	}
+
+	back = s->nextSeq - 1 - seq;
+	if (back >= TSTATS_SEQ_WINDOW) {
+		s->reorders++;
+	} else if ((s->seen >> back) & 1) {
+		s->dups++;
+	} else {
+		// Late: counted as lost when the gap opened
+		s->seen |= (UInt64) 1 << back;
+		s->reorders++;
+		s->lost--;
+	}
+	return 0;
+}
+
+/*
+ *  ======== tstats_count ========
+ */
+Void tstats_count(TStats *s, UInt32 len, UInt32 badWords)
+{
+	UInt64 now = transport_timerRead();
+
+	if (s->packets == 0) {
+		s->first = now;
+	}
+	s->last = now;
+	s->packets++;
+	s->bytes += len;
+	if (badWords != 0) {
+		s->errors++;
+		s->badWords += badWords;
+	}
+}
+
+/*
+ *  ======== tstats_publish ========
+ */
+Void tstats_publish(TStats *s)
+{
+	CACHE_wbL1d((void *) s, sizeof(*s), CACHE_WAIT);
+}
@@ -0,0 +1,96 @@
+/*
+ *  ======== transport_stats.h ========
+ *  Receive statistics of the transport consumers and the payload check
+ *  they are based on.
+ *
+ *  Every link, a producer and a consumer core, has one cache line of
+ *  tstats, tstats[producer][consumer], placed in the .tstats section
+ *  (MSMCSRAM, see transport_linker.cmd) so it can be read from any core or
+ *  from CCS while the transport runs. The consumer updates the blocks of
+ *  its links and writes them back with tstats_publish.
+ *
+ *  The producer numbers the packets of every link in a header at the
+ *  start of the payload (tstats_seqStamp); tstats_seq follows the numbers
+ *  on the consumer side and counts packets lost, duplicated or received
+ *  out of order. A packet older than the last TSTATS_SEQ_WINDOW numbers
+ *  can no longer be told from a duplicate and counts as reordered.
+ */
+
+#ifndef TRANSPORT_STATS_H_
+#define TRANSPORT_STATS_H_
+
+#include <xdc/std.h>
+
+#define TSTATS_MAX_CORES    4
+#define TSTATS_LINE         128
+
+/* payload bytes of the sequence header: the number and its complement */
+#define TSTATS_SEQ_SIZE     8
+#define TSTATS_SEQ_WINDOW   64
+
+typedef struct TStats {
+    volatile UInt32 packets;        /* packets received */
+    volatile UInt32 errors;         /* packets failing the payload check */
+    volatile UInt32 badWords;       /* mismatching words in those */
+    volatile UInt32 core;           /* consumer core */
+    volatile UInt64 bytes;          /* payload bytes received */
+    volatile UInt64 first;          /* transport_timerRead at the first packet */
+    volatile UInt64 last;           /* and at the latest one */
+    volatile UInt32 producer;       /* producer core */
+    volatile UInt32 lost;           /* sequence numbers never received */
+    volatile UInt32 dups;           /* received twice */
+    volatile UInt32 reorders;       /* received after a later one */
+    UInt64          seen;           /* bit i: number nextSeq - 1 - i came */
+    UInt32          nextSeq;        /* number expected next */
+    UInt8           pad[TSTATS_LINE - 68];
+} TStats;
+
+extern TStats tstats[TSTATS_MAX_CORES][TSTATS_MAX_CORES];
+
+/*
+ *  ======== tstats_checkPayload ========
+ *  Compares a payload of len bytes against the generateData pattern (word
+ *  i holds i) and returns the number of 32-bit words that differ. buf must
+ *  be 8-byte aligned; a trailing partial word is not checked.
+ */
+UInt32 tstats_checkPayload(const UInt8 *buf, UInt32 len);
+
+/*
+ *  ======== tstats_checkPayloadAt ========
+ *  tstats_checkPayload for a piece of a larger payload that starts at
+ *  pattern word first (word i holds first + i), one linked buffer of a
+ *  host descriptor chain.
+ */
+UInt32 tstats_checkPayloadAt(const UInt8 *buf, UInt32 len, UInt32 first);
+
+/*
+ *  ======== tstats_seqStamp ========
+ *  Writes sequence number seq into the TSTATS_SEQ_SIZE bytes at hdr.
+ */
+static inline Void tstats_seqStamp(UInt8 *hdr, UInt32 seq)
+{
+    ((UInt32 *) hdr)[0] = seq;
+    ((UInt32 *) hdr)[1] = ~seq;
+}
+
+/*
+ *  ======== tstats_seq ========
+ *  Follows the sequence number in the header at hdr. Returns 1, a bad
+ *  word for tstats_count, if the number and its complement disagree, and
+ *  then leaves the sequence state alone; 0 otherwise.
+ */
+UInt32 tstats_seq(TStats *s, const UInt8 *hdr);
+
+/*
+ *  ======== tstats_count ========
+ *  Adds one packet of len bytes with badWords failing words to s.
+ */
+Void tstats_count(TStats *s, UInt32 len, UInt32 badWords);
+
+/*
+ *  ======== tstats_publish ========
+ *  Writes s back from L1D so other cores see the current counters.
+ */
+Void tstats_publish(TStats *s);
+
+#endif /* TRANSPORT_STATS_H_ */
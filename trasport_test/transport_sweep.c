@@ -0,0 +1,1140 @@
+/*
+ *  ======== transport_sweep.c ========
+ *  Throughput and latency sweep of the QMSS transport, a program of its
+ *  own (CCS build configuration Sweep, or the host emulation, see
+ *  host/emu_bios.c) built from the same transport_*.c modules as
+ *  transport_main.c.
+ *
+ *  Every case sends a number of packets from one producer core to one
+ *  consumer core over one of four paths (SWEEP_PATHS):
+ *
+ *      hdesc       chains of host descriptors with SWEEP_BUF_SIZE byte
+ *                  buffers, through infrastructure PKTDMA channel producer
+ *      mono        monolithic descriptors through the same channel, the
+ *                  way transport_main.c's taskA and taskB move them
+ *      ring        a transport_ring.h ring in MSMCSRAM, no QMSS at all
+ *      bcast       hdesc chains published once to all consumer cores but
+ *                  the producer, transport_bcast.h; each reads the same
+ *                  buffers
+ *
+ *  and varies:
+ *
+ *      size        payload bytes, sweepSizes (64 B to 64 KB) for hdesc and
+ *                  bcast, sweepMsgSizes (16 B to 256 B) for mono and ring
+ *      descs       Tx and Rx descriptors the case may use, or ring slots
+ *      batch       packets per Tx burst and per Rx pop, sweepBatches
+ *      pair        producer -> consumer, every pair of SWEEP_PRODUCERS
+ *                  and SWEEP_CONSUMERS on different cores; for bcast
+ *                  every producer, to all its readers at once
+ *
+ *  The cases run one at a time: core 0 gives the case its descriptors,
+ *  all cores meet at a barrier, the cores of the case run it and they
+ *  meet again. Cases that need more descriptors per packet than they have
+ *  are skipped. Core 0 prints one CSV row per case and consumer on
+ *  stdout, after a header row; other lines start with '#'. Rates are from the consumer's start of
+ *  the case to its last packet, latencies from the tlat stamps
+ *  (transport_latency.h).
+ *
+ *  On the host the program stops on its own once the table is printed,
+ *  give it enough run time: ./transport_sweep 600000
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_drv.h>
+#include <ti/drv/cppi/cppi_desc.h>
+
+#include <ti/csl/csl_chip.h>
+#include <ti/csl/csl_cacheAux.h>
+
+#include "transport_bcast.h"
+#include "transport_desc.h"
+#include "transport_hdesc.h"
+#include "transport_latency.h"
+#include "transport_ring.h"
+#include "transport_stats.h"
+#include "transport_timer.h"
+
+/* QMSS device specific configuration */
+extern Qmss_GlobalConfigParams qmssGblCfgParams;
+extern Cppi_GlobalConfigParams cppiGblCfgParams;
+
+#define MAX_CORES 4
+
+/* core pairs swept: producer p to consumer c, p in one mask, c in the other */
+#ifndef SWEEP_PRODUCERS
+#define SWEEP_PRODUCERS 0x1
+#endif
+#ifndef SWEEP_CONSUMERS
+#define SWEEP_CONSUMERS 0xe
+#endif
+#define SWEEP_CORES (SWEEP_PRODUCERS | SWEEP_CONSUMERS | 1)
+
+#define SWEEP_PATH_HDESC 0
+#define SWEEP_PATH_MONO 1
+#define SWEEP_PATH_RING 2
+#define SWEEP_PATH_BCAST 3
+#define SWEEP_NUM_PATHS 4
+/* paths swept, bit n for path n */
+#ifndef SWEEP_PATHS
+#define SWEEP_PATHS 0xf
+#endif
+/* descriptor pool of a path: the host one, or the monolithic one */
+#define SWEEP_POOL(path) ((path) == SWEEP_PATH_MONO)
+
+/*
+ * Descriptor pools, in core 0's L2: SWEEP_NUM_DESC host descriptors per
+ * side, each with a SWEEP_BUF_SIZE buffer in MSMCSRAM (.thost), and
+ * SWEEP_NUM_DESC monolithic descriptors per side for messages of up to
+ * SWEEP_MSG_MAX bytes. A case takes the descs it runs with from the pools
+ * of its path. The ring has up to SWEEP_NUM_DESC slots, in MSMCSRAM.
+ */
+#define SWEEP_BUF_SIZE 2048
+#define SWEEP_NUM_DESC 256
+#define SIZE_HOST_DESC 64
+#define SWEEP_MSG_MAX 256
+#define MONOLITHIC_DESC_DATA_OFFSET 16
+#define SWEEP_MONO_SIZE (MONOLITHIC_DESC_DATA_OFFSET + SWEEP_MSG_MAX)
+#define SWEEP_SLOT_SIZE TRING_SLOT_SIZE(SWEEP_MSG_MAX)
+
+/*
+ * Packets per case: SWEEP_BYTES worth, but at least SWEEP_MIN_PACKETS and
+ * at most SWEEP_MAX_PACKETS. A case that has not finished after
+ * SWEEP_TIMEOUT_MS counts the packets missing as lost.
+ */
+#ifndef SWEEP_BYTES
+#define SWEEP_BYTES (4 * 1024 * 1024)
+#endif
+#ifndef SWEEP_MIN_PACKETS
+#define SWEEP_MIN_PACKETS 64
+#endif
+#ifndef SWEEP_MAX_PACKETS
+#define SWEEP_MAX_PACKETS 4096
+#endif
+#ifndef SWEEP_TIMEOUT_MS
+#define SWEEP_TIMEOUT_MS 2000
+#endif
+
+/* payload header: the latency stamp, then the sequence number */
+#define SWEEP_SEQ_OFFSET TLAT_STAMP_SIZE
+#define SWEEP_HDR_SIZE (TLAT_STAMP_SIZE + TSTATS_SEQ_SIZE)
+
+#define QUEUE_TX_OP_NUM 800 /* + producer core, the Tx queue of its channel */
+#define QUEUE_TX_FREE_NUM 852 /* + path */
+#define QUEUE_RX_FREE_NUM 859 /* + path */
+#define QUEUE_RX_LINK_NUM 1000 /* + SWEEP_LINK(p, c), for both PKTDMA paths */
+
+#define SWEEP_LINK(p, c) ((p) * MAX_CORES + (c))
+/* Rx flow of link on path: the hdesc flows first, then the mono ones */
+#define SWEEP_FLOW(path, link) ((path) * MAX_CORES * MAX_CORES + (link))
+#define SWEEP_IS(mask, core) (((mask) >> (core)) & 1)
+
+static const UInt32 sweepSizes[] = {
+	64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536
+};
+static const UInt32 sweepMsgSizes[] = { 16, 32, 64, 128, 256 };
+static const UInt32 sweepDescs[] = { 32, 64, 128, 256 };
+static const UInt32 sweepBatches[] = { 1, 8, 32 };
+
+#define SWEEP_NUM(table) (sizeof(table) / sizeof((table)[0]))
+
+static const char * const sweepPathNames[SWEEP_NUM_PATHS] = {
+	"hdesc", "mono", "ring", "bcast"
+};
+
+typedef struct SweepCase {
+	UInt32 path;
+	UInt32 producer;
+	UInt32 consumer;
+	UInt32 readers;             /* consumer cores mask */
+	UInt32 size;
+	UInt32 descs;
+	UInt32 batch;
+	UInt32 packets;
+} SweepCase;
+
+/*
+ * Tx and Rx host and monolithic descriptors, in one block so their
+ * regions are inserted in address order, and the buffers attached to the
+ * host ones
+ */
+typedef struct SweepDescMem {
+    unsigned char host[2 * SWEEP_NUM_DESC * SIZE_HOST_DESC];
+    unsigned char mono[2 * SWEEP_NUM_DESC * SWEEP_MONO_SIZE];
+} SweepDescMem;
+
+#pragma DATA_ALIGN(sweep_desc, 16)
+SweepDescMem sweep_desc;
+#pragma DATA_SECTION(sweep_tx_bufs, ".thost")
+#pragma DATA_ALIGN(sweep_tx_bufs, 128)
+unsigned char sweep_tx_bufs[SWEEP_NUM_DESC * SWEEP_BUF_SIZE];
+#pragma DATA_SECTION(sweep_rx_bufs, ".thost")
+#pragma DATA_ALIGN(sweep_rx_bufs, 128)
+unsigned char sweep_rx_bufs[SWEEP_NUM_DESC * SWEEP_BUF_SIZE];
+
+/* The ring, its control block with the stats and its slots in MSMCSRAM */
+#pragma DATA_SECTION(sweepRing, ".tstats")
+#pragma DATA_ALIGN(sweepRing, TSTATS_LINE)
+static TRing sweepRing;
+#pragma DATA_SECTION(sweep_ring_slots, ".thost")
+#pragma DATA_ALIGN(sweep_ring_slots, 128)
+unsigned char sweep_ring_slots[SWEEP_NUM_DESC * SWEEP_SLOT_SIZE];
+
+/* The broadcast channel, and every reader's view of it */
+#pragma DATA_SECTION(sweepBcast, ".tstats")
+#pragma DATA_ALIGN(sweepBcast, TSTATS_LINE)
+static TBcast sweepBcast;
+static TBcastReader sweepReader[MAX_CORES];
+
+#pragma DATA_SECTION(cppiHnd, ".cppi")
+#pragma DATA_ALIGN(cppiHnd, 128)
+Cppi_Handle cppiHnd = NULL;
+
+/*
+ * barrier rounds, a cache line per core; core 0's releases the others.
+ * The consumer of a case leaves its start time there for core 0.
+ */
+typedef struct SweepSync {
+    volatile UInt32 round;
+    UInt32          pad0;
+    volatile UInt64 start;
+    UInt8           pad[TSTATS_LINE - 16];
+} SweepSync;
+
+#pragma DATA_SECTION(sweepSync, ".tstats")
+#pragma DATA_ALIGN(sweepSync, TSTATS_LINE)
+static SweepSync sweepSync[MAX_CORES];
+
+/* core 0's queues holding the descriptors no case uses, per path and side */
+static Qmss_QueueHnd sweepTxSpare[2], sweepRxSpare[2];
+
+/*Compute global address*/
+static UInt32 l2_global_address(UInt32 addr, Uint8 corenum) {
+	/* Compute the global address. */
+	return (addr + (0x10000000 + (corenum * 0x1000000)));
+}
+
+/*
+ *  ======== sweepWait ========
+ *  Waits for the barrier line of core to reach round.
+ */
+static Void sweepWait(UInt32 core, UInt32 round)
+{
+	CACHE_invL1d((void *) &sweepSync[core], TSTATS_LINE, CACHE_WAIT);
+	while (sweepSync[core].round < round) {
+		Task_yield();
+		CACHE_invL1d((void *) &sweepSync[core], TSTATS_LINE, CACHE_WAIT);
+	}
+}
+
+/*
+ *  ======== sweepBarrier ========
+ *  Returns once every core of SWEEP_CORES has called it for round.
+ */
+static Void sweepBarrier(UInt32 core_num, UInt32 round)
+{
+	UInt32 c;
+
+	if (core_num == 0) {
+		for (c = 1; c < MAX_CORES; c++) {
+			if (SWEEP_IS(SWEEP_CORES, c))
+				sweepWait(c, round);
+		}
+	}
+	sweepSync[core_num].round = round;
+	CACHE_wbL1d((void *) &sweepSync[core_num], TSTATS_LINE, CACHE_WAIT);
+	if (core_num != 0)
+		sweepWait(0, round);
+}
+
+/*
+ *  ======== sweepPair ========
+ *  Core pair n of path into k, counting from 0; returns the number of
+ *  pairs. A bcast pair is a producer and all consumer cores but itself,
+ *  k->consumer the first of them.
+ */
+static UInt32 sweepPair(UInt32 path, UInt32 n, SweepCase *k)
+{
+	UInt32 p, c, readers, pair = 0;
+
+	k->producer = k->consumer = k->readers = 0;
+	for (p = 0; p < MAX_CORES; p++) {
+		readers = SWEEP_PRODUCERS & (1 << p) ? SWEEP_CONSUMERS & ~(1 << p) : 0;
+		for (c = 0; c < MAX_CORES; c++) {
+			if (!SWEEP_IS(readers, c))
+				continue;
+			if (pair++ == n) {
+				k->producer = p;
+				k->consumer = c;
+				k->readers = (path == SWEEP_PATH_BCAST) ? readers : 1 << c;
+			}
+			// One pair per producer for bcast
+			if (path == SWEEP_PATH_BCAST)
+				break;
+		}
+	}
+	return pair;
+}
+
+/*
+ *  ======== sweepCase ========
+ *  Case i of the sweep, path outermost, then pair, size, descs and batch.
+ *  Returns FALSE past the last case.
+ */
+static Bool sweepCase(UInt32 i, SweepCase *k)
+{
+	const UInt32 *sizes;
+	UInt32 numSizes, n;
+
+	for (k->path = 0; k->path < SWEEP_NUM_PATHS; k->path++) {
+		if (!SWEEP_IS(SWEEP_PATHS, k->path))
+			continue;
+		if (k->path == SWEEP_PATH_HDESC || k->path == SWEEP_PATH_BCAST) {
+			sizes = sweepSizes;
+			numSizes = SWEEP_NUM(sweepSizes);
+		} else {
+			sizes = sweepMsgSizes;
+			numSizes = SWEEP_NUM(sweepMsgSizes);
+		}
+		n = sweepPair(k->path, 0, k) * numSizes * SWEEP_NUM(sweepDescs)
+				* SWEEP_NUM(sweepBatches);
+		if (i < n)
+			break;
+		i -= n;
+	}
+	if (k->path == SWEEP_NUM_PATHS)
+		return FALSE;
+
+	k->batch = sweepBatches[i % SWEEP_NUM(sweepBatches)];
+	i /= SWEEP_NUM(sweepBatches);
+	k->descs = sweepDescs[i % SWEEP_NUM(sweepDescs)];
+	i /= SWEEP_NUM(sweepDescs);
+	k->size = sizes[i % numSizes];
+	i /= numSizes;
+	sweepPair(k->path, i, k);
+
+	k->packets = SWEEP_BYTES / k->size;
+	if (k->packets < SWEEP_MIN_PACKETS)
+		k->packets = SWEEP_MIN_PACKETS;
+	if (k->packets > SWEEP_MAX_PACKETS)
+		k->packets = SWEEP_MAX_PACKETS;
+	return TRUE;
+}
+
+/*
+ *  ======== sweepFits ========
+ *  A chain must fit in the descriptors of the case, on both sides.
+ */
+static Bool sweepFits(const SweepCase *k)
+{
+	return (k->path != SWEEP_PATH_HDESC && k->path != SWEEP_PATH_BCAST)
+			|| (k->size + SWEEP_BUF_SIZE - 1) / SWEEP_BUF_SIZE <= k->descs;
+}
+
+/*
+ *  ======== sweepMove ========
+ *  Moves up to n descriptors from one queue to another, returns how many.
+ */
+static UInt32 sweepMove(Qmss_QueueHnd from, Qmss_QueueHnd to, UInt32 n)
+{
+	Cppi_Desc *descs[TDESC_MAX_BATCH];
+	UInt32 m, moved = 0;
+
+	while (moved < n && (m = tdesc_popBatch(from, descs,
+			(n - moved < TDESC_MAX_BATCH) ? n - moved : TDESC_MAX_BATCH,
+			0)) > 0) {
+		tdesc_pushBatch(to, descs, m, 0, 0);
+		moved += m;
+	}
+	return moved;
+}
+
+/*
+ *  ======== sweepSetup ========
+ *  Core 0: the case's descriptors into the Tx and Rx free queues of its
+ *  path, or an empty ring of descs slots, and clean stats for its links.
+ */
+static Void sweepSetup(const SweepCase *k, Qmss_QueueHnd *txFree,
+		Qmss_QueueHnd *rxFree)
+{
+	UInt32 pool = SWEEP_POOL(k->path);
+	TStats *stats;
+	UInt32 c;
+
+	if (k->path == SWEEP_PATH_RING) {
+		tring_init(&sweepRing, sweep_ring_slots, k->descs, SWEEP_SLOT_SIZE);
+	} else {
+		sweepMove(sweepTxSpare[pool], txFree[pool], k->descs);
+		sweepMove(sweepRxSpare[pool], rxFree[pool], k->descs);
+	}
+	if (k->path == SWEEP_PATH_BCAST)
+		tbcast_init(&sweepBcast, txFree[pool]);
+
+	for (c = 0; c < MAX_CORES; c++) {
+		if (!SWEEP_IS(k->readers, c))
+			continue;
+		stats = &tstats[k->producer][c];
+		memset((Void *) stats, 0, sizeof(*stats));
+		stats->producer = k->producer;
+		stats->core = c;
+		tstats_publish(stats);
+		tlat_clear(&tlat[k->producer][c]);
+		CACHE_wbL1d((void *) &tlat[k->producer][c], sizeof(TLatHist),
+				CACHE_WAIT);
+	}
+}
+
+/*
+ *  ======== sweepRestore ========
+ *  Core 0: waits for the descriptors of the case to be back in the free
+ *  queues, at most SWEEP_TIMEOUT_MS, and parks them again. The ring needs
+ *  nothing, the next case sets it up afresh.
+ */
+static Void sweepRestore(const SweepCase *k, Qmss_QueueHnd txFree,
+		Qmss_QueueHnd rxFree)
+{
+	UInt64 end = transport_timerRead()
+			+ (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+	UInt32 back;
+
+	if (k->path == SWEEP_PATH_RING)
+		return;
+
+	while ((Qmss_getQueueEntryCount(txFree) < k->descs
+			|| Qmss_getQueueEntryCount(rxFree) < k->descs)
+			&& transport_timerRead() < end) {
+		Task_yield();
+	}
+
+	back = sweepMove(txFree, sweepTxSpare[SWEEP_POOL(k->path)], SWEEP_NUM_DESC)
+			+ sweepMove(rxFree, sweepRxSpare[SWEEP_POOL(k->path)],
+					SWEEP_NUM_DESC);
+	if (back != 2 * k->descs) {
+		printf("# %s %u->%u size %u: %u descriptors did not come back\n",
+				sweepPathNames[k->path], k->producer, k->consumer, k->size,
+				2 * k->descs - back);
+	}
+}
+
+/*
+ *  ======== sweepPattern ========
+ *  Writes the generateData pattern of len bytes starting at word first.
+ */
+static Void sweepPattern(UInt8 *buf, UInt32 len, UInt32 first)
+{
+	UInt32 i;
+
+	for (i = 0; i < len / 4; i++) {
+		((UInt32 *) buf)[i] = first + i;
+	}
+}
+
+/*
+ *  ======== sweepFill ========
+ *  Writes the pattern of a whole payload over the buffers of the chain at
+ *  sop.
+ */
+static Void sweepFill(Cppi_Desc *sop)
+{
+	Cppi_Desc *d;
+	UInt8 *buf;
+	UInt32 len, word = 0;
+
+	for (d = sop; d != NULL; d = Cppi_getNextBD(Cppi_DescType_HOST, d)) {
+		Cppi_getData(Cppi_DescType_HOST, d, &buf, &len);
+		sweepPattern(buf, len, word);
+		word += len / 4;
+	}
+}
+
+/*
+ *  ======== sweepProduce ========
+ *  Sends the packets of an hdesc case in bursts of up to batch chains,
+ *  each burst stamped right before it goes.
+ */
+static Void sweepProduce(const SweepCase *k, Qmss_QueueHnd opq,
+		Qmss_QueueHnd freeq)
+{
+	Cppi_Desc *sops[TDESC_MAX_BATCH];
+	UInt8 *buf;
+	UInt32 len, n, i, want, sent = 0;
+	UInt8 flow = SWEEP_FLOW(k->path, SWEEP_LINK(k->producer, k->consumer));
+	UInt64 end = transport_timerRead()
+			+ (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+
+	while (sent < k->packets) {
+		want = k->packets - sent;
+		want = (want < k->batch) ? want : k->batch;
+		for (n = 0; n < want; n++) {
+			if ((sops[n] = thdesc_txAlloc(freeq, k->size)) == NULL)
+				break;
+			sweepFill(sops[n]);
+			Cppi_getData(Cppi_DescType_HOST, sops[n], &buf, &len);
+			tstats_seqStamp(buf + SWEEP_SEQ_OFFSET, sent + n);
+		}
+
+		if (n == 0) {
+			if (transport_timerRead() > end)
+				return;
+			Task_yield();
+			continue;
+		}
+
+		for (i = 0; i < n; i++) {
+			Cppi_getData(Cppi_DescType_HOST, sops[i], &buf, &len);
+			tlat_stamp(buf);
+			thdesc_txSend(opq, sops[i], flow);
+		}
+		sent += n;
+	}
+}
+
+/*
+ *  ======== sweepProduceMono ========
+ *  sweepProduce for a mono case: the payloads go straight into the
+ *  descriptors and every burst is written back and pushed as a whole, as
+ *  taskA does.
+ */
+static Void sweepProduceMono(const SweepCase *k, Qmss_QueueHnd opq,
+		Qmss_QueueHnd freeq)
+{
+	Cppi_Desc *descs[TDESC_MAX_BATCH];
+	Qmss_Queue retq = Qmss_getQueueNumber(freeq);
+	UInt32 n, i, want, size = 0, sent = 0;
+	UInt8 flow = SWEEP_FLOW(k->path, SWEEP_LINK(k->producer, k->consumer));
+	UInt64 end = transport_timerRead()
+			+ (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+
+	while (sent < k->packets) {
+		want = k->packets - sent;
+		want = (want < k->batch) ? want : k->batch;
+		// The header words may be in L1D from another case's producer
+		n = tdesc_popBatch(freeq, descs, want, MONOLITHIC_DESC_DATA_OFFSET);
+		if (n == 0) {
+			if (transport_timerRead() > end)
+				return;
+			Task_yield();
+			continue;
+		}
+
+		for (i = 0; i < n; i++) {
+			sweepPattern(tdesc_payload(descs[i]), k->size, 0);
+			tstats_seqStamp(tdesc_payload(descs[i]) + SWEEP_SEQ_OFFSET,
+					sent + i);
+			size = tdesc_txSetup(descs[i], k->size, flow, retq);
+		}
+		for (i = 0; i < n; i++) {
+			tlat_stamp(tdesc_payload(descs[i]));
+		}
+		tdesc_pushBatch(opq, descs, n, size, size);
+		sent += n;
+	}
+}
+
+/*
+ *  ======== sweepProduceRing ========
+ *  sweepProduce for a ring case: a burst is published with one head
+ *  write back.
+ */
+static Void sweepProduceRing(const SweepCase *k)
+{
+	TRingEnd e;
+	UInt8 *msgs[TDESC_MAX_BATCH];
+	UInt32 n, i, want, sent = 0;
+	UInt64 end = transport_timerRead()
+			+ (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+
+	tring_attachProducer(&e, &sweepRing);
+
+	while (sent < k->packets) {
+		want = k->packets - sent;
+		want = (want < k->batch) ? want : k->batch;
+		for (n = 0; n < want; n++) {
+			if ((msgs[n] = tring_alloc(&e)) == NULL)
+				break;
+			sweepPattern(msgs[n], k->size, 0);
+			tstats_seqStamp(msgs[n] + SWEEP_SEQ_OFFSET, sent + n);
+		}
+
+		if (n == 0) {
+			if (transport_timerRead() > end)
+				return;
+			Task_yield();
+			continue;
+		}
+
+		for (i = 0; i < n; i++) {
+			tlat_stamp(msgs[i]);
+			tring_send(&e, msgs[i], k->size);
+		}
+		tring_publish(&e);
+		sent += n;
+	}
+}
+
+/*
+ *  ======== sweepProduceBcast ========
+ *  sweepProduce for a bcast case: every chain is published to all the
+ *  readers, as soon as a slot of the channel is free again.
+ */
+static Void sweepProduceBcast(const SweepCase *k, Qmss_QueueHnd freeq)
+{
+	Cppi_Desc *sops[TDESC_MAX_BATCH];
+	UInt8 *buf;
+	UInt32 n, i, want, len, sent = 0;
+	UInt64 end = transport_timerRead()
+			+ (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+
+	while (sent < k->packets) {
+		want = k->packets - sent;
+		want = (want < k->batch) ? want : k->batch;
+		for (n = 0; n < want; n++) {
+			if ((sops[n] = thdesc_txAlloc(freeq, k->size)) == NULL)
+				break;
+			sweepFill(sops[n]);
+			Cppi_getData(Cppi_DescType_HOST, sops[n], &buf, &len);
+			tstats_seqStamp(buf + SWEEP_SEQ_OFFSET, sent + n);
+		}
+
+		for (i = 0; i < n; ) {
+			Cppi_getData(Cppi_DescType_HOST, sops[i], &buf, &len);
+			tlat_stamp(buf);
+			if (tbcast_publish(&sweepBcast, sops[i], k->readers) == 0) {
+				i++;
+			} else if (transport_timerRead() > end) {
+				thdesc_txCancel(freeq, sops[i++]);
+			} else {
+				Task_yield();
+			}
+		}
+
+		if (n == 0) {
+			if (transport_timerRead() > end)
+				return;
+			Task_yield();
+			continue;
+		}
+		sent += n;
+	}
+}
+
+/*
+ *  ======== sweepCheck ========
+ *  Checks len received bytes that start total bytes into the payload, the
+ *  header with its stamp and sequence number being in the first ones, and
+ *  returns the bad words.
+ */
+static UInt32 sweepCheck(TStats *stats, TLatHist *hist, UInt8 *buf,
+		UInt32 len, UInt32 total)
+{
+	UInt32 bad = 0, skip = 0;
+
+	if (total == 0) {
+		tlat_add(hist, tlat_now() - tlat_read(buf));
+		bad += tstats_seq(stats, buf + SWEEP_SEQ_OFFSET);
+		skip = SWEEP_HDR_SIZE;
+	}
+	return bad + tstats_checkPayloadAt(buf + skip, len - skip,
+			(total + skip) / 4);
+}
+
+/*
+ *  ======== sweepConsume ========
+ *  Receives the packets of the case in pops of up to batch, checks them
+ *  and counts them in the stats and the latency histogram of the link,
+ *  and publishes both. Returns the consumer's start time of the case.
+ */
+static UInt64 sweepConsume(const SweepCase *k, Qmss_QueueHnd rxq,
+		Qmss_QueueHnd freeq)
+{
+	TStats *stats = &tstats[k->producer][k->consumer];
+	TLatHist *hist = &tlat[k->producer][k->consumer];
+	Cppi_Desc *descs[TDESC_MAX_BATCH], *d;
+	TRingEnd e;
+	UInt8 *buf;
+	UInt32 n, i, len, total, bad, got = 0;
+	UInt64 start = transport_timerRead();
+	UInt64 end = start + (UInt64) (TRANSPORT_TIMER_HZ / 1000 * SWEEP_TIMEOUT_MS);
+
+	CACHE_invL1d((void *) stats, sizeof(*stats), CACHE_WAIT);
+	CACHE_invL1d((void *) hist, sizeof(*hist), CACHE_WAIT);
+	if (k->path == SWEEP_PATH_RING)
+		tring_attachConsumer(&e, &sweepRing);
+
+	while (got < k->packets) {
+		if (k->path == SWEEP_PATH_RING) {
+			// Each message is checked as it comes, the slots go back together
+			for (n = 0; n < k->batch; n++) {
+				if ((buf = tring_recv(&e, &len)) == NULL)
+					break;
+				tstats_count(stats, len, sweepCheck(stats, hist, buf, len, 0));
+			}
+			if (n > 0)
+				tring_release(&e);
+		} else if (k->path == SWEEP_PATH_BCAST) {
+			// One broadcast held at a time, released once checked
+			for (n = 0; n < k->batch; n++) {
+				if ((descs[0] = tbcast_recv(&sweepReader[k->consumer])) == NULL)
+					break;
+				total = 0;
+				bad = 0;
+				for (d = descs[0]; d != NULL; d = thdesc_next(d)) {
+					thdesc_getData(d, &buf, &len);
+					bad += sweepCheck(stats, hist, buf, len, total);
+					total += len;
+				}
+				tstats_count(stats, total, bad);
+				tbcast_release(&sweepReader[k->consumer]);
+			}
+		} else {
+			n = tdesc_popBatch(rxq, descs, k->batch,
+					(k->path == SWEEP_PATH_MONO) ? SWEEP_MONO_SIZE
+							: THDESC_HEADER_SIZE);
+		}
+
+		if (n == 0) {
+			if (transport_timerRead() > end)
+				break;
+			Task_yield();
+			continue;
+		}
+		got += n;
+
+		if (k->path == SWEEP_PATH_MONO) {
+			for (i = 0; i < n; i++) {
+				Cppi_getData(Cppi_DescType_MONOLITHIC, descs[i], &buf, &len);
+				tstats_count(stats, len, sweepCheck(stats, hist, buf, len, 0));
+			}
+			tdesc_pushBatch(freeq, descs, n, 0, 0);
+		} else if (k->path == SWEEP_PATH_HDESC) {
+			for (i = 0; i < n; i++) {
+				total = 0;
+				bad = 0;
+				for (d = descs[i]; d != NULL; d = thdesc_next(d)) {
+					thdesc_getData(d, &buf, &len);
+					bad += sweepCheck(stats, hist, buf, len, total);
+					total += len;
+				}
+				tstats_count(stats, total, bad);
+			}
+			for (i = 0; i < n; i++) {
+				thdesc_recycle(freeq, descs[i]);
+			}
+		}
+	}
+
+	tstats_publish(stats);
+	CACHE_wbL1d((void *) hist, sizeof(*hist), CACHE_WAIT);
+	return start;
+}
+
+/*
+ *  ======== sweepReport ========
+ *  Core 0: the CSV row of a case, from the link's stats and histogram and
+ *  the consumer's start time.
+ */
+static Void sweepReport(const SweepCase *k, UInt64 start)
+{
+	TStats *stats = &tstats[k->producer][k->consumer];
+	TLatHist *hist = &tlat[k->producer][k->consumer];
+	double us = 1e6 / TRANSPORT_TIMER_HZ;
+	double secs, pps = 0.0, mbps = 0.0;
+
+	CACHE_invL1d((void *) stats, sizeof(*stats), CACHE_WAIT);
+	CACHE_invL1d((void *) hist, sizeof(*hist), CACHE_WAIT);
+
+	if (stats->packets > 0 && stats->last > start) {
+		secs = (stats->last - start) / TRANSPORT_TIMER_HZ;
+		pps = stats->packets / secs;
+		mbps = stats->bytes / secs / 1e6;
+	}
+
+	printf("%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%.0f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+			sweepPathNames[k->path], k->producer, k->consumer, k->size,
+			k->descs, k->batch,
+			stats->packets, stats->errors, k->packets - stats->packets,
+			stats->reorders, pps, mbps, tlat_percentile(hist, 500) * us,
+			tlat_percentile(hist, 990) * us, tlat_percentile(hist, 999) * us,
+			hist->max * us);
+}
+
+/*
+ *  ======== sweepTask ========
+ *  Runs on every core of SWEEP_CORES and goes through the cases with the
+ *  others, playing producer, consumer or bystander in each.
+ */
+void sweepTask(UArg a0, UArg a1) {
+	Qmss_QueueHnd txFree[2], rxFree[2];
+	Qmss_QueueHnd opq = 0, rxq[MAX_CORES];
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	UInt32 i, p, round = 0;
+	UInt8 is_allocated;
+	SweepCase k, r;
+
+	// The free queues of the two PKTDMA paths
+	for (p = 0; p < 2; p++) {
+		txFree[p] = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_TX_FREE_NUM + p, &is_allocated);
+		rxFree[p] = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_RX_FREE_NUM + p, &is_allocated);
+	}
+
+	if (SWEEP_IS(SWEEP_PRODUCERS, core_num)) {
+		opq = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_TX_OP_NUM + core_num, &is_allocated);
+	}
+	for (p = 0; p < MAX_CORES; p++) {
+		rxq[p] = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QUEUE_RX_LINK_NUM + SWEEP_LINK(p, core_num), &is_allocated);
+	}
+
+	tlat_sync(SWEEP_CORES);
+
+	if (core_num == 0) {
+		printf("# transport_sweep: hdesc %d B buffers, mono %d B "
+				"descriptors, ring %d B slots, bcast %d slots, %.0f ticks/s\n",
+				SWEEP_BUF_SIZE, SWEEP_MONO_SIZE, SWEEP_SLOT_SIZE, TBCAST_DEPTH,
+				TRANSPORT_TIMER_HZ);
+		printf("path,producer,consumer,size,descs,batch,packets,errors,lost,"
+				"reordered,pkt_per_s,mb_per_s,lat_p50_us,lat_p99_us,"
+				"lat_p999_us,lat_max_us\n");
+	}
+
+	for (i = 0; sweepCase(i, &k); i++) {
+		if (!sweepFits(&k))
+			continue;
+
+		if (core_num == 0)
+			sweepSetup(&k, txFree, rxFree);
+		sweepBarrier(core_num, ++round);
+
+		// Readers attach before the first broadcast is published
+		if (k.path == SWEEP_PATH_BCAST) {
+			if (SWEEP_IS(k.readers, core_num))
+				tbcast_attach(&sweepReader[core_num], &sweepBcast, core_num);
+			sweepBarrier(core_num, ++round);
+		}
+
+		if (core_num == k.producer) {
+			if (k.path == SWEEP_PATH_HDESC)
+				sweepProduce(&k, opq, txFree[SWEEP_POOL(k.path)]);
+			else if (k.path == SWEEP_PATH_MONO)
+				sweepProduceMono(&k, opq, txFree[SWEEP_POOL(k.path)]);
+			else if (k.path == SWEEP_PATH_RING)
+				sweepProduceRing(&k);
+			else
+				sweepProduceBcast(&k, txFree[SWEEP_POOL(k.path)]);
+		}
+		if (SWEEP_IS(k.readers, core_num)) {
+			r = k;
+			r.consumer = core_num;
+			sweepSync[core_num].start = sweepConsume(&r, rxq[k.producer],
+					rxFree[SWEEP_POOL(k.path)]);
+		}
+		// The barrier writes the start time back, and core 0 reads it
+		sweepBarrier(core_num, ++round);
+
+		if (core_num == 0) {
+			r = k;
+			for (p = 0; p < MAX_CORES; p++) {
+				if (!SWEEP_IS(k.readers, p))
+					continue;
+				r.consumer = p;
+				sweepReport(&r, sweepSync[p].start);
+			}
+			sweepRestore(&k, txFree[SWEEP_POOL(k.path)],
+					rxFree[SWEEP_POOL(k.path)]);
+		}
+	}
+
+	if (core_num == 0) {
+		printf("# transport_sweep: done\n");
+		BIOS_exit(0);
+	}
+}
+
+/*
+ *  ======== rxFlowOpen ========
+ *  Configures the Rx flow of link (producer, consumer) on a PKTDMA path to
+ *  deliver into the link's Rx queue from freeq, writing producer into the
+ *  destination tag.
+ */
+static Int rxFlowOpen(Cppi_Handle hnd, UInt32 path, UInt32 producer,
+		UInt32 consumer, Qmss_QueueHnd freeq)
+{
+	Cppi_RxFlowCfg rxFlowCfg;
+	Qmss_QueueHnd destq;
+	Qmss_Queue queInfo;
+	unsigned char is_allocated;
+
+	memset((Void *) &rxFlowCfg, 0, sizeof(Cppi_RxFlowCfg));
+
+	destq = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+			QUEUE_RX_LINK_NUM + SWEEP_LINK(producer, consumer), &is_allocated);
+	queInfo = Qmss_getQueueNumber(destq);
+	rxFlowCfg.flowIdNum = SWEEP_FLOW(path, SWEEP_LINK(producer, consumer));
+	rxFlowCfg.rx_dest_qnum = queInfo.qNum;
+	rxFlowCfg.rx_dest_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_dest_tag_lo_sel = 1;
+	rxFlowCfg.rx_dest_tag_lo = producer;
+	/* Wait for free descriptors, the case holds them back */
+	rxFlowCfg.rx_error_handling = 1;
+	if (path == SWEEP_PATH_MONO) {
+		rxFlowCfg.rx_sop_offset = MONOLITHIC_DESC_DATA_OFFSET;
+		rxFlowCfg.rx_desc_type = Cppi_DescType_MONOLITHIC;
+	} else {
+		rxFlowCfg.rx_sop_offset = 0;
+		rxFlowCfg.rx_desc_type = Cppi_DescType_HOST;
+	}
+	/* All buffers of a packet from the one free queue */
+	queInfo = Qmss_getQueueNumber(freeq);
+	rxFlowCfg.rx_fdq0_sz0_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq0_sz0_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_fdq1_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq1_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_fdq2_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq2_qmgr = queInfo.qMgr;
+	rxFlowCfg.rx_fdq3_qnum = queInfo.qNum;
+	rxFlowCfg.rx_fdq3_qmgr = queInfo.qMgr;
+
+	if (Cppi_configureRxFlow(hnd, &rxFlowCfg, &is_allocated) == NULL) {
+		printf("Error: Opening Rx flow : %d\n", rxFlowCfg.flowIdNum);
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ *  ======== sweepInit ========
+ *  Core 0: QMSS, the descriptor pools, CPPI, the Rx flows of all pairs
+ *  and the channels of all producers. Returns the CPPI handle, or NULL.
+ */
+static Cppi_Handle sweepInit(Void)
+{
+	Qmss_InitCfg qmssInitConfig;
+	Cppi_CpDmaInitCfg cpdmaCfg;
+	Qmss_MemRegInfo mem_reg;
+	Cppi_DescCfg cppi_cfg;
+	Cppi_TxChInitCfg txChCfg;
+	Cppi_RxChInitCfg rxChCfg;
+	Cppi_ChHnd txChHnd, rxChHnd;
+	Qmss_QueueHnd q_tx_free, q_rx_free, q_mono_tx_free, q_mono_rx_free;
+	Cppi_Handle hnd;
+	unsigned int num_allocated;
+	unsigned char is_allocated;
+	int ret, p, c;
+
+	memset(&qmssInitConfig, 0, sizeof(Qmss_InitCfg));
+	qmssInitConfig.maxDescNum = 4 * SWEEP_NUM_DESC;
+	ret = Qmss_init(&qmssInitConfig, &qmssGblCfgParams);
+	if (ret != QMSS_SOK) {
+		printf("Error initializing Queue Manager SubSystem error code : %d\n",
+				ret);
+		return NULL;
+	}
+	if (Qmss_start() != QMSS_SOK) {
+		printf("Error starting QMSS.\n");
+		return NULL;
+	}
+
+	/* One region for the host descriptors of both sides, in core 0's
+	 * L2; their buffers are in MSMCSRAM.
+	 */
+	mem_reg.descBase = (unsigned int *) l2_global_address(
+			(UInt32) sweep_desc.host, 0);
+	mem_reg.descSize = SIZE_HOST_DESC;
+	mem_reg.descNum = 2 * SWEEP_NUM_DESC;
+	mem_reg.manageDescFlag = Qmss_ManageDesc_MANAGE_DESCRIPTOR;
+	mem_reg.memRegion = Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED;
+	mem_reg.startIndex = 0;
+
+	ret = Qmss_insertMemoryRegion(&mem_reg);
+	if (ret < 0) {
+		printf("Error inserting the host descriptor memory.\n");
+		return NULL;
+	}
+
+	memset(&cppi_cfg, 0, sizeof(cppi_cfg));
+	cppi_cfg.memRegion = (Qmss_MemRegion) ret;
+	cppi_cfg.descNum = SWEEP_NUM_DESC;
+	cppi_cfg.destQueueNum = QUEUE_TX_FREE_NUM;
+	cppi_cfg.queueType = Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
+	cppi_cfg.initDesc = Cppi_InitDesc_INIT_DESCRIPTOR;
+	cppi_cfg.descType = Cppi_DescType_HOST;
+	cppi_cfg.returnQueue.qMgr = QMSS_PARAM_NOT_SPECIFIED;
+	cppi_cfg.returnQueue.qNum = QMSS_PARAM_NOT_SPECIFIED;
+	cppi_cfg.epibPresent = Cppi_EPIB_NO_EPIB_PRESENT;
+	cppi_cfg.cfg.host.returnPolicy = Cppi_ReturnPolicy_RETURN_BUFFER;
+	cppi_cfg.cfg.host.psLocation = Cppi_PSLoc_PS_IN_DESC;
+	q_tx_free = Cppi_initDescriptor(&cppi_cfg, &num_allocated);
+
+	cppi_cfg.destQueueNum = QUEUE_RX_FREE_NUM;
+	q_rx_free = Cppi_initDescriptor(&cppi_cfg, &num_allocated);
+
+	if (thdesc_attach(q_tx_free, sweep_tx_bufs, SWEEP_BUF_SIZE,
+			SWEEP_NUM_DESC) != SWEEP_NUM_DESC
+			|| thdesc_attach(q_rx_free, sweep_rx_bufs, SWEEP_BUF_SIZE,
+			SWEEP_NUM_DESC) != SWEEP_NUM_DESC) {
+		printf("Error attaching the host buffers.\n");
+		return NULL;
+	}
+
+	/* A second region, right after it, for the monolithic descriptors */
+	mem_reg.descBase = (unsigned int *) l2_global_address(
+			(UInt32) sweep_desc.mono, 0);
+	mem_reg.descSize = SWEEP_MONO_SIZE;
+	mem_reg.descNum = 2 * SWEEP_NUM_DESC;
+	mem_reg.startIndex = 2 * SWEEP_NUM_DESC;
+
+	ret = Qmss_insertMemoryRegion(&mem_reg);
+	if (ret < 0) {
+		printf("Error inserting the monolithic descriptor memory.\n");
+		return NULL;
+	}
+
+	memset(&cppi_cfg, 0, sizeof(cppi_cfg));
+	cppi_cfg.memRegion = (Qmss_MemRegion) ret;
+	cppi_cfg.descNum = SWEEP_NUM_DESC;
+	cppi_cfg.destQueueNum = QUEUE_TX_FREE_NUM + SWEEP_PATH_MONO;
+	cppi_cfg.queueType = Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
+	cppi_cfg.initDesc = Cppi_InitDesc_INIT_DESCRIPTOR;
+	cppi_cfg.descType = Cppi_DescType_MONOLITHIC;
+	cppi_cfg.cfg.mono.dataOffset = MONOLITHIC_DESC_DATA_OFFSET;
+	cppi_cfg.returnQueue.qMgr = QMSS_PARAM_NOT_SPECIFIED;
+	cppi_cfg.returnQueue.qNum = QMSS_PARAM_NOT_SPECIFIED;
+	cppi_cfg.epibPresent = Cppi_EPIB_NO_EPIB_PRESENT;
+	q_mono_tx_free = Cppi_initDescriptor(&cppi_cfg, &num_allocated);
+
+	cppi_cfg.destQueueNum = QUEUE_RX_FREE_NUM + SWEEP_PATH_MONO;
+	q_mono_rx_free = Cppi_initDescriptor(&cppi_cfg, &num_allocated);
+
+	if (q_mono_tx_free < 0 || q_mono_rx_free < 0) {
+		printf("Error initializing the monolithic descriptors.\n");
+		return NULL;
+	}
+
+	/* Park them all until a case takes some */
+	for (p = 0; p < 2; p++) {
+		sweepTxSpare[p] = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QMSS_PARAM_NOT_SPECIFIED, &is_allocated);
+		sweepRxSpare[p] = Qmss_queueOpen(Qmss_QueueType_GENERAL_PURPOSE_QUEUE,
+				QMSS_PARAM_NOT_SPECIFIED, &is_allocated);
+		if (sweepTxSpare[p] < 0 || sweepRxSpare[p] < 0) {
+			printf("Error opening the spare queues.\n");
+			return NULL;
+		}
+	}
+	sweepMove(q_tx_free, sweepTxSpare[SWEEP_PATH_HDESC], SWEEP_NUM_DESC);
+	sweepMove(q_rx_free, sweepRxSpare[SWEEP_PATH_HDESC], SWEEP_NUM_DESC);
+	sweepMove(q_mono_tx_free, sweepTxSpare[SWEEP_PATH_MONO], SWEEP_NUM_DESC);
+	sweepMove(q_mono_rx_free, sweepRxSpare[SWEEP_PATH_MONO], SWEEP_NUM_DESC);
+
+	ret = Cppi_init(&cppiGblCfgParams);
+	if (ret != CPPI_SOK) {
+		printf("Error initializing CPPI: %d\n", ret);
+		return NULL;
+	}
+	memset((Void *) &cpdmaCfg, 0, sizeof(Cppi_CpDmaInitCfg));
+	cpdmaCfg.dmaNum = Cppi_CpDma_QMSS_CPDMA;
+	hnd = (Cppi_Handle) Cppi_open(&cpdmaCfg);
+	if (hnd == NULL) {
+		printf("Error opening CPPI\n");
+		return NULL;
+	}
+
+	for (p = 0; p < MAX_CORES; p++) {
+		if (!SWEEP_IS(SWEEP_PRODUCERS, p))
+			continue;
+
+		for (c = 0; c < MAX_CORES; c++) {
+			if (!SWEEP_IS(SWEEP_CONSUMERS, c) || c == p)
+				continue;
+			if (rxFlowOpen(hnd, SWEEP_PATH_HDESC, p, c, q_rx_free) < 0
+					|| rxFlowOpen(hnd, SWEEP_PATH_MONO, p, c,
+							q_mono_rx_free) < 0)
+				return NULL;
+		}
+
+		/* Tx and Rx channel p, looped back by the PKTDMA */
+		txChCfg.channelNum = p;
+		txChCfg.priority = 0;
+		txChCfg.filterEPIB = 0;
+		txChCfg.filterPS = 0;
+		txChCfg.aifMonoMode = 0;
+		txChCfg.txEnable = Cppi_ChState_CHANNEL_DISABLE;
+		txChHnd = (Cppi_ChHnd) Cppi_txChannelOpen(hnd, &txChCfg,
+				&is_allocated);
+
+		rxChCfg.channelNum = p;
+		rxChCfg.rxEnable = Cppi_ChState_CHANNEL_DISABLE;
+		rxChHnd = (Cppi_ChHnd) Cppi_rxChannelOpen(hnd, &rxChCfg,
+				&is_allocated);
+
+		if (txChHnd == NULL || rxChHnd == NULL) {
+			printf("Error opening PKTDMA channel %d\n", p);
+			return NULL;
+		}
+		Cppi_channelEnable(rxChHnd);
+		Cppi_channelEnable(txChHnd);
+	}
+
+	return hnd;
+}
+
+/*
+ *
+ * Master Task
+ * Core 0 initializes QMSS and CPPI, the others wait for it; then every
+ * core of SWEEP_CORES runs sweepTask
+ *
+ */
+void master_task() {
+	UInt32 core_num = CSL_chipReadReg(CSL_CHIP_DNUM);
+	Cppi_CpDmaInitCfg cpdmaCfg;
+	Cppi_Handle hnd;
+
+	if (!SWEEP_IS(SWEEP_CORES, core_num))
+		return;
+
+	if (core_num == 0) {
+		if ((hnd = sweepInit()) == NULL)
+			return;
+
+		/* Only now let the other cores in */
+		cppiHnd = hnd;
+		CACHE_wbL1d((void *) &cppiHnd, 128, CACHE_WAIT);
+	} else {
+		if (Qmss_start() != QMSS_SOK) {
+			printf("Error starting QMSS.\n");
+			return;
+		}
+
+		while (cppiHnd == NULL) {
+			CACHE_invL1d((void *) &cppiHnd, 128, CACHE_WAIT);
+		}
+
+		memset((Void *) &cpdmaCfg, 0, sizeof(Cppi_CpDmaInitCfg));
+		cpdmaCfg.dmaNum = Cppi_CpDma_QMSS_CPDMA;
+		hnd = (Cppi_Handle) Cppi_open(&cpdmaCfg);
+		if (hnd == NULL) {
+			printf("Error opening CPPI\n");
+			return;
+		}
+	}
+
+	Task_create(sweepTask, NULL, NULL);
+}
+
+/*
+ *  ======== main ========
+ */
+Int main()
+{
+	Task_create((Task_FuncPtr) master_task, NULL, NULL);
+	BIOS_start();
+	return 0;
+}
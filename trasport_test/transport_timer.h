@@ -0,0 +1,70 @@
+/*
+ *  ======== transport_timer.h ========
+ *  Time stamp used by the transport measurements. On the C66x this is the
+ *  64-bit TSCH:TSCL counter (CPU cycles); on a host build (see
+ *  host/emu_bios.c) it is CLOCK_MONOTONIC in ns. TRANSPORT_TIMER_HZ is the
+ *  number of ticks per second. TRANSPORT_TIMER_GLOBAL says whether all
+ *  cores read the same time (see transport_latency.h for when not).
+ */
+
+#ifndef TRANSPORT_TIMER_H_
+#define TRANSPORT_TIMER_H_
+
+#ifdef _TMS320C6X
+
+#include <c6x.h>
+
+#define TRANSPORT_TIMER_UNIT "cycle"
+
+/* every core has its own TSC, started when the core first writes TSCL */
+#define TRANSPORT_TIMER_GLOBAL 0
+
+/* C6670 core clock, build with -DTRANSPORT_TIMER_HZ=1200000000 on 1.2 GHz parts */
+#ifndef TRANSPORT_TIMER_HZ
+#define TRANSPORT_TIMER_HZ 1000000000.0
+#endif
+
+/*
+ *  ======== transport_timerInit ========
+ *  Any write to TSCL starts the free-running counter.
+ */
+static inline void transport_timerInit(void)
+{
+	TSCL = 0;
+}
+
+/*
+ *  ======== transport_timerRead ========
+ *  TSCL must be read first, it latches TSCH.
+ */
+static inline unsigned long long transport_timerRead(void)
+{
+	unsigned int lo = TSCL;
+	unsigned int hi = TSCH;
+
+	return _itoll(hi, lo);
+}
+
+#else
+
+#include <time.h>
+
+#define TRANSPORT_TIMER_UNIT "ns"
+#define TRANSPORT_TIMER_GLOBAL 1
+#define TRANSPORT_TIMER_HZ 1000000000.0
+
+static inline void transport_timerInit(void)
+{
+}
+
+static inline unsigned long long transport_timerRead(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#endif /* _TMS320C6X */
+
+#endif /* TRANSPORT_TIMER_H_ */